@@ -191,7 +191,7 @@ double ComputeTempAsphere::compute_scalar()
   invoked_scalar = update->ntimestep;
 
   if (tempbias) {
-    if (tbias->invoked_scalar != update->ntimestep) tbias->compute_scalar();
+    if (tbias->invoked_scalar != update->ntimestep) tbias->invoke_scalar();
     tbias->remove_bias_all();
   }
 
@@ -283,7 +283,7 @@ void ComputeTempAsphere::compute_vector()
   invoked_vector = update->ntimestep;
 
   if (tempbias) {
-    if (tbias->invoked_vector != update->ntimestep) tbias->compute_vector();
+    if (tbias->invoked_vector != update->ntimestep) tbias->invoke_vector();
     tbias->remove_bias_all();
   }
 
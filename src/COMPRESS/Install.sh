@@ -38,6 +38,8 @@ if (test $1 = 1) then
 
   if (test -e ../Makefile.package) then
     sed -i -e 's/[^ \t]*compress[^ \t]* //' ../Makefile.package
+    sed -i -e 's/[^ \t]*COMPRESS[^ \t]* //' ../Makefile.package
+    sed -i -e 's|^PKG_INC =[ \t]*|&-DLMP_COMPRESS |' ../Makefile.package
     sed -i -e 's|^PKG_SYSINC =[ \t]*|&$(compress_SYSINC) |' ../Makefile.package
     sed -i -e 's|^PKG_SYSLIB =[ \t]*|&$(compress_SYSLIB) |' ../Makefile.package
     sed -i -e 's|^PKG_SYSPATH =[ \t]*|&$(compress_SYSPATH) |' ../Makefile.package
@@ -55,6 +57,7 @@ elif (test $1 = 0) then
 
   if (test -e ../Makefile.package) then
     sed -i -e 's/[^ \t]*compress[^ \t]* //' ../Makefile.package
+    sed -i -e 's/[^ \t]*COMPRESS[^ \t]* //' ../Makefile.package
   fi
 
   if (test -e ../Makefile.package.settings) then
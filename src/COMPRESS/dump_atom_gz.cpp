@@ -14,6 +14,8 @@
 #include "dump_atom_gz.h"
 #include "domain.h"
 #include "error.h"
+#include "gz_frame.h"
+#include "memory.h"
 #include "update.h"
 
 #include <string.h>
@@ -24,6 +26,8 @@ DumpAtomGZ::DumpAtomGZ(LAMMPS *lmp, int narg, char **arg) :
   DumpAtom(lmp, narg, arg)
 {
   gzFp = NULL;
+  gzframe = new GzFrame(lmp,9);
+  async_allow = 0;
 
   if (!compressed)
     error->all(FLERR,"Dump atom/gz only writes compressed files");
@@ -33,7 +37,8 @@ DumpAtomGZ::DumpAtomGZ(LAMMPS *lmp, int narg, char **arg) :
 
 DumpAtomGZ::~DumpAtomGZ()
 {
-  if (gzFp) gzclose(gzFp);
+  if (gzFp) fclose(gzFp);
+  delete gzframe;
   gzFp = NULL;
   fp = NULL;
 }
@@ -77,9 +82,9 @@ void DumpAtomGZ::openfile()
 
   if (filewriter) {
     if (append_flag) {
-      gzFp = gzopen(filecurrent,"ab9");
+      gzFp = fopen(filecurrent,"ab");
     } else {
-      gzFp = gzopen(filecurrent,"wb9");
+      gzFp = fopen(filecurrent,"wb");
     }
 
     if (gzFp == NULL) error->one(FLERR,"Cannot open dump file");
@@ -96,34 +101,65 @@ void DumpAtomGZ::write_header(bigint ndump)
 {
   if ((multiproc) || (!multiproc && me == 0)) {
     if (domain->triclinic == 0) {
-      gzprintf(gzFp,"ITEM: TIMESTEP\n");
-      gzprintf(gzFp,BIGINT_FORMAT "\n",update->ntimestep);
-      gzprintf(gzFp,"ITEM: NUMBER OF ATOMS\n");
-      gzprintf(gzFp,BIGINT_FORMAT "\n",ndump);
-      gzprintf(gzFp,"ITEM: BOX BOUNDS %s\n",boundstr);
-      gzprintf(gzFp,"%g %g\n",boxxlo,boxxhi);
-      gzprintf(gzFp,"%g %g\n",boxylo,boxyhi);
-      gzprintf(gzFp,"%g %g\n",boxzlo,boxzhi);
-      gzprintf(gzFp,"ITEM: ATOMS %s\n",columns);
+      gzframe->print("ITEM: TIMESTEP\n");
+      gzframe->print(BIGINT_FORMAT "\n",update->ntimestep);
+      gzframe->print("ITEM: NUMBER OF ATOMS\n");
+      gzframe->print(BIGINT_FORMAT "\n",ndump);
+      gzframe->print("ITEM: BOX BOUNDS %s\n",boundstr);
+      gzframe->print("%g %g\n",boxxlo,boxxhi);
+      gzframe->print("%g %g\n",boxylo,boxyhi);
+      gzframe->print("%g %g\n",boxzlo,boxzhi);
+      gzframe->print("ITEM: ATOMS %s\n",columns);
     } else {
-      gzprintf(gzFp,"ITEM: TIMESTEP\n");
-      gzprintf(gzFp,BIGINT_FORMAT "\n",update->ntimestep);
-      gzprintf(gzFp,"ITEM: NUMBER OF ATOMS\n");
-      gzprintf(gzFp,BIGINT_FORMAT "\n",ndump);
-      gzprintf(gzFp,"ITEM: BOX BOUNDS xy xz yz %s\n",boundstr);
-      gzprintf(gzFp,"%g %g %g\n",boxxlo,boxxhi,boxxy);
-      gzprintf(gzFp,"%g %g %g\n",boxylo,boxyhi,boxxz);
-      gzprintf(gzFp,"%g %g %g\n",boxzlo,boxzhi,boxyz);
-      gzprintf(gzFp,"ITEM: ATOMS %s\n",columns);
+      gzframe->print("ITEM: TIMESTEP\n");
+      gzframe->print(BIGINT_FORMAT "\n",update->ntimestep);
+      gzframe->print("ITEM: NUMBER OF ATOMS\n");
+      gzframe->print(BIGINT_FORMAT "\n",ndump);
+      gzframe->print("ITEM: BOX BOUNDS xy xz yz %s\n",boundstr);
+      gzframe->print("%g %g %g\n",boxxlo,boxxhi,boxxy);
+      gzframe->print("%g %g %g\n",boxylo,boxyhi,boxxz);
+      gzframe->print("%g %g %g\n",boxzlo,boxzhi,boxyz);
+      gzframe->print("ITEM: ATOMS %s\n",columns);
     }
+    gzframe->write_text(gzFp);
   }
 }
 
+/* ----------------------------------------------------------------------
+   convert mybuf to text, then compress it as gzip member(s) in sbuf
+   the filewriter concatenates members from all procs in its cluster
+------------------------------------------------------------------------- */
+
+int DumpAtomGZ::convert_string(int n, double *mybuf)
+{
+  int nchars = DumpAtom::convert_string(n,mybuf);
+  if (nchars <= 0) return nchars;
+
+  int nbytes = gzframe->compress(sbuf,nchars);
+  if (nbytes < 0) return -1;
+  if (nbytes > maxsbuf) {
+    maxsbuf = nbytes;
+    memory->grow(sbuf,maxsbuf,"dump:sbuf");
+  }
+  memcpy(sbuf,gzframe->zbuf,nbytes);
+  return nbytes;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void DumpAtomGZ::write_data(int n, double *mybuf)
 {
-  gzwrite(gzFp,mybuf,sizeof(char)*n);
+  fwrite(mybuf,sizeof(char),n,gzFp);
+}
+
+/* ----------------------------------------------------------------------
+   current offset is always a gzip member boundary
+------------------------------------------------------------------------- */
+
+bigint DumpAtomGZ::file_offset()
+{
+  if (gzFp == NULL) return -1;
+  return ftell(gzFp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -133,11 +169,11 @@ void DumpAtomGZ::write()
   DumpAtom::write();
   if (filewriter) {
     if (multifile) {
-      gzclose(gzFp);
+      fclose(gzFp);
       gzFp = NULL;
     } else {
       if (flush_flag)
-        gzflush(gzFp,Z_SYNC_FLUSH);
+        fflush(gzFp);
     }
   }
 }
@@ -21,7 +21,6 @@ DumpStyle(atom/gz,DumpAtomGZ)
 #define LMP_DUMP_ATOM_GZ_H
 
 #include "dump_atom.h"
-#include <zlib.h>
 
 namespace LAMMPS_NS {
 
@@ -31,11 +30,14 @@ class DumpAtomGZ : public DumpAtom {
   virtual ~DumpAtomGZ();
 
  protected:
-  gzFile gzFp;  // file pointer for the compressed output stream
+  FILE *gzFp;               // file for the stream of gzip members
+  class GzFrame *gzframe;   // compressor for gzip members
 
   virtual void openfile();
   virtual void write_header(bigint);
+  virtual int convert_string(int, double *);
   virtual void write_data(int, double *);
+  virtual bigint file_offset();
   virtual void write();
 };
 
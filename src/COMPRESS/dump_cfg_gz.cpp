@@ -15,6 +15,8 @@
 #include "atom.h"
 #include "domain.h"
 #include "error.h"
+#include "gz_frame.h"
+#include "memory.h"
 #include "update.h"
 
 #include <string.h>
@@ -26,6 +28,8 @@ DumpCFGGZ::DumpCFGGZ(LAMMPS *lmp, int narg, char **arg) :
   DumpCFG(lmp, narg, arg)
 {
   gzFp = NULL;
+  gzframe = new GzFrame(lmp,9);
+  async_allow = 0;
 
   if (!compressed)
     error->all(FLERR,"Dump cfg/gz only writes compressed files");
@@ -36,7 +40,8 @@ DumpCFGGZ::DumpCFGGZ(LAMMPS *lmp, int narg, char **arg) :
 
 DumpCFGGZ::~DumpCFGGZ()
 {
-  if (gzFp) gzclose(gzFp);
+  if (gzFp) fclose(gzFp);
+  delete gzframe;
   gzFp = NULL;
   fp = NULL;
 }
@@ -81,9 +86,9 @@ void DumpCFGGZ::openfile()
 
   if (filewriter) {
     if (append_flag) {
-      gzFp = gzopen(filecurrent,"ab9");
+      gzFp = fopen(filecurrent,"ab");
     } else {
-      gzFp = gzopen(filecurrent,"wb9");
+      gzFp = fopen(filecurrent,"wb");
     }
 
     if (gzFp == NULL) error->one(FLERR,"Cannot open dump file");
@@ -111,28 +116,59 @@ void DumpCFGGZ::write_header(bigint n)
 
   char str[64];
   sprintf(str,"Number of particles = %s\n",BIGINT_FORMAT);
-  gzprintf(gzFp,str,n);
-  gzprintf(gzFp,"A = %g Angstrom (basic length-scale)\n",scale);
-  gzprintf(gzFp,"H0(1,1) = %g A\n",domain->xprd);
-  gzprintf(gzFp,"H0(1,2) = 0 A \n");
-  gzprintf(gzFp,"H0(1,3) = 0 A \n");
-  gzprintf(gzFp,"H0(2,1) = %g A \n",domain->xy);
-  gzprintf(gzFp,"H0(2,2) = %g A\n",domain->yprd);
-  gzprintf(gzFp,"H0(2,3) = 0 A \n");
-  gzprintf(gzFp,"H0(3,1) = %g A \n",domain->xz);
-  gzprintf(gzFp,"H0(3,2) = %g A \n",domain->yz);
-  gzprintf(gzFp,"H0(3,3) = %g A\n",domain->zprd);
-  gzprintf(gzFp,".NO_VELOCITY.\n");
-  gzprintf(gzFp,"entry_count = %d\n",nfield-2);
+  gzframe->print(str,n);
+  gzframe->print("A = %g Angstrom (basic length-scale)\n",scale);
+  gzframe->print("H0(1,1) = %g A\n",domain->xprd);
+  gzframe->print("H0(1,2) = 0 A \n");
+  gzframe->print("H0(1,3) = 0 A \n");
+  gzframe->print("H0(2,1) = %g A \n",domain->xy);
+  gzframe->print("H0(2,2) = %g A\n",domain->yprd);
+  gzframe->print("H0(2,3) = 0 A \n");
+  gzframe->print("H0(3,1) = %g A \n",domain->xz);
+  gzframe->print("H0(3,2) = %g A \n",domain->yz);
+  gzframe->print("H0(3,3) = %g A\n",domain->zprd);
+  gzframe->print(".NO_VELOCITY.\n");
+  gzframe->print("entry_count = %d\n",nfield-2);
   for (int i = 0; i < nfield-5; i++)
-    gzprintf(gzFp,"auxiliary[%d] = %s\n",i,auxname[i]);
+    gzframe->print("auxiliary[%d] = %s\n",i,auxname[i]);
+  gzframe->write_text(gzFp);
+}
+
+/* ----------------------------------------------------------------------
+   convert mybuf to text, then compress it as gzip member(s) in sbuf
+   the filewriter concatenates members from all procs in its cluster
+------------------------------------------------------------------------- */
+
+int DumpCFGGZ::convert_string(int n, double *mybuf)
+{
+  int nchars = DumpCFG::convert_string(n,mybuf);
+  if (nchars <= 0) return nchars;
+
+  int nbytes = gzframe->compress(sbuf,nchars);
+  if (nbytes < 0) return -1;
+  if (nbytes > maxsbuf) {
+    maxsbuf = nbytes;
+    memory->grow(sbuf,maxsbuf,"dump:sbuf");
+  }
+  memcpy(sbuf,gzframe->zbuf,nbytes);
+  return nbytes;
 }
 
 /* ---------------------------------------------------------------------- */
 
 void DumpCFGGZ::write_data(int n, double *mybuf)
 {
-  gzwrite(gzFp,mybuf,sizeof(char)*n);
+  fwrite(mybuf,sizeof(char),n,gzFp);
+}
+
+/* ----------------------------------------------------------------------
+   current offset is always a gzip member boundary
+------------------------------------------------------------------------- */
+
+bigint DumpCFGGZ::file_offset()
+{
+  if (gzFp == NULL) return -1;
+  return ftell(gzFp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -142,11 +178,11 @@ void DumpCFGGZ::write()
   DumpCFG::write();
   if (filewriter) {
     if (multifile) {
-      gzclose(gzFp);
+      fclose(gzFp);
       gzFp = NULL;
     } else {
       if (flush_flag)
-        gzflush(gzFp,Z_SYNC_FLUSH);
+        fflush(gzFp);
     }
   }
 }
@@ -14,6 +14,8 @@
 #include "dump_xyz_gz.h"
 #include "domain.h"
 #include "error.h"
+#include "gz_frame.h"
+#include "memory.h"
 #include "update.h"
 
 #include <string.h>
@@ -24,6 +26,8 @@ DumpXYZGZ::DumpXYZGZ(LAMMPS *lmp, int narg, char **arg) :
   DumpXYZ(lmp, narg, arg)
 {
   gzFp = NULL;
+  gzframe = new GzFrame(lmp,9);
+  async_allow = 0;
 
   if (!compressed)
     error->all(FLERR,"Dump xyz/gz only writes compressed files");
@@ -34,7 +38,8 @@ DumpXYZGZ::DumpXYZGZ(LAMMPS *lmp, int narg, char **arg) :
 
 DumpXYZGZ::~DumpXYZGZ()
 {
-  if (gzFp) gzclose(gzFp);
+  if (gzFp) fclose(gzFp);
+  delete gzframe;
   gzFp = NULL;
   fp = NULL;
 }
@@ -79,9 +84,9 @@ void DumpXYZGZ::openfile()
 
   if (filewriter) {
     if (append_flag) {
-      gzFp = gzopen(filecurrent,"ab9");
+      gzFp = fopen(filecurrent,"ab");
     } else {
-      gzFp = gzopen(filecurrent,"wb9");
+      gzFp = fopen(filecurrent,"wb");
     }
 
     if (gzFp == NULL) error->one(FLERR,"Cannot open dump file");
@@ -95,16 +100,47 @@ void DumpXYZGZ::openfile()
 void DumpXYZGZ::write_header(bigint ndump)
 {
   if (me == 0) {
-    gzprintf(gzFp,BIGINT_FORMAT "\n",ndump);
-    gzprintf(gzFp,"Atoms. Timestep: " BIGINT_FORMAT "\n",update->ntimestep);
+    gzframe->print(BIGINT_FORMAT "\n",ndump);
+    gzframe->print("Atoms. Timestep: " BIGINT_FORMAT "\n",update->ntimestep);
+    gzframe->write_text(gzFp);
   }
 }
 
+/* ----------------------------------------------------------------------
+   convert mybuf to text, then compress it as gzip member(s) in sbuf
+   the filewriter concatenates members from all procs in its cluster
+------------------------------------------------------------------------- */
+
+int DumpXYZGZ::convert_string(int n, double *mybuf)
+{
+  int nchars = DumpXYZ::convert_string(n,mybuf);
+  if (nchars <= 0) return nchars;
+
+  int nbytes = gzframe->compress(sbuf,nchars);
+  if (nbytes < 0) return -1;
+  if (nbytes > maxsbuf) {
+    maxsbuf = nbytes;
+    memory->grow(sbuf,maxsbuf,"dump:sbuf");
+  }
+  memcpy(sbuf,gzframe->zbuf,nbytes);
+  return nbytes;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void DumpXYZGZ::write_data(int n, double *mybuf)
 {
-  gzwrite(gzFp,mybuf,sizeof(char)*n);
+  fwrite(mybuf,sizeof(char),n,gzFp);
+}
+
+/* ----------------------------------------------------------------------
+   current offset is always a gzip member boundary
+------------------------------------------------------------------------- */
+
+bigint DumpXYZGZ::file_offset()
+{
+  if (gzFp == NULL) return -1;
+  return ftell(gzFp);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -114,11 +150,11 @@ void DumpXYZGZ::write()
   DumpXYZ::write();
   if (filewriter) {
     if (multifile) {
-      gzclose(gzFp);
+      fclose(gzFp);
       gzFp = NULL;
     } else {
       if (flush_flag)
-        gzflush(gzFp,Z_SYNC_FLUSH);
+        fflush(gzFp);
     }
   }
 }
@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <zlib.h>
+#include "gz_frame.h"
+#include "comm.h"
+#include "memory.h"
+#include "error.h"
+
+#if defined(__GLIBC__) || defined(__APPLE__) || defined(__FreeBSD__)
+#define GZ_STREAM_READ
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+#define GZMINCHUNK 262144    // min # of chars compressed by one thread
+#define GZOVERHEAD 32        // gzip header and trailer bytes per member
+#define GZBUFSIZE 131072     // size of zlib input buffer for reading
+#define MAXLINE 1024
+
+#ifdef GZ_STREAM_READ
+
+// stdio callbacks for reading a gzip stream through a FILE pointer
+
+#if defined(__GLIBC__)
+static ssize_t gz_stream_read(void *cookie, char *buf, size_t size)
+#else
+static int gz_stream_read(void *cookie, char *buf, int size)
+#endif
+{
+  unsigned int n = (size > (1 << 30)) ? (1 << 30) : size;
+  return gzread((gzFile) cookie,buf,n);
+}
+
+static int gz_stream_close(void *cookie)
+{
+  return (gzclose((gzFile) cookie) == Z_OK) ? 0 : EOF;
+}
+
+#endif
+
+/* ---------------------------------------------------------------------- */
+
+GzFrame::GzFrame(LAMMPS *lmp, int zlevel) : Pointers(lmp)
+{
+  level = zlevel;
+  zbuf = NULL;
+  maxzbuf = 0;
+  text = NULL;
+  ntext = maxtext = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+GzFrame::~GzFrame()
+{
+  memory->destroy(zbuf);
+  memory->destroy(text);
+}
+
+/* ----------------------------------------------------------------------
+   compress N chars of str into zbuf as one or more gzip members
+   each member is an independent gzip stream, so that the concatenation
+     of members written by many procs is itself a valid gzip file
+   with OpenMP, disjoint ranges of str are compressed by different threads
+   return # of compressed bytes, -1 if it exceeds an int
+------------------------------------------------------------------------- */
+
+int GzFrame::compress(const char *str, int n)
+{
+  int nthreads = comm->nthreads;
+  if (nthreads > n/GZMINCHUNK) nthreads = MAX(1,n/GZMINCHUNK);
+
+  bigint *offset = new bigint[nthreads+1];
+  bigint *nbytes = new bigint[nthreads];
+
+  offset[0] = 0;
+  for (int t = 0; t < nthreads; t++) {
+    int ifrom = static_cast<int> ((bigint) n * t / nthreads);
+    int ito = static_cast<int> ((bigint) n * (t+1) / nthreads);
+    offset[t+1] = offset[t] + compressBound(ito-ifrom) + GZOVERHEAD;
+  }
+
+  if (offset[nthreads] > MAXSMALLINT) {
+    delete [] offset;
+    delete [] nbytes;
+    return -1;
+  }
+  if (offset[nthreads] > maxzbuf) {
+    maxzbuf = offset[nthreads];
+    memory->grow(zbuf,maxzbuf,"gzframe:zbuf");
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(nthreads) schedule(static,1)
+#endif
+  for (int t = 0; t < nthreads; t++) {
+    int ifrom = static_cast<int> ((bigint) n * t / nthreads);
+    int ito = static_cast<int> ((bigint) n * (t+1) / nthreads);
+
+    z_stream zs;
+    memset(&zs,0,sizeof(z_stream));
+    nbytes[t] = -1;
+    if (deflateInit2(&zs,level,Z_DEFLATED,MAX_WBITS+16,8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) continue;
+    zs.next_in = (Bytef *) &str[ifrom];
+    zs.avail_in = ito - ifrom;
+    zs.next_out = (Bytef *) &zbuf[offset[t]];
+    zs.avail_out = offset[t+1] - offset[t];
+    if (deflate(&zs,Z_FINISH) == Z_STREAM_END) nbytes[t] = zs.total_out;
+    deflateEnd(&zs);
+  }
+
+  // compact members to be contiguous in zbuf
+
+  bigint total = 0;
+  for (int t = 0; t < nthreads; t++) {
+    if (nbytes[t] < 0) error->one(FLERR,"Failure to compress dump data");
+    memmove(&zbuf[total],&zbuf[offset[t]],nbytes[t]);
+    total += nbytes[t];
+  }
+
+  delete [] offset;
+  delete [] nbytes;
+  return static_cast<int> (total);
+}
+
+/* ----------------------------------------------------------------------
+   append formatted text to be compressed by next write_text()
+------------------------------------------------------------------------- */
+
+void GzFrame::print(const char *format, ...)
+{
+  if (ntext + MAXLINE > maxtext) {
+    maxtext = ntext + MAXLINE;
+    memory->grow(text,maxtext,"gzframe:text");
+  }
+
+  va_list args;
+  va_start(args,format);
+  int n = vsnprintf(&text[ntext],maxtext-ntext,format,args);
+  va_end(args);
+
+  if (ntext + n >= maxtext) {
+    maxtext = ntext + n + 1;
+    memory->grow(text,maxtext,"gzframe:text");
+    va_start(args,format);
+    vsnprintf(&text[ntext],maxtext-ntext,format,args);
+    va_end(args);
+  }
+  ntext += n;
+}
+
+/* ----------------------------------------------------------------------
+   compress text accumulated by print() as its own gzip member
+   write it to fp and reset text
+   return # of bytes written
+------------------------------------------------------------------------- */
+
+int GzFrame::write_text(FILE *fp)
+{
+  int nbytes = compress(text,ntext);
+  fwrite(zbuf,sizeof(char),nbytes,fp);
+  ntext = 0;
+  return nbytes;
+}
+
+/* ----------------------------------------------------------------------
+   open gzipped file for reading via in-process decompression
+   reading starts at byte offset, which must be the start of a gzip member
+   returned FILE pointer is used with stdio calls and closed by fclose()
+   return NULL if file cannot be opened or platform has no stdio callbacks
+------------------------------------------------------------------------- */
+
+FILE *GzFrame::open_read(const char *file, bigint offset)
+{
+#ifdef GZ_STREAM_READ
+  int fd = open(file,O_RDONLY);
+  if (fd < 0) return NULL;
+  if (offset && lseek(fd,offset,SEEK_SET) != offset) {
+    close(fd);
+    return NULL;
+  }
+
+  gzFile gz = gzdopen(fd,"rb");
+  if (gz == NULL) {
+    close(fd);
+    return NULL;
+  }
+  gzbuffer(gz,GZBUFSIZE);
+
+#if defined(__GLIBC__)
+  cookie_io_functions_t io = {gz_stream_read,NULL,NULL,gz_stream_close};
+  FILE *fp = fopencookie(gz,"r",io);
+#else
+  FILE *fp = funopen(gz,gz_stream_read,NULL,NULL,gz_stream_close);
+#endif
+
+  if (fp == NULL) gzclose(gz);
+  return fp;
+#else
+  return NULL;
+#endif
+}
@@ -0,0 +1,51 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_GZ_FRAME_H
+#define LMP_GZ_FRAME_H
+
+#include <stdio.h>
+#include "pointers.h"
+
+namespace LAMMPS_NS {
+
+class GzFrame : protected Pointers {
+ public:
+  char *zbuf;                // compressed bytes from last compress()
+
+  GzFrame(class LAMMPS *, int);
+  ~GzFrame();
+  int compress(const char *, int);
+  void print(const char *, ...);
+  int write_text(FILE *);
+  static FILE *open_read(const char *, bigint);
+
+ private:
+  int level;                 // zlib compression level
+  bigint maxzbuf;            // allocated size of zbuf
+  char *text;                // text accumulated by print()
+  int ntext,maxtext;         // current and allocated size of text
+};
+
+}
+
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Failure to compress dump data
+
+The zlib library returned an error while compressing a chunk of
+dump output.
+
+*/
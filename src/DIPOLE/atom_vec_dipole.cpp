@@ -807,6 +807,45 @@ void AtomVecDipole::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecDipole::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  q[nlocal] = values[2];
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  mu[nlocal][0] = values[6];
+  mu[nlocal][1] = values[7];
+  mu[nlocal][2] = values[8];
+  mu[nlocal][3] = sqrt(mu[nlocal][0]*mu[nlocal][0] +
+                       mu[nlocal][1]*mu[nlocal][1] +
+                       mu[nlocal][2]*mu[nlocal][2]);
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -824,6 +863,23 @@ int AtomVecDipole::data_atom_hybrid(int nlocal, char **values)
   return 4;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecDipole::data_atom_hybrid(int nlocal, double *values)
+{
+  q[nlocal] = values[0];
+  mu[nlocal][0] = values[1];
+  mu[nlocal][1] = values[2];
+  mu[nlocal][2] = values[3];
+  mu[nlocal][3] = sqrt(mu[nlocal][0]*mu[nlocal][0] +
+                       mu[nlocal][1]*mu[nlocal][1] +
+                       mu[nlocal][2]*mu[nlocal][2]);
+  return 4;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
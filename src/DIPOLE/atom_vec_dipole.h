@@ -51,7 +51,9 @@ class AtomVecDipole : public AtomVec {
   int unpack_restart(double *);
   void create_atom(int, double *);
   void data_atom(double *, imageint, char **);
+  void data_atom(double *, imageint, double *);
   int data_atom_hybrid(int, char **);
+  int data_atom_hybrid(int, double *);
   void pack_data(double **);
   int pack_data_hybrid(int, double *);
   void write_data(FILE *, int, double **);
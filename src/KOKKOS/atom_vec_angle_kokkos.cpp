@@ -1669,6 +1669,41 @@ void AtomVecAngleKokkos::data_atom(double *coord, imageint imagetmp,
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecAngleKokkos::data_atom(double *coord, imageint imagetmp,
+                                  double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+  atomKK->modified(Host,ALL_MASK);
+
+  h_tag(nlocal) = (tagint) ubuf(values[0]).i;
+  h_molecule(nlocal) = (tagint) ubuf(values[1]).i;
+  h_type(nlocal) = (int) ubuf(values[2]).i;
+  if (h_type(nlocal) <= 0 || h_type(nlocal) > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  h_x(nlocal,0) = coord[0];
+  h_x(nlocal,1) = coord[1];
+  h_x(nlocal,2) = coord[2];
+
+  h_image(nlocal) = imagetmp;
+
+  h_mask(nlocal) = 1;
+  h_v(nlocal,0) = 0.0;
+  h_v(nlocal,1) = 0.0;
+  h_v(nlocal,2) = 0.0;
+  h_num_bond(nlocal) = 0;
+  h_num_angle(nlocal) = 0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -1682,6 +1717,19 @@ int AtomVecAngleKokkos::data_atom_hybrid(int nlocal, char **values)
   return 1;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecAngleKokkos::data_atom_hybrid(int nlocal, double *values)
+{
+  h_molecule(nlocal) = (tagint) ubuf(values[0]).i;
+  h_num_bond(nlocal) = 0;
+  h_num_angle(nlocal) = 0;
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -1690,15 +1738,15 @@ void AtomVecAngleKokkos::pack_data(double **buf)
 {
   int nlocal = atom->nlocal;
   for (int i = 0; i < nlocal; i++) {
-    buf[i][0] = h_tag(i);
-    buf[i][1] = h_molecule(i);
-    buf[i][2] = h_type(i);
+    buf[i][0] = ubuf(h_tag(i)).d;
+    buf[i][1] = ubuf(h_molecule(i)).d;
+    buf[i][2] = ubuf(h_type(i)).d;
     buf[i][3] = h_x(i,0);
     buf[i][4] = h_x(i,1);
     buf[i][5] = h_x(i,2);
-    buf[i][6] = (h_image[i] & IMGMASK) - IMGMAX;
-    buf[i][7] = (h_image[i] >> IMGBITS & IMGMASK) - IMGMAX;
-    buf[i][8] = (h_image[i] >> IMG2BITS) - IMGMAX;
+    buf[i][6] = ubuf((h_image[i] & IMGMASK) - IMGMAX).d;
+    buf[i][7] = ubuf((h_image[i] >> IMGBITS & IMGMASK) - IMGMAX).d;
+    buf[i][8] = ubuf((h_image[i] >> IMG2BITS) - IMGMAX).d;
   }
 }
 
@@ -1708,7 +1756,7 @@ void AtomVecAngleKokkos::pack_data(double **buf)
 
 int AtomVecAngleKokkos::pack_data_hybrid(int i, double *buf)
 {
-  buf[0] = h_molecule(i);
+  buf[0] = ubuf(h_molecule(i)).d;
   return 1;
 }
 
@@ -1719,10 +1767,13 @@ int AtomVecAngleKokkos::pack_data_hybrid(int i, double *buf)
 void AtomVecAngleKokkos::write_data(FILE *fp, int n, double **buf)
 {
   for (int i = 0; i < n; i++)
-    fprintf(fp,"%d %d %d %-1.16e %-1.16e %-1.16e %d %d %d\n",
-            (int) buf[i][0],(int) buf[i][1], (int) buf[i][2],
-	    buf[i][3],buf[i][4],buf[i][5],
-            (int) buf[i][6],(int) buf[i][7],(int) buf[i][8]);
+    fprintf(fp,TAGINT_FORMAT " " TAGINT_FORMAT
+            " %d %-1.16e %-1.16e %-1.16e %d %d %d\n",
+            (tagint) ubuf(buf[i][0]).i,(tagint) ubuf(buf[i][1]).i,
+            (int) ubuf(buf[i][2]).i,
+            buf[i][3],buf[i][4],buf[i][5],
+            (int) ubuf(buf[i][6]).i,(int) ubuf(buf[i][7]).i,
+            (int) ubuf(buf[i][8]).i);
 }
 
 /* ----------------------------------------------------------------------
@@ -1731,7 +1782,7 @@ void AtomVecAngleKokkos::write_data(FILE *fp, int n, double **buf)
 
 int AtomVecAngleKokkos::write_data_hybrid(FILE *fp, double *buf)
 {
-  fprintf(fp," " TAGINT_FORMAT, (tagint) (buf[0]));
+  fprintf(fp," " TAGINT_FORMAT,(tagint) ubuf(buf[0]).i);
   return 1;
 }
 
@@ -1303,6 +1303,39 @@ void AtomVecAtomicKokkos::data_atom(double *coord, tagint imagetmp,
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecAtomicKokkos::data_atom(double *coord, imageint imagetmp,
+                                    double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  h_tag[nlocal] = (tagint) ubuf(values[0]).i;
+  h_type[nlocal] = (int) ubuf(values[1]).i;
+  if (h_type[nlocal] <= 0 || h_type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  h_x(nlocal,0) = coord[0];
+  h_x(nlocal,1) = coord[1];
+  h_x(nlocal,2) = coord[2];
+
+  h_image[nlocal] = imagetmp;
+
+  h_mask[nlocal] = 1;
+  h_v(nlocal,0) = 0.0;
+  h_v(nlocal,1) = 0.0;
+  h_v(nlocal,2) = 0.0;
+
+  atomKK->modified(Host,ALL_MASK);
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -1311,14 +1344,14 @@ void AtomVecAtomicKokkos::pack_data(double **buf)
 {
   int nlocal = atom->nlocal;
   for (int i = 0; i < nlocal; i++) {
-    buf[i][0] = h_tag[i];
-    buf[i][1] = h_type[i];
+    buf[i][0] = ubuf(h_tag[i]).d;
+    buf[i][1] = ubuf(h_type[i]).d;
     buf[i][2] = h_x(i,0);
     buf[i][3] = h_x(i,1);
     buf[i][4] = h_x(i,2);
-    buf[i][5] = (h_image[i] & IMGMASK) - IMGMAX;
-    buf[i][6] = (h_image[i] >> IMGBITS & IMGMASK) - IMGMAX;
-    buf[i][7] = (h_image[i] >> IMG2BITS) - IMGMAX;
+    buf[i][5] = ubuf((h_image[i] & IMGMASK) - IMGMAX).d;
+    buf[i][6] = ubuf((h_image[i] >> IMGBITS & IMGMASK) - IMGMAX).d;
+    buf[i][7] = ubuf((h_image[i] >> IMG2BITS) - IMGMAX).d;
   }
 }
 
@@ -1329,9 +1362,11 @@ void AtomVecAtomicKokkos::pack_data(double **buf)
 void AtomVecAtomicKokkos::write_data(FILE *fp, int n, double **buf)
 {
   for (int i = 0; i < n; i++)
-    fprintf(fp,"%d %d %-1.16e %-1.16e %-1.16e %d %d %d\n",
-            (int) buf[i][0],(int) buf[i][1],buf[i][2],buf[i][3],buf[i][4],
-            (int) buf[i][5],(int) buf[i][6],(int) buf[i][7]);
+    fprintf(fp,TAGINT_FORMAT " %d %-1.16e %-1.16e %-1.16e %d %d %d\n",
+            (tagint) ubuf(buf[i][0]).i,(int) ubuf(buf[i][1]).i,
+            buf[i][2],buf[i][3],buf[i][4],
+            (int) ubuf(buf[i][5]).i,(int) ubuf(buf[i][6]).i,
+            (int) ubuf(buf[i][7]).i);
 }
 
 /* ----------------------------------------------------------------------
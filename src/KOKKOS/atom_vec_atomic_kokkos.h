@@ -48,6 +48,7 @@ class AtomVecAtomicKokkos : public AtomVecKokkos {
   int unpack_restart(double *);
   void create_atom(int, double *);
   void data_atom(double *, tagint, char **);
+  void data_atom(double *, imageint, double *);
   void pack_data(double **);
   void write_data(FILE *, int, double **);
   bigint memory_usage();
@@ -49,7 +49,9 @@ class AtomVecFullKokkos : public AtomVecKokkos {
   int unpack_restart(double *);
   void create_atom(int, double *);
   void data_atom(double *, tagint, char **);
+  void data_atom(double *, imageint, double *);
   int data_atom_hybrid(int, char **);
+  int data_atom_hybrid(int, double *);
   void pack_data(double **);
   int pack_data_hybrid(int, double *);
   void write_data(FILE *, int, double **);
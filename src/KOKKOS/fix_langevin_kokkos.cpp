@@ -178,7 +178,7 @@ void FixLangevinKokkos<DeviceType>::post_force(int vflag)
   // account for bias velocity
   if(tbiasflag == BIAS){
     atomKK->sync(temperature->execution_space,temperature->datamask_read);
-    temperature->compute_scalar();
+    temperature->invoke_scalar();
     temperature->remove_bias_all(); // modifies velocities
     // if temeprature compute is kokkosized host-devcie comm won't be needed
     atomKK->modified(temperature->execution_space,temperature->datamask_modify);
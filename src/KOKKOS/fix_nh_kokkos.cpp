@@ -107,7 +107,7 @@ void FixNHKokkos<DeviceType>::setup(int vflag)
     if (t0 == 0.0) {
       atomKK->sync(temperature->execution_space,temperature->datamask_read);
       atomKK->modified(temperature->execution_space,temperature->datamask_modify);
-      t0 = temperature->compute_scalar();
+      t0 = temperature->invoke_scalar();
       if (t0 == 0.0) {
         if (strcmp(update->unit_style,"lj") == 0) t0 = 1.0;
         else t0 = 300.0;
@@ -120,14 +120,14 @@ void FixNHKokkos<DeviceType>::setup(int vflag)
 
   atomKK->sync(temperature->execution_space,temperature->datamask_read);
   atomKK->modified(temperature->execution_space,temperature->datamask_modify);
-  t_current = temperature->compute_scalar();
+  t_current = temperature->invoke_scalar();
   tdof = temperature->dof;
 
   if (pstat_flag) {
     //atomKK->sync(pressure->execution_space,pressure->datamask_read);
     //atomKK->modified(pressure->execution_space,pressure->datamask_modify);
-    if (pstyle == ISO) pressure->compute_scalar();
-    else pressure->compute_vector();
+    if (pstyle == ISO) pressure->invoke_scalar();
+    else pressure->invoke_vector();
     couple();
     pressure->addstep(update->ntimestep+1);
   }
@@ -202,11 +202,11 @@ void FixNHKokkos<DeviceType>::initial_integrate(int vflag)
     //atomKK->sync(pressure->execution_space,pressure->datamask_read);
     //atomKK->modified(pressure->execution_space,pressure->datamask_modify);
     if (pstyle == ISO) {
-      temperature->compute_scalar();
-      pressure->compute_scalar();
+      temperature->invoke_scalar();
+      pressure->invoke_scalar();
     } else {
-      temperature->compute_vector();
-      pressure->compute_vector();
+      temperature->invoke_vector();
+      pressure->invoke_vector();
     }
     couple();
     pressure->addstep(update->ntimestep+1);
@@ -253,7 +253,7 @@ void FixNHKokkos<DeviceType>::final_integrate()
   if (which == BIAS && neighbor->ago == 0)
     atomKK->sync(temperature->execution_space,temperature->datamask_read);
     atomKK->modified(temperature->execution_space,temperature->datamask_modify);
-    t_current = temperature->compute_scalar();
+    t_current = temperature->invoke_scalar();
 
   if (pstat_flag) nh_v_press();
 
@@ -262,14 +262,14 @@ void FixNHKokkos<DeviceType>::final_integrate()
 
   atomKK->sync(temperature->execution_space,temperature->datamask_read);
   atomKK->modified(temperature->execution_space,temperature->datamask_modify);
-  t_current = temperature->compute_scalar();
+  t_current = temperature->invoke_scalar();
   tdof = temperature->dof;
 
   if (pstat_flag) {
     //atomKK->sync(pressure->execution_space,pressure->datamask_read);
     //atomKK->modified(pressure->execution_space,pressure->datamask_modify);
-    if (pstyle == ISO) pressure->compute_scalar();
-    else pressure->compute_vector();
+    if (pstyle == ISO) pressure->invoke_scalar();
+    else pressure->invoke_vector();
     couple();
     pressure->addstep(update->ntimestep+1);
   }
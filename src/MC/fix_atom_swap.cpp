@@ -524,7 +524,7 @@ double FixAtomSwap::energy_full()
   if (modify->n_end_of_step) modify->end_of_step();
 
   update->eflag_global = update->ntimestep;
-  double total_energy = c_pe->compute_scalar();
+  double total_energy = c_pe->invoke_scalar();
 
   return total_energy;
 }
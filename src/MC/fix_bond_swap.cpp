@@ -210,7 +210,7 @@ void FixBondSwap::post_integrate()
 
   // compute current temp for Boltzmann factor test
 
-  double t_current = temperature->compute_scalar();
+  double t_current = temperature->invoke_scalar();
 
   // local ptrs to atom arrays
 
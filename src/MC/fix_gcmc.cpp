@@ -2140,7 +2140,7 @@ double FixGCMC::energy_full()
   //   will contribute to total MC energy via pe->compute_scalar()
 
   update->eflag_global = update->ntimestep;
-  double total_energy = c_pe->compute_scalar();
+  double total_energy = c_pe->invoke_scalar();
 
   return total_energy;
 }
@@ -61,8 +61,8 @@ namespace LAMMPS_NS {
 class PairMEAM : public Pair {
  public:
   PairMEAM(class LAMMPS *);
-  ~PairMEAM();
-  void compute(int, int);
+  virtual ~PairMEAM();
+  virtual void compute(int, int);
   void settings(int, char **);
   void coeff(int, char **);
   void init_style();
@@ -73,9 +73,9 @@ class PairMEAM : public Pair {
   void unpack_forward_comm(int, int, double *);
   int pack_reverse_comm(int, int, double *);
   void unpack_reverse_comm(int, int *, double *);
-  double memory_usage();
+  virtual double memory_usage();
 
- private:
+ protected:
   double cutmax;                // max cutoff for all elements
   int nelements;                // # of unique elements
   char **elements;              // names of unique elements
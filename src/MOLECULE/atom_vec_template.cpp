@@ -772,6 +772,50 @@ void AtomVecTemplate::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecTemplate::data_atom(double *coord, imageint imagetmp,
+                                double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  if (tag[nlocal] <= 0)
+    error->one(FLERR,"Invalid atom ID in Atoms section of data file");
+
+  molecule[nlocal] = (tagint) ubuf(values[1]).i;
+  molindex[nlocal] = (int) ubuf(values[2]).i - 1;
+  molatom[nlocal] = (int) ubuf(values[3]).i - 1;
+
+  if (molindex[nlocal] < 0 || molindex[nlocal] >= nset)
+    error->one(FLERR,"Invalid template index in Atoms section of data file");
+  if (molatom[nlocal] < 0 ||
+      molatom[nlocal] >= onemols[molindex[nlocal]]->natoms)
+    error->one(FLERR,"Invalid template atom in Atoms section of data file");
+
+  type[nlocal] = (int) ubuf(values[4]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -785,6 +829,19 @@ int AtomVecTemplate::data_atom_hybrid(int nlocal, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecTemplate::data_atom_hybrid(int nlocal, double *values)
+{
+  molecule[nlocal] = (tagint) ubuf(values[0]).i;
+  molindex[nlocal] = (int) ubuf(values[1]).i - 1;
+  molatom[nlocal] = (int) ubuf(values[2]).i - 1;
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
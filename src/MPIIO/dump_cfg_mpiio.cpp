@@ -57,7 +57,10 @@ enum{INT,DOUBLE,STRING,BIGINT};   // same as in DumpCustom
 /* ---------------------------------------------------------------------- */
 
 DumpCFGMPIIO::DumpCFGMPIIO(LAMMPS *lmp, int narg, char **arg) :
-  DumpCFG(lmp, narg, arg) {}
+  DumpCFG(lmp, narg, arg)
+{
+  async_allow = 0;
+}
 
 /* ---------------------------------------------------------------------- */
 
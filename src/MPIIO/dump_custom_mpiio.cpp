@@ -59,7 +59,10 @@ enum{INT,DOUBLE,STRING,BIGINT};    // same as in DumpCustom
 /* ---------------------------------------------------------------------- */
 
 DumpCustomMPIIO::DumpCustomMPIIO(LAMMPS *lmp, int narg, char **arg) :
-  DumpCustom(lmp, narg, arg) {}
+  DumpCustom(lmp, narg, arg)
+{
+  async_allow = 0;
+}
 
 /* ---------------------------------------------------------------------- */
 
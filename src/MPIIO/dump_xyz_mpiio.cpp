@@ -59,7 +59,10 @@ enum{INT,DOUBLE,STRING};    // same as in DumpCFG
 /* ---------------------------------------------------------------------- */
 
 DumpXYZMPIIO::DumpXYZMPIIO(LAMMPS *lmp, int narg, char **arg) :
-  DumpXYZ(lmp, narg, arg) {}
+  DumpXYZ(lmp, narg, arg)
+{
+  async_allow = 0;
+}
 
 /* ---------------------------------------------------------------------- */
 
@@ -819,6 +819,45 @@ void AtomVecPeri::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecPeri::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  vfrac[nlocal] = values[2];
+  rmass[nlocal] = values[3];
+  if (rmass[nlocal] <= 0.0) error->one(FLERR,"Invalid mass value");
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+
+  s0[nlocal] = DBL_MAX;
+  x0[nlocal][0] = coord[0];
+  x0[nlocal][1] = coord[1];
+  x0[nlocal][2] = coord[2];
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -838,6 +877,25 @@ int AtomVecPeri::data_atom_hybrid(int nlocal, char **values)
   return 2;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecPeri::data_atom_hybrid(int nlocal, double *values)
+{
+  vfrac[nlocal] = values[0];
+  rmass[nlocal] = values[1];
+  if (rmass[nlocal] <= 0.0) error->one(FLERR,"Invalid mass value");
+
+  s0[nlocal] = DBL_MAX;
+  x0[nlocal][0] = x[nlocal][0];
+  x0[nlocal][1] = x[nlocal][1];
+  x0[nlocal][2] = x[nlocal][2];
+
+  return 2;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
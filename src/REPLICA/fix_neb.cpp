@@ -193,7 +193,7 @@ void FixNEB::min_post_force(int vflag)
   // vprev,vnext = PEs of adjacent replicas
   // only proc 0 in each replica communicates
 
-  vprev = vnext = veng = pe->compute_scalar();
+  vprev = vnext = veng = pe->invoke_scalar();
 
   if (ireplica < nreplica-1 && me == 0) 
     MPI_Send(&veng,1,MPI_DOUBLE,procnext,0,uworld);
@@ -296,7 +296,7 @@ void PRD::command(int narg, char **arg)
   update->integrate->setup();
 
   if (temp_flag == 0) {
-    if (universe->iworld == 0) temp_dephase = temperature->compute_scalar();
+    if (universe->iworld == 0) temp_dephase = temperature->invoke_scalar();
     MPI_Bcast(&temp_dephase,1,MPI_DOUBLE,universe->root_proc[0],
               universe->uworld);
   }
@@ -396,7 +396,7 @@ void PRD::command(int narg, char **arg)
     if (t_corr > 0) replicate(ireplica);
     if (temp_flag == 0) {
       if (ireplica == universe->iworld)
-        temp_dephase = temperature->compute_scalar();
+        temp_dephase = temperature->invoke_scalar();
       MPI_Bcast(&temp_dephase,1,MPI_DOUBLE,universe->root_proc[ireplica],
                       universe->uworld);
     }
@@ -513,7 +513,7 @@ void PRD::dephase()
       fix_event->store_state_quench();
       quench();
 
-      if (compute_event->compute_scalar() > 0.0) {
+      if (compute_event->invoke_scalar() > 0.0) {
         fix_event->restore_state_dephase();
         update->ntimestep -= t_dephase;
         log_event();
@@ -522,7 +522,7 @@ void PRD::dephase()
         done = 1;
       }
 
-      if (temp_flag == 0) temp_dephase = temperature->compute_scalar();
+      if (temp_flag == 0) temp_dephase = temperature->invoke_scalar();
     }
   }
 
@@ -624,7 +624,7 @@ int PRD::check_event(int replica_num)
   int worldflag,universeflag,scanflag,replicaflag,ireplica;
 
   worldflag = 0;
-  if (compute_event->compute_scalar() > 0.0) worldflag = 1;
+  if (compute_event->invoke_scalar() > 0.0) worldflag = 1;
   if (replica_num >= 0 && replica_num != universe->iworld) worldflag = 0;
 
   timer->barrier_start();
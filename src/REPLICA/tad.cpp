@@ -525,7 +525,7 @@ int TAD::check_event()
   int flag;
 
   flag = 0;
-  if (compute_event->compute_scalar() > 0.0) flag = 1;
+  if (compute_event->invoke_scalar() > 0.0) flag = 1;
 
   return flag;
 }
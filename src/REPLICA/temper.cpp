@@ -242,7 +242,7 @@ void Temper::command(int narg, char **arg)
     // compute PE
     // notify compute it will be called at next swap
 
-    pe = pe_compute->compute_scalar();
+    pe = pe_compute->invoke_scalar();
     pe_compute->addstep(update->ntimestep + nevery);
 
     // which = which of 2 kinds of swaps to do (0,1)
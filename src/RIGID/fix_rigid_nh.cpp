@@ -347,7 +347,7 @@ void FixRigidNH::setup(int vflag)
 
   if (tstat_flag) compute_temp_target();
   else if (pstat_flag) {
-    t0 = temperature->compute_scalar();
+    t0 = temperature->invoke_scalar();
     if (t0 == 0.0) {
       if (strcmp(update->unit_style,"lj") == 0) t0 = 1.0;
       else t0 = 300.0;
@@ -361,11 +361,11 @@ void FixRigidNH::setup(int vflag)
 
   if (pstat_flag) {
     if (pstyle == ISO) {
-      temperature->compute_scalar();
-      pressure->compute_scalar();
+      temperature->invoke_scalar();
+      pressure->invoke_scalar();
     } else {
-      temperature->compute_vector();
-      pressure->compute_vector();
+      temperature->invoke_vector();
+      pressure->invoke_vector();
     }
     couple();
     pressure->addstep(update->ntimestep+1);
@@ -768,18 +768,18 @@ void FixRigidNH::final_integrate()
   set_v();
 
   // compute current temperature
-  if (tcomputeflag) t_current = temperature->compute_scalar();
+  if (tcomputeflag) t_current = temperature->invoke_scalar();
 
   // compute current and target pressures
   // update epsilon dot using akin_t and akin_r
 
   if (pstat_flag) {
     if (pstyle == ISO) {
-      temperature->compute_scalar();
-      pressure->compute_scalar();
+      temperature->invoke_scalar();
+      pressure->invoke_scalar();
     } else {
-      temperature->compute_vector();
-      pressure->compute_vector();
+      temperature->invoke_vector();
+      pressure->invoke_vector();
     }
     couple();
     pressure->addstep(update->ntimestep+1);
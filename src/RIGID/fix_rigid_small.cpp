@@ -35,7 +35,6 @@
 #include "memory.h"
 #include "error.h"
 
-#include <map>
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -1456,8 +1455,8 @@ void FixRigidSmall::create_bodies()
   // value = index into per-body data structure
   // n = # of entries in hash
 
-  hash = new std::map<tagint,int>();
-  hash->clear();
+  hash = new MyHash();
+  hash->reserve(nlocal);
 
   // setup hash
   // key = body ID
@@ -1469,7 +1468,7 @@ void FixRigidSmall::create_bodies()
   n = 0;
   for (i = 0; i < nlocal; i++) {
     if (!(mask[i] & groupbit)) continue;
-    if (hash->find(molecule[i]) == hash->end()) (*hash)[molecule[i]] = n++;
+    if (hash->find(molecule[i]) < 0) hash->set(molecule[i],n++);
   }
 
   // bbox = bounding box of each rigid body my atoms are part of
@@ -1559,7 +1558,7 @@ void FixRigidSmall::create_bodies()
   for (i = 0; i < nlocal; i++) {
     bodytag[i] = 0;
     if (!(mask[i] & groupbit)) continue;
-    m = hash->find(molecule[i])->second;
+    m = hash->find(molecule[i]);
     bodytag[i] = idclose[m];
     rsqmax = MAX(rsqmax,rsqclose[m]);
   }
@@ -1611,7 +1610,7 @@ void FixRigidSmall::create_bodies()
 
 void FixRigidSmall::ring_bbox(int n, char *cbuf)
 {
-  std::map<tagint,int> *hash = frsptr->hash;
+  MyHash *hash = frsptr->hash;
   double **bbox = frsptr->bbox;
 
   double *buf = (double *) cbuf;
@@ -1623,8 +1622,8 @@ void FixRigidSmall::ring_bbox(int n, char *cbuf)
   int m = 0;
   for (int i = 0; i < ndatums; i++, m += 4) {
     imol = static_cast<int> (buf[m]);
-    if (hash->find(imol) != hash->end()) {
-      j = hash->find(imol)->second;
+    j = hash->find(imol);
+    if (j >= 0) {
       x = &buf[m+1];
       bbox[j][0] = MIN(bbox[j][0],x[0]);
       bbox[j][1] = MAX(bbox[j][1],x[0]);
@@ -1643,7 +1642,7 @@ void FixRigidSmall::ring_bbox(int n, char *cbuf)
 
 void FixRigidSmall::ring_nearest(int n, char *cbuf)
 {
-  std::map<tagint,int> *hash = frsptr->hash;
+  MyHash *hash = frsptr->hash;
   double **ctr = frsptr->ctr;
   tagint *idclose = frsptr->idclose;
   double *rsqclose = frsptr->rsqclose;
@@ -1659,8 +1658,8 @@ void FixRigidSmall::ring_nearest(int n, char *cbuf)
   int m = 0;
   for (int i = 0; i < ndatums; i++, m += 5) {
     imol = static_cast<int> (buf[m]);
-    if (hash->find(imol) != hash->end()) {
-      j = hash->find(imol)->second;
+    j = hash->find(imol);
+    if (j >= 0) {
       tag = (tagint) ubuf(buf[m+1]).i;
       x = &buf[m+2];
       delx = x[0] - ctr[j][0];
@@ -2371,9 +2370,10 @@ void FixRigidSmall::readfile(int which, double **array, int *inbody)
 
   int nlocal = atom->nlocal;
 
-  hash = new std::map<tagint,int>();
+  hash = new MyHash();
+  hash->reserve(nlocal);
   for (i = 0; i < nlocal; i++)
-    if (bodyown[i] >= 0) (*hash)[atom->molecule[i]] = bodyown[i];
+    if (bodyown[i] >= 0) hash->set(atom->molecule[i],bodyown[i]);
 
   // open file and read header
 
@@ -2432,11 +2432,11 @@ void FixRigidSmall::readfile(int which, double **array, int *inbody)
       id = ATOTAGINT(values[0]);
       if (id <= 0 || id > maxmol)
         error->all(FLERR,"Invalid rigid body ID in fix rigid/small file");
-      if (hash->find(id) == hash->end()) {
+      m = hash->find(id);
+      if (m < 0) {
         buf = next + 1;
         continue;
       }
-      m = (*hash)[id];
       inbody[m] = 1;
 
       if (which == 0) {
@@ -23,7 +23,7 @@ FixStyle(rigid/small,FixRigidSmall)
 #include "fix.h"
 
 // replace this later
-#include <map>
+#include "my_hash.h"
 
 namespace LAMMPS_NS {
 
@@ -180,7 +180,7 @@ class FixRigidSmall : public Fix {
 
   // class data used by ring communication callbacks
 
-  std::map<tagint,int> *hash;
+  MyHash *hash;
   double **bbox;
   double **ctr;
   tagint *idclose;
@@ -333,8 +333,8 @@ void FixMSST::setup(int vflag)
 {
   lagrangian_position = 0.0;
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   couple();
   velocity_sum = compute_vsum();
 
@@ -368,7 +368,7 @@ void FixMSST::setup(int vflag)
 
   }
 
-  temperature->compute_vector();
+  temperature->invoke_vector();
   double *ke_tensor = temperature->vector;
   double ke_temp = ke_tensor[0]+ke_tensor[1]+ke_tensor[2];
   if (ke_temp > 0.0 && tscale > 0.0 ) {
@@ -434,8 +434,8 @@ void FixMSST::initial_integrate(int vflag)
   sd = direction;
 
   // compute new pressure and volume.
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   couple();
   vol = compute_vol();
 
@@ -597,9 +597,9 @@ void FixMSST::final_integrate()
 
   // compute new pressure and volume.
 
-  temperature->compute_vector();
+  temperature->invoke_vector();
 
-  pressure->compute_vector();
+  pressure->invoke_vector();
   couple();
   velocity_sum = compute_vsum();
   vol = compute_vol();
@@ -790,8 +790,8 @@ double FixMSST::compute_scalar()
 {
   // compute new pressure and volume.
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   couple();
 
   double volume = compute_vol();
@@ -840,8 +840,8 @@ double FixMSST::compute_hugoniot()
 
   e = compute_etotal();
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   p = pressure->vector[direction];
 
   v = compute_vol();
@@ -863,8 +863,8 @@ double FixMSST::compute_rayleigh()
   double v, p;
   double drayleigh;
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   p = pressure->vector[direction];
 
   v = compute_vol();
@@ -902,9 +902,9 @@ double FixMSST::compute_lagrangian_position()
 double FixMSST::compute_etotal()
 {
   double epot,ekin,etot;
-  epot = pe->compute_scalar();
+  epot = pe->invoke_scalar();
   if (thermo_energy) epot -= compute_scalar();
-  ekin = temperature->compute_scalar();
+  ekin = temperature->invoke_scalar();
   ekin *= 0.5 * temperature->dof * force->boltz;
   etot = epot+ekin;
   return etot;
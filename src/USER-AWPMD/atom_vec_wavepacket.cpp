@@ -945,6 +945,49 @@ void AtomVecWavepacket::data_atom(double *coord, imageint imagetmp,
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecWavepacket::data_atom(double *coord, imageint imagetmp,
+                                  double *values)
+{
+  int nlocal = atom->nlocal;
+
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  q[nlocal] = values[2];
+  spin[nlocal] = (int) ubuf(values[3]).i;
+  eradius[nlocal] = values[4];
+  if (eradius[nlocal] < 0.0)
+    error->one(FLERR,"Invalid eradius in Atoms section of data file");
+
+  etag[nlocal] = (int) ubuf(values[5]).i;
+  cs[2*nlocal] = values[6];
+  cs[2*nlocal+1] = values[7];
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  ervel[nlocal] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -970,6 +1013,31 @@ int AtomVecWavepacket::data_atom_hybrid(int nlocal, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecWavepacket::data_atom_hybrid(int nlocal, double *values)
+{
+  q[nlocal] = values[0];
+  spin[nlocal] = (int) ubuf(values[1]).i;
+  eradius[nlocal] = values[2];
+  if (eradius[nlocal] < 0.0)
+    error->one(FLERR,"Invalid eradius in Atoms section of data file");
+
+  etag[nlocal] = (int) ubuf(values[3]).i;
+  cs[2*nlocal] = values[4];
+  cs[2*nlocal+1] = values[5];
+
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  ervel[nlocal] = 0.0;
+
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -982,6 +1050,18 @@ void AtomVecWavepacket::data_vel(int m, char **values)
   ervel[m] = atof(values[3]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecWavepacket::data_vel(int m, double *values)
+{
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+  ervel[m] = values[3];
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -992,6 +1072,16 @@ int AtomVecWavepacket::data_vel_hybrid(int m, char **values)
   return 1;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Velocities section
+------------------------------------------------------------------------- */
+
+int AtomVecWavepacket::data_vel_hybrid(int m, double *values)
+{
+  ervel[m] = values[0];
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -363,7 +363,7 @@ void FixSAEDVTK::invoke_vector(bigint ntimestep)
   Compute *compute = modify->compute[icompute];
 
   if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-    compute->compute_vector();
+    compute->invoke_vector();
     compute->invoked_flag |= INVOKED_VECTOR;
   }
 
@@ -841,6 +841,47 @@ void AtomVecDPD::data_atom(double *coord, tagint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecDPD::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  dpdTheta[nlocal] = values[2];
+  if (dpdTheta[nlocal] <= 0)
+    error->one(FLERR,"Internal temperature in Atoms section of date file must be > zero");
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+
+  rho[nlocal] = 0.0;
+  uCond[nlocal] = 0.0;
+  uMech[nlocal] = 0.0;
+  uChem[nlocal] = 0.0;
+  uCG[nlocal] = 0.0;
+  uCGnew[nlocal] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -853,6 +894,18 @@ int AtomVecDPD::data_atom_hybrid(int nlocal, char **values)
   return 1;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecDPD::data_atom_hybrid(int nlocal, double *values)
+{
+  dpdTheta[nlocal] = values[0];
+
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -824,6 +824,45 @@ void AtomVecElectron::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecElectron::data_atom(double *coord, imageint imagetmp,
+                                double *values)
+{
+  int nlocal = atom->nlocal;
+
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  q[nlocal] = values[2];
+  spin[nlocal] = (int) ubuf(values[3]).i;
+  if (spin[nlocal] == 3) atom->ecp_flag = 1;
+
+  eradius[nlocal] = values[4];
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  ervel[nlocal] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -845,6 +884,27 @@ int AtomVecElectron::data_atom_hybrid(int nlocal, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecElectron::data_atom_hybrid(int nlocal, double *values)
+{
+  q[nlocal] = values[0];
+  spin[nlocal] = (int) ubuf(values[1]).i;
+  eradius[nlocal] = values[2];
+  if (eradius[nlocal] < 0.0)
+    error->one(FLERR,"Invalid eradius in Atoms section of data file");
+
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  ervel[nlocal] = 0.0;
+
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -857,6 +917,18 @@ void AtomVecElectron::data_vel(int m, char **values)
   ervel[m] = atof(values[3]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecElectron::data_vel(int m, double *values)
+{
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+  ervel[m] = values[3];
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -867,6 +939,16 @@ int AtomVecElectron::data_vel_hybrid(int m, char **values)
   return 1;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Velocities section
+------------------------------------------------------------------------- */
+
+int AtomVecElectron::data_vel_hybrid(int m, double *values)
+{
+  ervel[m] = values[0];
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
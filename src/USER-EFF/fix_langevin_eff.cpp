@@ -185,7 +185,7 @@ void FixLangevinEff::post_force_no_tally()
       }
     }
   } else if (tbiasflag == BIAS) {
-    temperature->compute_scalar();
+    temperature->invoke_scalar();
     for (int i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
         if (tstyle == ATOM) tsqrt = sqrt(tforce[i]);
@@ -350,7 +350,7 @@ void FixLangevinEff::post_force_tally()
       }
     }
   } else if (tbiasflag == BIAS) {
-    temperature->compute_scalar();
+    temperature->invoke_scalar();
     for (int i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
         if (tstyle == ATOM) tsqrt = sqrt(tforce[i]);
@@ -110,7 +110,7 @@ void FixTempRescaleEff::init()
 
 void FixTempRescaleEff::end_of_step()
 {
-  double t_current = temperature->compute_scalar();
+  double t_current = temperature->invoke_scalar();
   if (t_current == 0.0)
     error->all(FLERR,"Computed temperature for fix temp/rescale/eff cannot be 0.0");
 
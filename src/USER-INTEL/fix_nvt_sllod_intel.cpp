@@ -101,7 +101,7 @@ void FixNVTSllodIntel::nh_v_temp()
   //   calculate temperature since some computes require temp
   //   computed on current nlocal atoms to remove bias
 
-  if (nondeformbias) temperature->compute_scalar();
+  if (nondeformbias) temperature->invoke_scalar();
 
   double **v = atom->v;
   int *mask = atom->mask;
@@ -233,7 +233,7 @@ void FixNVTManifoldRattle::setup(int vflag)
 {
   compute_temp_target();
 
-  t_current = temperature->compute_scalar();
+  t_current = temperature->invoke_scalar();
   tdof = temperature->dof;
 
   // Compute/set eta-masses:
@@ -252,7 +252,7 @@ void FixNVTManifoldRattle::setup(int vflag)
 void FixNVTManifoldRattle::compute_temp_target()
 {
 
-  t_current = temperature->compute_scalar();
+  t_current = temperature->invoke_scalar();
   tdof      = temperature->dof;
 
   double delta = update->ntimestep - update->beginstep;
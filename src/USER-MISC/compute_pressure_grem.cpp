@@ -78,7 +78,7 @@ double ComputePressureGrem::compute_scalar()
   double t;
   if (keflag) {
     if (temperature->invoked_scalar != update->ntimestep)
-      t = temperature->compute_scalar() / (*scale_grem);
+      t = temperature->invoke_scalar() / (*scale_grem);
     else t = temperature->scalar / (*scale_grem);
   }
 
@@ -123,7 +123,7 @@ void ComputePressureGrem::compute_vector()
   double ke_tensor[6];
   if (keflag) {
     if (temperature->invoked_vector != update->ntimestep)
-      temperature->compute_vector();
+      temperature->invoke_vector();
     for (int i = 0; i < 6; ++i)
       ke_tensor[i] = temperature->vector[i] / (*scale_grem);
   }
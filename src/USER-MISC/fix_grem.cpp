@@ -266,7 +266,7 @@ void FixGrem::post_force(int vflag)
   int nlocal = atom->nlocal;
 
   double tmpvolume = domain->xprd * domain->yprd * domain->zprd;
-  double tmppe = pe->compute_scalar();
+  double tmppe = pe->invoke_scalar();
   // potential energy
   double tmpenthalpy = tmppe+pressref*tmpvolume/(force->nktv2p);
 
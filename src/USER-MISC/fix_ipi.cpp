@@ -419,7 +419,7 @@ void FixIPI::final_integrate()
   pressconv=1/force->nktv2p*potconv*posconv3;
 
   // compute for potential energy
-  pot=modify->compute[modify->find_compute("thermo_pe")]->compute_scalar();
+  pot=modify->compute[modify->find_compute("thermo_pe")]->invoke_scalar();
   pot*=potconv;
 
   // probably useless check
@@ -445,7 +445,7 @@ void FixIPI::final_integrate()
 
   int press_id = modify->find_compute("IPI_PRESS");
   Compute* comp_p = modify->compute[press_id];
-  comp_p->compute_vector();
+  comp_p->invoke_vector();
   double myvol = domain->xprd*domain->yprd*domain->zprd/posconv3;
 
   vir[0] = comp_p->vector[0]*pressconv*myvol;
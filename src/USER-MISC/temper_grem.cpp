@@ -244,7 +244,7 @@ void TemperGrem::command(int narg, char **arg)
     // compute PE
     // notify compute it will be called at next swap
 
-    pe = pe_compute->compute_scalar();
+    pe = pe_compute->invoke_scalar();
     pe_compute->addstep(update->ntimestep + nevery);
 
 
@@ -94,6 +94,8 @@ const int THIS_IS_A_BIGINT   = -4;
 DumpNCMPIIO::DumpNCMPIIO(LAMMPS *lmp, int narg, char **arg) :
   DumpCustom(lmp, narg, arg)
 {
+  async_allow = 0;
+
   // arrays for data rearrangement
 
   sort_flag = 1;
@@ -622,11 +624,11 @@ void DumpNCMPIIO::write()
 
       if (perframe[i].type == THIS_IS_A_COMPUTE) {
         if (idim >= 0) {
-          modify->compute[j]->compute_vector();
+          modify->compute[j]->invoke_vector();
           data = modify->compute[j]->vector[idim];
         }
         else
-          data = modify->compute[j]->compute_scalar();
+          data = modify->compute[j]->invoke_scalar();
       }
       else if (perframe[i].type == THIS_IS_A_FIX) {
         if (idim >= 0) {
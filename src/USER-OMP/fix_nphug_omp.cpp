@@ -251,9 +251,9 @@ void FixNPHugOMP::compute_temp_target()
 double FixNPHugOMP::compute_etotal()
 {
   double epot,ekin,etot;
-  epot = pe->compute_scalar();
+  epot = pe->invoke_scalar();
   if (thermo_energy) epot -= compute_scalar();
-  ekin = temperature->compute_scalar();
+  ekin = temperature->invoke_scalar();
   ekin *= 0.5 * tdof * force->boltz;
   etot = epot+ekin;
   return etot;
@@ -281,14 +281,14 @@ double FixNPHugOMP::compute_hugoniot()
 
   e = compute_etotal();
 
-  temperature->compute_vector();
+  temperature->invoke_vector();
 
 
   if (uniaxial == 1) {
-    pressure->compute_vector();
+    pressure->invoke_vector();
     p = pressure->vector[idir];
   } else
-    p = pressure->compute_scalar();
+    p = pressure->invoke_scalar();
 
   v = compute_vol();
 
@@ -309,13 +309,13 @@ double FixNPHugOMP::compute_us()
   double v,p;
   double eps,us;
 
-  temperature->compute_vector();
+  temperature->invoke_vector();
 
   if (uniaxial == 1) {
-    pressure->compute_vector();
+    pressure->invoke_vector();
     p = pressure->vector[idir];
   } else
-    p = pressure->compute_scalar();
+    p = pressure->invoke_scalar();
 
   v = compute_vol();
 
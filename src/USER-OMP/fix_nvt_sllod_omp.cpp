@@ -112,7 +112,7 @@ void FixNVTSllodOMP::nh_v_temp()
   const int nlocal = (igroup == atom->firstgroup) ? atom->nfirst : atom->nlocal;
   int i;
 
-  if (nondeformbias) temperature->compute_scalar();
+  if (nondeformbias) temperature->invoke_scalar();
 
   double h_two[6];
   MathExtra::multiply_shape_shape(domain->h_rate,domain->h_inv,h_two);
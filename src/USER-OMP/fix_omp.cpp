@@ -99,6 +99,12 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) _neighbor = false;
       else error->all(FLERR,"Illegal package omp command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"mode") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal package omp command");
+      if (strcmp(arg[iarg+1],"double") == 0) _mixed = false;
+      else if (strcmp(arg[iarg+1],"mixed") == 0) _mixed = true;
+      else error->all(FLERR,"Illegal package omp command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal package omp command");
   }
 
@@ -107,17 +113,20 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
   if (comm->me == 0) {
 #if defined(_OPENMP)
     const char * const nmode = _neighbor ? "multi-threaded" : "serial";
+    const char * const kmode = _mixed ? "mixed" : "double";
 
     if (screen) {
       if (reset_thr)
 	fprintf(screen,"set %d OpenMP thread(s) per MPI task\n", nthreads);
       fprintf(screen,"using %s neighbor list subroutines\n", nmode);
+      fprintf(screen,"using %s precision pair kernels\n", kmode);
     }
 
     if (logfile) {
       if (reset_thr)
 	fprintf(logfile,"set %d OpenMP thread(s) per MPI task\n", nthreads);
       fprintf(logfile,"using %s neighbor list subroutines\n", nmode);
+      fprintf(logfile,"using %s precision pair kernels\n", kmode);
     }
 #else
     error->warning(FLERR,"OpenMP support not enabled during compilation; "
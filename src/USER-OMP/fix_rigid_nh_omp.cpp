@@ -492,18 +492,18 @@ void FixRigidNHOMP::final_integrate()
     set_v_thr<0,0>();
 
   // compute current temperature
-  if (tcomputeflag) t_current = temperature->compute_scalar();
+  if (tcomputeflag) t_current = temperature->invoke_scalar();
 
   // compute current and target pressures
   // update epsilon dot using akin_t and akin_r
 
   if (pstat_flag) {
     if (pstyle == ISO) {
-      temperature->compute_scalar();
-      pressure->compute_scalar();
+      temperature->invoke_scalar();
+      pressure->invoke_scalar();
     } else {
-      temperature->compute_vector();
-      pressure->compute_vector();
+      temperature->invoke_vector();
+      pressure->invoke_vector();
     }
     couple();
     pressure->addstep(update->ntimestep+1);
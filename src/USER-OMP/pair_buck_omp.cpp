@@ -55,30 +55,40 @@ void PairBuckOMP::compute(int eflag, int vflag)
     thr->timer(Timer::START);
     ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
 
-    if (evflag) {
-      if (eflag) {
-        if (force->newton_pair) eval<1,1,1>(ifrom, ito, thr);
-        else eval<1,1,0>(ifrom, ito, thr);
-      } else {
-        if (force->newton_pair) eval<1,0,1>(ifrom, ito, thr);
-        else eval<1,0,0>(ifrom, ito, thr);
-      }
-    } else {
-      if (force->newton_pair) eval<0,0,1>(ifrom, ito, thr);
-      else eval<0,0,0>(ifrom, ito, thr);
-    }
+    if (fix->get_mixed()) eval_thr<float>(eflag, ifrom, ito, thr);
+    else eval_thr<double>(eflag, ifrom, ito, thr);
 
     thr->timer(Timer::PAIR);
     reduce_thr(this, eflag, vflag, thr);
   } // end of omp parallel region
 }
 
-template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+template <typename flt_t>
+void PairBuckOMP::eval_thr(int eflag, int ifrom, int ito, ThrData * const thr)
+{
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1,flt_t>(ifrom, ito, thr);
+      else eval<1,1,0,flt_t>(ifrom, ito, thr);
+    } else {
+      if (force->newton_pair) eval<1,0,1,flt_t>(ifrom, ito, thr);
+      else eval<1,0,0,flt_t>(ifrom, ito, thr);
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1,flt_t>(ifrom, ito, thr);
+    else eval<0,0,0,flt_t>(ifrom, ito, thr);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR, typename flt_t>
 void PairBuckOMP::eval(int iifrom, int iito, ThrData * const thr)
 {
   int i,j,ii,jj,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
-  double rsq,r2inv,r6inv,r,rexp,forcebuck,factor_lj;
+  double xtmp,ytmp,ztmp;
+  flt_t delx,dely,delz,evdwl,fpair;
+  flt_t rsq,r2inv,r6inv,r,rexp,forcebuck,factor_lj;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   evdwl = 0.0;
@@ -118,15 +128,13 @@ void PairBuckOMP::eval(int iifrom, int iito, ThrData * const thr)
       rsq = delx*delx + dely*dely + delz*delz;
       jtype = type[j];
 
-      if (rsq < cutsq[itype][jtype]) {
-        r2inv = 1.0/rsq;
-        r6inv = r2inv*r2inv*r2inv;
-        r = sqrt(rsq);
-        r2inv = 1.0/rsq;
+      if (rsq < (flt_t) cutsq[itype][jtype]) {
+        r2inv = (flt_t) 1.0/rsq;
         r6inv = r2inv*r2inv*r2inv;
         r = sqrt(rsq);
-        rexp = exp(-r*rhoinv[itype][jtype]);
-        forcebuck = buck1[itype][jtype]*r*rexp - buck2[itype][jtype]*r6inv;
+        rexp = exp(-r*(flt_t) rhoinv[itype][jtype]);
+        forcebuck = (flt_t) buck1[itype][jtype]*r*rexp
+          - (flt_t) buck2[itype][jtype]*r6inv;
         fpair = factor_lj*forcebuck*r2inv;
 
         fxtmp += delx*fpair;
@@ -139,8 +147,8 @@ void PairBuckOMP::eval(int iifrom, int iito, ThrData * const thr)
         }
 
         if (EFLAG) {
-          evdwl = a[itype][jtype]*rexp - c[itype][jtype]*r6inv -
-            offset[itype][jtype];
+          evdwl = (flt_t) a[itype][jtype]*rexp - (flt_t) c[itype][jtype]*r6inv
+            - (flt_t) offset[itype][jtype];
           evdwl *= factor_lj;
         }
 
@@ -26,6 +26,21 @@
 #include "suffix.h"
 using namespace LAMMPS_NS;
 
+// evaluate a cubic spline segment and its derivative in precision flt_t
+
+template <typename flt_t>
+static inline flt_t spline_value(const double * const coeff, const flt_t p)
+{
+  return (((flt_t) coeff[3]*p + (flt_t) coeff[4])*p + (flt_t) coeff[5])*p
+    + (flt_t) coeff[6];
+}
+
+template <typename flt_t>
+static inline flt_t spline_deriv(const double * const coeff, const flt_t p)
+{
+  return ((flt_t) coeff[0]*p + (flt_t) coeff[1])*p + (flt_t) coeff[2];
+}
+
 /* ---------------------------------------------------------------------- */
 
 PairEAMOMP::PairEAMOMP(LAMMPS *lmp) :
@@ -74,30 +89,40 @@ void PairEAMOMP::compute(int eflag, int vflag)
     else
       thr->init_eam(atom->nlocal, rho);
 
-    if (evflag) {
-      if (eflag) {
-        if (force->newton_pair) eval<1,1,1>(ifrom, ito, thr);
-        else eval<1,1,0>(ifrom, ito, thr);
-      } else {
-        if (force->newton_pair) eval<1,0,1>(ifrom, ito, thr);
-        else eval<1,0,0>(ifrom, ito, thr);
-      }
-    } else {
-      if (force->newton_pair) eval<0,0,1>(ifrom, ito, thr);
-      else eval<0,0,0>(ifrom, ito, thr);
-    }
+    if (fix->get_mixed()) eval_thr<float>(eflag, ifrom, ito, thr);
+    else eval_thr<double>(eflag, ifrom, ito, thr);
 
     thr->timer(Timer::PAIR);
     reduce_thr(this, eflag, vflag, thr);
   } // end of omp parallel region
 }
 
-template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+template <typename flt_t>
+void PairEAMOMP::eval_thr(int eflag, int ifrom, int ito, ThrData * const thr)
+{
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1,flt_t>(ifrom, ito, thr);
+      else eval<1,1,0,flt_t>(ifrom, ito, thr);
+    } else {
+      if (force->newton_pair) eval<1,0,1,flt_t>(ifrom, ito, thr);
+      else eval<1,0,0,flt_t>(ifrom, ito, thr);
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1,flt_t>(ifrom, ito, thr);
+    else eval<0,0,0,flt_t>(ifrom, ito, thr);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR, typename flt_t>
 void PairEAMOMP::eval(int iifrom, int iito, ThrData * const thr)
 {
   int i,j,ii,jj,m,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
-  double rsq,r,p,rhoip,rhojp,z2,z2p,recip,phip,psip,phi;
+  double xtmp,ytmp,ztmp,p,phi;
+  flt_t delx,dely,delz,evdwl,fpair;
+  flt_t rsq,r,pr,rhoip,rhojp,z2,z2p,recip,phip,psip,phir;
   double *coeff;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
@@ -140,18 +165,18 @@ void PairEAMOMP::eval(int iifrom, int iito, ThrData * const thr)
       delz = ztmp - x[j].z;
       rsq = delx*delx + dely*dely + delz*delz;
 
-      if (rsq < cutforcesq) {
+      if (rsq < (flt_t) cutforcesq) {
         jtype = type[j];
-        p = sqrt(rsq)*rdr + 1.0;
-        m = static_cast<int> (p);
+        pr = sqrt(rsq)*(flt_t) rdr + (flt_t) 1.0;
+        m = static_cast<int> (pr);
         m = MIN(m,nr-1);
-        p -= m;
-        p = MIN(p,1.0);
+        pr -= m;
+        pr = MIN(pr,(flt_t) 1.0);
         coeff = rhor_spline[type2rhor[jtype][itype]][m];
-        rho_t[i] += ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
+        rho_t[i] += spline_value(coeff,pr);
         if (NEWTON_PAIR || j < nlocal) {
           coeff = rhor_spline[type2rhor[itype][jtype]][m];
-          rho_t[j] += ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
+          rho_t[j] += spline_value(coeff,pr);
         }
       }
     }
@@ -244,14 +269,14 @@ void PairEAMOMP::eval(int iifrom, int iito, ThrData * const thr)
       delz = ztmp - x[j].z;
       rsq = delx*delx + dely*dely + delz*delz;
 
-      if (rsq < cutforcesq) {
+      if (rsq < (flt_t) cutforcesq) {
         jtype = type[j];
         r = sqrt(rsq);
-        p = r*rdr + 1.0;
-        m = static_cast<int> (p);
+        pr = r*(flt_t) rdr + (flt_t) 1.0;
+        m = static_cast<int> (pr);
         m = MIN(m,nr-1);
-        p -= m;
-        p = MIN(p,1.0);
+        pr -= m;
+        pr = MIN(pr,(flt_t) 1.0);
 
         // rhoip = derivative of (density at atom j due to atom i)
         // rhojp = derivative of (density at atom i due to atom j)
@@ -264,18 +289,18 @@ void PairEAMOMP::eval(int iifrom, int iito, ThrData * const thr)
         //   hence embed' = Fi(sum rho_ij) rhojp + Fj(sum rho_ji) rhoip
 
         coeff = rhor_spline[type2rhor[itype][jtype]][m];
-        rhoip = (coeff[0]*p + coeff[1])*p + coeff[2];
+        rhoip = spline_deriv(coeff,pr);
         coeff = rhor_spline[type2rhor[jtype][itype]][m];
-        rhojp = (coeff[0]*p + coeff[1])*p + coeff[2];
+        rhojp = spline_deriv(coeff,pr);
         coeff = z2r_spline[type2z2r[itype][jtype]][m];
-        z2p = (coeff[0]*p + coeff[1])*p + coeff[2];
-        z2 = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
+        z2p = spline_deriv(coeff,pr);
+        z2 = spline_value(coeff,pr);
 
-        recip = 1.0/r;
-        phi = z2*recip;
-        phip = z2p*recip - phi*recip;
-        psip = fp[i]*rhojp + fp[j]*rhoip + phip;
-        fpair = -scale_i[jtype]*psip*recip;
+        recip = (flt_t) 1.0/r;
+        phir = z2*recip;
+        phip = z2p*recip - phir*recip;
+        psip = (flt_t) fp[i]*rhojp + (flt_t) fp[j]*rhoip + phip;
+        fpair = -(flt_t) scale_i[jtype]*psip*recip;
 
         fxtmp += delx*fpair;
         fytmp += dely*fpair;
@@ -286,7 +311,7 @@ void PairEAMOMP::eval(int iifrom, int iito, ThrData * const thr)
           f[j].z -= delz*fpair;
         }
 
-        if (EFLAG) evdwl = scale_i[jtype]*phi;
+        if (EFLAG) evdwl = (flt_t) scale_i[jtype]*phir;
         if (EVFLAG) ev_tally_thr(this, i,j,nlocal,NEWTON_PAIR,
                                  evdwl,0.0,fpair,delx,dely,delz,thr);
       }
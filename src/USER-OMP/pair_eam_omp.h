@@ -38,7 +38,9 @@ class PairEAMOMP : public PairEAM, public ThrOMP {
   virtual double memory_usage();
 
  private:
-  template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+  template <typename flt_t>
+  void eval_thr(int eflag, int iifrom, int iito, ThrData * const thr);
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR, typename flt_t>
   void eval(int iifrom, int iito, ThrData * const thr);
 };
 
@@ -64,18 +64,8 @@ void PairLJCutCoulLongOMP::compute(int eflag, int vflag)
     thr->timer(Timer::START);
     ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
 
-    if (evflag) {
-      if (eflag) {
-        if (force->newton_pair) eval<1,1,1>(ifrom, ito, thr);
-        else eval<1,1,0>(ifrom, ito, thr);
-      } else {
-        if (force->newton_pair) eval<1,0,1>(ifrom, ito, thr);
-        else eval<1,0,0>(ifrom, ito, thr);
-      }
-    } else {
-      if (force->newton_pair) eval<0,0,1>(ifrom, ito, thr);
-      else eval<0,0,0>(ifrom, ito, thr);
-    }
+    if (fix->get_mixed()) eval_thr<float>(eflag, ifrom, ito, thr);
+    else eval_thr<double>(eflag, ifrom, ito, thr);
 
     thr->timer(Timer::PAIR);
     reduce_thr(this, eflag, vflag, thr);
@@ -84,14 +74,34 @@ void PairLJCutCoulLongOMP::compute(int eflag, int vflag)
 
 /* ---------------------------------------------------------------------- */
 
-template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+template <typename flt_t>
+void PairLJCutCoulLongOMP::eval_thr(int eflag, int ifrom, int ito, ThrData * const thr)
+{
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1,flt_t>(ifrom, ito, thr);
+      else eval<1,1,0,flt_t>(ifrom, ito, thr);
+    } else {
+      if (force->newton_pair) eval<1,0,1,flt_t>(ifrom, ito, thr);
+      else eval<1,0,0,flt_t>(ifrom, ito, thr);
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1,flt_t>(ifrom, ito, thr);
+    else eval<0,0,0,flt_t>(ifrom, ito, thr);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR, typename flt_t>
 void PairLJCutCoulLongOMP::eval(int iifrom, int iito, ThrData * const thr)
 {
   int i,j,ii,jj,jnum,itype,jtype,itable;
-  double qtmp,xtmp,ytmp,ztmp,delx,dely,delz,evdwl,ecoul,fpair;
-  double fraction,table;
-  double r,rsq,r2inv,r6inv,forcecoul,forcelj,factor_coul,factor_lj;
-  double grij,expm2,prefactor,t,erfc;
+  double xtmp,ytmp,ztmp;
+  flt_t qtmp,delx,dely,delz,evdwl,ecoul,fpair;
+  flt_t fraction,table;
+  flt_t r,rsq,r2inv,r6inv,forcecoul,forcelj,factor_coul,factor_lj;
+  flt_t grij,expm2,prefactor,t,erfc;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   evdwl = ecoul = 0.0;
@@ -103,7 +113,10 @@ void PairLJCutCoulLongOMP::eval(int iifrom, int iito, ThrData * const thr)
   const int nlocal = atom->nlocal;
   const double * _noalias const special_coul = force->special_coul;
   const double * _noalias const special_lj = force->special_lj;
-  const double qqrd2e = force->qqrd2e;
+  const flt_t qqrd2e = force->qqrd2e;
+  const flt_t g_ewald_t = g_ewald;
+  const flt_t cut_coulsq_t = cut_coulsq;
+  const flt_t tabinnersq_t = tabinnersq;
   double fxtmp,fytmp,fztmp;
 
   ilist = list->ilist;
@@ -136,38 +149,42 @@ void PairLJCutCoulLongOMP::eval(int iifrom, int iito, ThrData * const thr)
       rsq = delx*delx + dely*dely + delz*delz;
       jtype = type[j];
 
-      if (rsq < cutsq[itype][jtype]) {
-        r2inv = 1.0/rsq;
+      if (rsq < (flt_t) cutsq[itype][jtype]) {
+        r2inv = (flt_t) 1.0/rsq;
 
-        if (rsq < cut_coulsq) {
-          if (!ncoultablebits || rsq <= tabinnersq) {
+        if (rsq < cut_coulsq_t) {
+          if (!ncoultablebits || rsq <= tabinnersq_t) {
             r = sqrt(rsq);
-            grij = g_ewald * r;
+            grij = g_ewald_t * r;
             expm2 = exp(-grij*grij);
-            t = 1.0 / (1.0 + EWALD_P*grij);
-            erfc = t * (A1+t*(A2+t*(A3+t*(A4+t*A5)))) * expm2;
-            prefactor = qqrd2e * qtmp*q[j]/r;
-            forcecoul = prefactor * (erfc + EWALD_F*grij*expm2);
-            if (factor_coul < 1.0) forcecoul -= (1.0-factor_coul)*prefactor;
+            t = (flt_t) 1.0 / ((flt_t) 1.0 + (flt_t) EWALD_P*grij);
+            erfc = t * ((flt_t) A1 + t*((flt_t) A2 + t*((flt_t) A3 +
+                   t*((flt_t) A4 + t*(flt_t) A5)))) * expm2;
+            prefactor = qqrd2e * qtmp*(flt_t) q[j]/r;
+            forcecoul = prefactor * (erfc + (flt_t) EWALD_F*grij*expm2);
+            if (factor_coul < (flt_t) 1.0)
+              forcecoul -= ((flt_t) 1.0-factor_coul)*prefactor;
           } else {
             union_int_float_t rsq_lookup;
             rsq_lookup.f = rsq;
             itable = rsq_lookup.i & ncoulmask;
             itable >>= ncoulshiftbits;
-            fraction = (rsq_lookup.f - rtable[itable]) * drtable[itable];
-            table = ftable[itable] + fraction*dftable[itable];
-            forcecoul = qtmp*q[j] * table;
-            if (factor_coul < 1.0) {
-              table = ctable[itable] + fraction*dctable[itable];
-              prefactor = qtmp*q[j] * table;
-              forcecoul -= (1.0-factor_coul)*prefactor;
+            fraction = (rsq_lookup.f - (flt_t) rtable[itable])
+              * (flt_t) drtable[itable];
+            table = (flt_t) ftable[itable] + fraction*(flt_t) dftable[itable];
+            forcecoul = qtmp*(flt_t) q[j] * table;
+            if (factor_coul < (flt_t) 1.0) {
+              table = (flt_t) ctable[itable] + fraction*(flt_t) dctable[itable];
+              prefactor = qtmp*(flt_t) q[j] * table;
+              forcecoul -= ((flt_t) 1.0-factor_coul)*prefactor;
             }
           }
         } else forcecoul = 0.0;
 
-        if (rsq < cut_ljsq[itype][jtype]) {
+        if (rsq < (flt_t) cut_ljsq[itype][jtype]) {
           r6inv = r2inv*r2inv*r2inv;
-          forcelj = r6inv * (lj1[itype][jtype]*r6inv - lj2[itype][jtype]);
+          forcelj = r6inv * ((flt_t) lj1[itype][jtype]*r6inv
+                             - (flt_t) lj2[itype][jtype]);
           forcelj *= factor_lj;
         } else forcelj = 0.0;
 
@@ -183,19 +200,21 @@ void PairLJCutCoulLongOMP::eval(int iifrom, int iito, ThrData * const thr)
         }
 
         if (EFLAG) {
-          if (rsq < cut_coulsq) {
-            if (!ncoultablebits || rsq <= tabinnersq)
+          if (rsq < cut_coulsq_t) {
+            if (!ncoultablebits || rsq <= tabinnersq_t)
               ecoul = prefactor*erfc;
             else {
-              table = etable[itable] + fraction*detable[itable];
-              ecoul = qtmp*q[j] * table;
+              table = (flt_t) etable[itable] + fraction*(flt_t) detable[itable];
+              ecoul = qtmp*(flt_t) q[j] * table;
             }
-            if (factor_coul < 1.0) ecoul -= (1.0-factor_coul)*prefactor;
+            if (factor_coul < (flt_t) 1.0)
+              ecoul -= ((flt_t) 1.0-factor_coul)*prefactor;
           } else ecoul = 0.0;
 
-          if (rsq < cut_ljsq[itype][jtype]) {
-            evdwl = r6inv*(lj3[itype][jtype]*r6inv-lj4[itype][jtype]) -
-              offset[itype][jtype];
+          if (rsq < (flt_t) cut_ljsq[itype][jtype]) {
+            evdwl = r6inv*((flt_t) lj3[itype][jtype]*r6inv
+                           - (flt_t) lj4[itype][jtype])
+              - (flt_t) offset[itype][jtype];
             evdwl *= factor_lj;
           } else evdwl = 0.0;
         }
@@ -56,24 +56,39 @@ void PairLJCutOMP::compute(int eflag, int vflag)
     thr->timer(Timer::START);
     ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
 
-    if (evflag) {
-      if (eflag) {
-        if (force->newton_pair) eval<1,1,1>(ifrom, ito, thr);
-        else eval<1,1,0>(ifrom, ito, thr);
-      } else {
-        if (force->newton_pair) eval<1,0,1>(ifrom, ito, thr);
-        else eval<1,0,0>(ifrom, ito, thr);
-      }
-    } else {
-      if (force->newton_pair) eval<0,0,1>(ifrom, ito, thr);
-      else eval<0,0,0>(ifrom, ito, thr);
-    }
+    if (fix->get_mixed()) eval_thr<float>(eflag, ifrom, ito, thr);
+    else eval_thr<double>(eflag, ifrom, ito, thr);
+
     thr->timer(Timer::PAIR);
     reduce_thr(this, eflag, vflag, thr);
   } // end of omp parallel region
 }
 
-template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+/* ----------------------------------------------------------------------
+   select the kernel for the requested energy/virial and newton settings
+   flt_t is the precision of the per-pair math, accumulation is in double
+------------------------------------------------------------------------- */
+
+template <typename flt_t>
+void PairLJCutOMP::eval_thr(int eflag, int ifrom, int ito, ThrData * const thr)
+{
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1,flt_t>(ifrom, ito, thr);
+      else eval<1,1,0,flt_t>(ifrom, ito, thr);
+    } else {
+      if (force->newton_pair) eval<1,0,1,flt_t>(ifrom, ito, thr);
+      else eval<1,0,0,flt_t>(ifrom, ito, thr);
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1,flt_t>(ifrom, ito, thr);
+    else eval<0,0,0,flt_t>(ifrom, ito, thr);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR, typename flt_t>
 void PairLJCutOMP::eval(int iifrom, int iito, ThrData * const thr)
 {
   const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
@@ -84,8 +99,8 @@ void PairLJCutOMP::eval(int iifrom, int iito, ThrData * const thr)
   const int * _noalias const numneigh = list->numneigh;
   const int * const * const firstneigh = list->firstneigh;
 
-  double xtmp,ytmp,ztmp,delx,dely,delz,fxtmp,fytmp,fztmp;
-  double rsq,r2inv,r6inv,forcelj,factor_lj,evdwl,fpair;
+  double xtmp,ytmp,ztmp,fxtmp,fytmp,fztmp;
+  flt_t delx,dely,delz,rsq,r2inv,r6inv,forcelj,factor_lj,evdwl,fpair;
 
   const int nlocal = atom->nlocal;
   int j,jj,jnum,jtype;
@@ -122,10 +137,10 @@ void PairLJCutOMP::eval(int iifrom, int iito, ThrData * const thr)
       rsq = delx*delx + dely*dely + delz*delz;
       jtype = type[j];
 
-      if (rsq < cutsqi[jtype]) {
-        r2inv = 1.0/rsq;
+      if (rsq < (flt_t) cutsqi[jtype]) {
+        r2inv = (flt_t) 1.0/rsq;
         r6inv = r2inv*r2inv*r2inv;
-        forcelj = r6inv * (lj1i[jtype]*r6inv - lj2i[jtype]);
+        forcelj = r6inv * ((flt_t) lj1i[jtype]*r6inv - (flt_t) lj2i[jtype]);
         fpair = factor_lj*forcelj*r2inv;
 
         fxtmp += delx*fpair;
@@ -138,7 +153,8 @@ void PairLJCutOMP::eval(int iifrom, int iito, ThrData * const thr)
         }
 
         if (EFLAG) {
-          evdwl = r6inv*(lj3i[jtype]*r6inv-lj4i[jtype]) - offseti[jtype];
+          evdwl = r6inv*((flt_t) lj3i[jtype]*r6inv - (flt_t) lj4i[jtype])
+            - (flt_t) offseti[jtype];
           evdwl *= factor_lj;
         }
 
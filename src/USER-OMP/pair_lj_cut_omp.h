@@ -38,7 +38,9 @@ class PairLJCutOMP : public PairLJCut, public ThrOMP {
   virtual double memory_usage();
 
  private:
-  template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+  template <typename flt_t>
+  void eval_thr(int eflag, int ifrom, int ito, ThrData * const thr);
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR, typename flt_t>
   void eval(int ifrom, int ito, ThrData * const thr);
 };
 
@@ -0,0 +1,328 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pair_meam_omp.h"
+#include "atom.h"
+#include "comm.h"
+#include "error.h"
+#include "force.h"
+#include "memory.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+
+#include "suffix.h"
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairMEAMOMP::PairMEAMOMP(LAMMPS *lmp) :
+  PairMEAM(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+
+  offset = NULL;
+  maxoffset = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairMEAMOMP::~PairMEAMOMP()
+{
+  memory->destroy(offset);
+}
+
+/* ----------------------------------------------------------------------
+   grow per-atom arrays
+   arrays summed over neighbors in meam_dens_init() get one
+   block of atoms per thread, reduced with data_reduce_thr()
+------------------------------------------------------------------------- */
+
+void PairMEAMOMP::grow_arrays()
+{
+  const int nthreads = comm->nthreads;
+
+  memory->destroy(rho);
+  memory->destroy(rho0);
+  memory->destroy(rho1);
+  memory->destroy(rho2);
+  memory->destroy(rho3);
+  memory->destroy(frhop);
+  memory->destroy(gamma);
+  memory->destroy(dgamma1);
+  memory->destroy(dgamma2);
+  memory->destroy(dgamma3);
+  memory->destroy(arho2b);
+  memory->destroy(arho1);
+  memory->destroy(arho2);
+  memory->destroy(arho3);
+  memory->destroy(arho3b);
+  memory->destroy(t_ave);
+  memory->destroy(tsq_ave);
+
+  nmax = atom->nmax;
+
+  memory->create(rho,nmax,"pair:rho");
+  memory->create(rho0,nthreads*nmax,"pair:rho0");
+  memory->create(rho1,nmax,"pair:rho1");
+  memory->create(rho2,nmax,"pair:rho2");
+  memory->create(rho3,nmax,"pair:rho3");
+  memory->create(frhop,nmax,"pair:frhop");
+  memory->create(gamma,nmax,"pair:gamma");
+  memory->create(dgamma1,nmax,"pair:dgamma1");
+  memory->create(dgamma2,nmax,"pair:dgamma2");
+  memory->create(dgamma3,nmax,"pair:dgamma3");
+  memory->create(arho2b,nthreads*nmax,"pair:arho2b");
+  memory->create(arho1,nthreads*nmax,3,"pair:arho1");
+  memory->create(arho2,nthreads*nmax,6,"pair:arho2");
+  memory->create(arho3,nthreads*nmax,10,"pair:arho3");
+  memory->create(arho3b,nthreads*nmax,3,"pair:arho3b");
+  memory->create(t_ave,nthreads*nmax,3,"pair:t_ave");
+  memory->create(tsq_ave,nthreads*nmax,3,"pair:tsq_ave");
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairMEAMOMP::compute(int eflag, int vflag)
+{
+  int ii,n,inum_half;
+  int *ilist_half,*numneigh_half,**firstneigh_half;
+  int *numneigh_full,**firstneigh_full;
+
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else evflag = vflag_fdotr = eflag_global = vflag_global =
+         eflag_atom = vflag_atom = 0;
+
+  // grow local arrays if necessary
+
+  if (atom->nmax > nmax) grow_arrays();
+
+  // neighbor list info
+
+  inum_half = listhalf->inum;
+  ilist_half = listhalf->ilist;
+  numneigh_half = listhalf->numneigh;
+  firstneigh_half = listhalf->firstneigh;
+  numneigh_full = listfull->numneigh;
+  firstneigh_full = listfull->firstneigh;
+
+  // strip neighbor lists of any special bond flags before using with MEAM
+  // necessary before doing neigh_f2c and neigh_c2f conversions each step
+
+  if (neighbor->ago == 0) {
+    neigh_strip(inum_half,ilist_half,numneigh_half,firstneigh_half);
+    neigh_strip(inum_half,ilist_half,numneigh_full,firstneigh_full);
+  }
+
+  // offset of each atom into scrfcn based on half neighbor list
+  // so that atoms can be processed independently
+
+  if (inum_half > maxoffset) {
+    memory->destroy(offset);
+    maxoffset = inum_half;
+    memory->create(offset,maxoffset,"pair:offset");
+  }
+
+  n = 0;
+  for (ii = 0; ii < inum_half; ii++) {
+    offset[ii] = n;
+    n += numneigh_half[ilist_half[ii]];
+  }
+
+  if (n > maxneigh) {
+    memory->destroy(scrfcn);
+    memory->destroy(dscrfcn);
+    memory->destroy(fcpair);
+    maxneigh = n;
+    memory->create(scrfcn,maxneigh,"pair:scrfcn");
+    memory->create(dscrfcn,maxneigh,"pair:dscrfcn");
+    memory->create(fcpair,maxneigh,"pair:fcpair");
+  }
+
+  // change neighbor list indices to Fortran indexing
+
+  neigh_c2f(inum_half,ilist_half,numneigh_half,firstneigh_half);
+  neigh_c2f(inum_half,ilist_half,numneigh_full,firstneigh_full);
+
+  const int nlocal = atom->nlocal;
+  const int nall = nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  int errorflag = 0;
+  double eng_force = 0.0;
+
+#if defined(_OPENMP)
+#pragma omp parallel default(none) shared(eflag,vflag,errorflag,eng_force) \
+  firstprivate(inum_half,ilist_half,numneigh_half,firstneigh_half,numneigh_full,firstneigh_full)
+#endif
+  {
+    int i,j,ii,ifrom,ito,tid,ifort,myerror;
+
+    loop_setup_thr(ifrom, ito, tid, inum_half, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
+
+    double **x = atom->x;
+    double **f = thr->get_f();
+    int *type = atom->type;
+    int ntype = atom->ntypes;
+    int nmax_f = nmax;
+
+    // per-thread blocks of the density arrays
+
+    double *rho0_t = rho0 + tid*nall;
+    double *arho2b_t = arho2b + tid*nall;
+    double *arho1_t = &arho1[0][0] + tid*nall*3;
+    double *arho2_t = &arho2[0][0] + tid*nall*6;
+    double *arho3_t = &arho3[0][0] + tid*nall*10;
+    double *arho3b_t = &arho3b[0][0] + tid*nall*3;
+    double *t_ave_t = &t_ave[0][0] + tid*nall*3;
+    double *tsq_ave_t = &tsq_ave[0][0] + tid*nall*3;
+
+    if (nall > 0) {
+      memset(rho0_t,0,nall*sizeof(double));
+      memset(arho2b_t,0,nall*sizeof(double));
+      memset(arho1_t,0,nall*3*sizeof(double));
+      memset(arho2_t,0,nall*6*sizeof(double));
+      memset(arho3_t,0,nall*10*sizeof(double));
+      memset(arho3b_t,0,nall*3*sizeof(double));
+      memset(t_ave_t,0,nall*3*sizeof(double));
+      memset(tsq_ave_t,0,nall*3*sizeof(double));
+    }
+
+    // 3 stages of MEAM calculation
+    // screening and partial densities of my atoms
+
+    myerror = 0;
+    for (ii = ifrom; ii < ito; ii++) {
+      i = ilist_half[ii];
+      ifort = i+1;
+      j = offset[ii];
+      meam_dens_init_(&ifort,&nmax_f,&ntype,type,fmap,&x[0][0],
+                      &numneigh_half[i],firstneigh_half[i],
+                      &numneigh_full[i],firstneigh_full[i],
+                      &scrfcn[j],&dscrfcn[j],&fcpair[j],
+                      rho0_t,arho1_t,arho2_t,arho2b_t,
+                      arho3_t,arho3b_t,t_ave_t,tsq_ave_t,&myerror);
+      if (myerror) errorflag = myerror;
+    }
+
+    // wait until all threads are done with computation
+    sync_threads();
+
+    // reduce per thread densities
+
+    thr->timer(Timer::PAIR);
+    data_reduce_thr(rho0, nall, nthreads, 1, tid);
+    data_reduce_thr(arho2b, nall, nthreads, 1, tid);
+    data_reduce_thr(&arho1[0][0], nall, nthreads, 3, tid);
+    data_reduce_thr(&arho2[0][0], nall, nthreads, 6, tid);
+    data_reduce_thr(&arho3[0][0], nall, nthreads, 10, tid);
+    data_reduce_thr(&arho3b[0][0], nall, nthreads, 3, tid);
+    data_reduce_thr(&t_ave[0][0], nall, nthreads, 3, tid);
+    data_reduce_thr(&tsq_ave[0][0], nall, nthreads, 3, tid);
+
+    // wait until reduction is complete
+    sync_threads();
+
+    // communicate and finalize densities
+    // MPI communication only on master thread
+
+#if defined(_OPENMP)
+#pragma omp master
+#endif
+    if (!errorflag) {
+      int nlocal_f = nlocal;
+      comm->reverse_comm_pair(this);
+      meam_dens_final_(&nlocal_f,&nmax_f,&eflag_either,&eflag_global,
+                       &eflag_atom,&eng_vdwl,eatom,&ntype,type,fmap,
+                       &arho1[0][0],&arho2[0][0],arho2b,&arho3[0][0],
+                       &arho3b[0][0],&t_ave[0][0],&tsq_ave[0][0],gamma,
+                       dgamma1,dgamma2,dgamma3,rho,rho0,rho1,rho2,rho3,
+                       frhop,&myerror);
+      if (myerror) errorflag = myerror;
+      comm->forward_comm_pair(this);
+    }
+
+    // wait until master thread is done with communication
+    sync_threads();
+
+    // forces on my atoms and their neighbors
+    // per-atom energy and virial go to this thread's block,
+    // same as set up by ev_setup_thr()
+
+    double eng_t = 0.0;
+    double *eptr = eatom;
+    if (eflag_atom) eptr = eatom + tid*nall;
+
+    double *vptr;
+    if (vflag_atom) vptr = &vatom[tid*nall][0];
+    else vptr = &cutmax;
+
+    if (!errorflag) {
+      for (ii = ifrom; ii < ito; ii++) {
+        i = ilist_half[ii];
+        ifort = i+1;
+        j = offset[ii];
+        meam_force_(&ifort,&nmax_f,&eflag_either,&eflag_global,&eflag_atom,
+                    &vflag_atom,&eng_t,eptr,&ntype,
+                    type,fmap,&x[0][0],
+                    &numneigh_half[i],firstneigh_half[i],
+                    &numneigh_full[i],firstneigh_full[i],
+                    &scrfcn[j],&dscrfcn[j],&fcpair[j],
+                    dgamma1,dgamma2,dgamma3,rho0,rho1,rho2,rho3,frhop,
+                    &arho1[0][0],&arho2[0][0],arho2b,&arho3[0][0],
+                    &arho3b[0][0],&t_ave[0][0],&tsq_ave[0][0],&f[0][0],
+                    vptr,&myerror);
+        if (myerror) errorflag = myerror;
+      }
+    }
+
+#if defined(_OPENMP)
+#pragma omp atomic
+#endif
+    eng_force += eng_t;
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+
+  eng_vdwl += eng_force;
+
+  if (errorflag) {
+    char str[128];
+    sprintf(str,"MEAM library error %d",errorflag);
+    error->one(FLERR,str);
+  }
+
+  // change neighbor list indices back to C indexing
+
+  neigh_f2c(inum_half,ilist_half,numneigh_half,firstneigh_half);
+  neigh_f2c(inum_half,ilist_half,numneigh_full,firstneigh_full);
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairMEAMOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairMEAM::memory_usage();
+  bytes += (comm->nthreads-1) * (1 + 1 + 3 + 6 + 10 + 3 + 3 + 3) *
+    nmax * sizeof(double);
+  bytes += maxoffset * sizeof(int);
+
+  return bytes;
+}
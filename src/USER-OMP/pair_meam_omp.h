@@ -0,0 +1,47 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(meam/omp,PairMEAMOMP)
+
+#else
+
+#ifndef LMP_PAIR_MEAM_OMP_H
+#define LMP_PAIR_MEAM_OMP_H
+
+#include "pair_meam.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairMEAMOMP : public PairMEAM, public ThrOMP {
+
+ public:
+  PairMEAMOMP(class LAMMPS *);
+  virtual ~PairMEAMOMP();
+
+  virtual void compute(int, int);
+  virtual double memory_usage();
+
+ protected:
+  int *offset;                  // offset of each atom into scrfcn
+  int maxoffset;                // allocated size of offset
+
+  void grow_arrays();
+};
+
+}
+
+#endif
+#endif
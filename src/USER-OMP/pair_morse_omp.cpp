@@ -55,30 +55,40 @@ void PairMorseOMP::compute(int eflag, int vflag)
     thr->timer(Timer::START);
     ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
 
-    if (evflag) {
-      if (eflag) {
-        if (force->newton_pair) eval<1,1,1>(ifrom, ito, thr);
-        else eval<1,1,0>(ifrom, ito, thr);
-      } else {
-        if (force->newton_pair) eval<1,0,1>(ifrom, ito, thr);
-        else eval<1,0,0>(ifrom, ito, thr);
-      }
-    } else {
-      if (force->newton_pair) eval<0,0,1>(ifrom, ito, thr);
-      else eval<0,0,0>(ifrom, ito, thr);
-    }
+    if (fix->get_mixed()) eval_thr<float>(eflag, ifrom, ito, thr);
+    else eval_thr<double>(eflag, ifrom, ito, thr);
 
     thr->timer(Timer::PAIR);
     reduce_thr(this, eflag, vflag, thr);
   } // end of omp parallel region
 }
 
-template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+template <typename flt_t>
+void PairMorseOMP::eval_thr(int eflag, int ifrom, int ito, ThrData * const thr)
+{
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1,flt_t>(ifrom, ito, thr);
+      else eval<1,1,0,flt_t>(ifrom, ito, thr);
+    } else {
+      if (force->newton_pair) eval<1,0,1,flt_t>(ifrom, ito, thr);
+      else eval<1,0,0,flt_t>(ifrom, ito, thr);
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1,flt_t>(ifrom, ito, thr);
+    else eval<0,0,0,flt_t>(ifrom, ito, thr);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR, typename flt_t>
 void PairMorseOMP::eval(int iifrom, int iito, ThrData * const thr)
 {
   int i,j,ii,jj,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
-  double rsq,r,dr,dexp,factor_lj;
+  double xtmp,ytmp,ztmp;
+  flt_t delx,dely,delz,evdwl,fpair;
+  flt_t rsq,r,dr,dexp,factor_lj;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   evdwl = 0.0;
@@ -118,11 +128,11 @@ void PairMorseOMP::eval(int iifrom, int iito, ThrData * const thr)
       rsq = delx*delx + dely*dely + delz*delz;
       jtype = type[j];
 
-      if (rsq < cutsq[itype][jtype]) {
+      if (rsq < (flt_t) cutsq[itype][jtype]) {
         r = sqrt(rsq);
-        dr = r - r0[itype][jtype];
-        dexp = exp(-alpha[itype][jtype] * dr);
-        fpair = factor_lj * morse1[itype][jtype] * (dexp*dexp - dexp) / r;
+        dr = r - (flt_t) r0[itype][jtype];
+        dexp = exp(-(flt_t) alpha[itype][jtype] * dr);
+        fpair = factor_lj * (flt_t) morse1[itype][jtype] * (dexp*dexp - dexp) / r;
 
         fxtmp += delx*fpair;
         fytmp += dely*fpair;
@@ -134,8 +144,8 @@ void PairMorseOMP::eval(int iifrom, int iito, ThrData * const thr)
         }
 
         if (EFLAG) {
-          evdwl = d0[itype][jtype] * (dexp*dexp - 2.0*dexp) -
-            offset[itype][jtype];
+          evdwl = (flt_t) d0[itype][jtype] * (dexp*dexp - (flt_t) 2.0*dexp)
+            - (flt_t) offset[itype][jtype];
           evdwl *= factor_lj;
         }
 
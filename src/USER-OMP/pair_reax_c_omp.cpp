@@ -0,0 +1,2175 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   OpenMP threaded version of pair style reax/c.
+   The far neighbor list construction, the corrected bond orders and
+   all bonded and nonbonded interactions are computed by all threads
+   with per-thread force accumulation. Only the uncorrected bond orders
+   and the bond and hydrogen bond lists are built by the serial ReaxFF
+   code.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <string.h>
+#include "pair_reax_c_omp.h"
+#include "atom.h"
+#include "update.h"
+#include "comm.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "fix_reax_c.h"
+#include "memory.h"
+#include "error.h"
+
+#include "reaxc_types.h"
+#include "reaxc_bond_orders.h"
+#include "reaxc_forces.h"
+#include "reaxc_io_tools.h"
+#include "reaxc_list.h"
+#include "reaxc_nonbonded.h"
+#include "reaxc_reset_tools.h"
+#include "reaxc_torsion_angles.h"
+#include "reaxc_valence_angles.h"
+#include "reaxc_vector.h"
+
+#include "suffix.h"
+using namespace LAMMPS_NS;
+
+#define MIN_SINE 1e-10
+
+/* ---------------------------------------------------------------------- */
+
+PairReaxCOMP::PairReaxCOMP(LAMMPS *lmp) :
+  PairReaxC(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+  num_far = NULL;
+  nmax_far = 0;
+  num_thb = NULL;
+  nmax_thb = 0;
+  cddelta_thr = NULL;
+  maxcddelta = 0;
+  cdbo_thr = NULL;
+  maxcdbo = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairReaxCOMP::~PairReaxCOMP()
+{
+  memory->destroy(num_far);
+  memory->destroy(num_thb);
+  memory->destroy(cddelta_thr);
+  memory->destroy(cdbo_thr);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairReaxCOMP::compute(int eflag, int vflag)
+{
+  double evdwl,ecoul;
+  double t_start, t_end;
+
+  // communicate num_bonds once every reneighboring
+  // 2 num arrays stored by fix, grab ptr to them
+
+  if (neighbor->ago == 0) comm->forward_comm_fix(fix_reax);
+  int *num_bonds = fix_reax->num_bonds;
+  int *num_hbonds = fix_reax->num_hbonds;
+
+  evdwl = ecoul = 0.0;
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else ev_unset();
+
+  if (vflag_global) control->virial = 1;
+  else control->virial = 0;
+
+  system->n = atom->nlocal; // my atoms
+  system->N = atom->nlocal + atom->nghost; // mine + ghosts
+  system->bigN = static_cast<int> (atom->natoms);  // all atoms in the system
+
+  system->big_box.V = 0;
+  system->big_box.box_norms[0] = 0;
+  system->big_box.box_norms[1] = 0;
+  system->big_box.box_norms[2] = 0;
+  if( comm->me == 0 ) t_start = MPI_Wtime();
+
+  // setup data structures
+
+  setup();
+
+  Reset( system, control, data, workspace, &lists, world );
+  workspace->realloc.num_far = write_reax_lists();
+  // timing for filling in the reax lists
+  if( comm->me == 0 ) {
+    t_end = MPI_Wtime();
+    data->timing.nbrs = t_end - t_start;
+  }
+
+  // uncorrected bond orders and the bond and hydrogen bond lists
+
+  Init_Forces_noQEq( system, control, data, workspace,
+                     &lists, out_control, world );
+
+  // per-thread accumulators for the CdDelta terms of all atoms and the
+  // Cdbo terms of bonds that belong to atoms of other threads. they are
+  // cleared again when they are reduced, so only new storage is zeroed.
+
+  int nall = system->N;
+  int nthreads = comm->nthreads;
+  int inum = system->n;
+  int nbonds = lists[BONDS].num_intrs;
+  int tabulate = control->tabulate;
+  int hbflag = (control->hbond_cut > 0) ? 1 : 0;
+
+  if (nthreads*nall > maxcddelta) {
+    memory->destroy(cddelta_thr);
+    maxcddelta = nthreads*atom->nmax;
+    if (maxcddelta < nthreads*nall) maxcddelta = nthreads*nall;
+    memory->create(cddelta_thr,maxcddelta,"reax/c/omp:cddelta_thr");
+    memset(cddelta_thr,0,maxcddelta*sizeof(double));
+  }
+
+  if (nthreads*nbonds > maxcdbo) {
+    memory->destroy(cdbo_thr);
+    maxcdbo = nthreads*nbonds;
+    memory->create(cdbo_thr,maxcdbo,"reax/c/omp:cdbo_thr");
+    memset(cdbo_thr,0,maxcdbo*sizeof(double));
+  }
+
+  if (nall+1 > nmax_thb) {
+    memory->destroy(num_thb);
+    nmax_thb = atom->nmax+1;
+    if (nmax_thb < nall+1) nmax_thb = nall+1;
+    memory->create(num_thb,nmax_thb,"reax/c/omp:num_thb");
+  }
+
+  double e_vdW, e_ele, e_bond, e_lp, e_ov, e_un;
+  double e_ang, e_pen, e_coa, e_hb, e_tor, e_con;
+  e_vdW = e_ele = e_bond = e_lp = e_ov = e_un = 0.0;
+  e_ang = e_pen = e_coa = e_hb = e_tor = e_con = 0.0;
+
+#if defined(_OPENMP)
+#pragma omp parallel default(none) shared(eflag,vflag,nall,nthreads,inum,tabulate,hbflag) reduction(+:e_vdW,e_ele,e_bond,e_lp,e_ov,e_un,e_ang,e_pen,e_coa,e_hb,e_tor,e_con)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
+
+    if (tabulate) nonbonded_tabulated_thr(ifrom, ito, e_vdW, e_ele, thr);
+    else nonbonded_thr(ifrom, ito, e_vdW, e_ele, thr);
+
+    // corrected bond orders, then the bonded terms. between barriers
+    // the bond order data of a bond is only updated by the thread
+    // that owns the first atom of the bond.
+
+    bond_orders_thr(nthreads);
+    bonds_thr(ifrom, ito, e_bond, thr);
+    atom_energy_thr(ifrom, ito, e_lp, e_ov, e_un, thr);
+    if (hbflag) hydrogen_bonds_thr(ifrom, ito, e_hb, thr);
+    sync_threads();
+
+    valence_angles_thr(nthreads, e_ang, e_pen, e_coa, thr);
+    torsion_angles_thr(ifrom, ito, e_tor, e_con, thr);
+
+    // forces from the derivatives of the bond orders
+
+    total_force_thr(nthreads, thr);
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+
+  data->my_en.e_vdW += e_vdW;
+  data->my_en.e_ele += e_ele;
+  data->my_en.e_bond += e_bond;
+  data->my_en.e_lp += e_lp;
+  data->my_en.e_ov += e_ov;
+  data->my_en.e_un += e_un;
+  data->my_en.e_ang += e_ang;
+  data->my_en.e_pen += e_pen;
+  data->my_en.e_coa += e_coa;
+  data->my_en.e_hb += e_hb;
+  data->my_en.e_tor += e_tor;
+  data->my_en.e_con += e_con;
+  Compute_Polarization_Energy( system, data );
+
+  // the ReaxFF trajectory output writes the forces in ReaxFF convention
+
+  if (out_control->write_steps > 0) {
+    double **f = atom->f;
+    for (int k = 0; k < system->n; ++k) {
+      system->my_atoms[k].f[0] = -f[k][0];
+      system->my_atoms[k].f[1] = -f[k][1];
+      system->my_atoms[k].f[2] = -f[k][2];
+    }
+  }
+
+  for(int k = 0; k < system->N; ++k) {
+    num_bonds[k] = system->my_atoms[k].num_bonds;
+    num_hbonds[k] = system->my_atoms[k].num_hbonds;
+  }
+
+  // energies and pressure
+
+  if (eflag_global) {
+    evdwl += data->my_en.e_bond;
+    evdwl += data->my_en.e_ov;
+    evdwl += data->my_en.e_un;
+    evdwl += data->my_en.e_lp;
+    evdwl += data->my_en.e_ang;
+    evdwl += data->my_en.e_pen;
+    evdwl += data->my_en.e_coa;
+    evdwl += data->my_en.e_hb;
+    evdwl += data->my_en.e_tor;
+    evdwl += data->my_en.e_con;
+    evdwl += data->my_en.e_vdW;
+
+    ecoul += data->my_en.e_ele;
+    ecoul += data->my_en.e_pol;
+
+    // Store the different parts of the energy
+    // in a list for output by compute pair command
+
+    pvector[0] = data->my_en.e_bond;
+    pvector[1] = data->my_en.e_ov + data->my_en.e_un;
+    pvector[2] = data->my_en.e_lp;
+    pvector[3] = 0.0;
+    pvector[4] = data->my_en.e_ang;
+    pvector[5] = data->my_en.e_pen;
+    pvector[6] = data->my_en.e_coa;
+    pvector[7] = data->my_en.e_hb;
+    pvector[8] = data->my_en.e_tor;
+    pvector[9] = data->my_en.e_con;
+    pvector[10] = data->my_en.e_vdW;
+    pvector[11] = data->my_en.e_ele;
+    pvector[12] = 0.0;
+    pvector[13] = data->my_en.e_pol;
+  }
+
+  // Set internal timestep counter to that of LAMMPS
+
+  data->step = update->ntimestep;
+
+  Output_Results( system, control, data, &lists, out_control, mpi_data );
+
+  // populate tmpid and tmpbo arrays for fix reax/c/species
+  int i, j;
+
+  if(fixspecies_flag) {
+    if (system->N > nmax) {
+      memory->destroy(tmpid);
+      memory->destroy(tmpbo);
+      nmax = system->N;
+      memory->create(tmpid,nmax,MAXSPECBOND,"pair:tmpid");
+      memory->create(tmpbo,nmax,MAXSPECBOND,"pair:tmpbo");
+    }
+
+    for (i = 0; i < system->N; i ++)
+      for (j = 0; j < MAXSPECBOND; j ++) {
+        tmpbo[i][j] = 0.0;
+        tmpid[i][j] = 0;
+      }
+    FindBond();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   build the far neighbor list in two threaded passes:
+   count the neighbors within the nonbonded cutoff per atom,
+   convert the counts to offsets, then fill in the list
+------------------------------------------------------------------------- */
+
+int PairReaxCOMP::write_reax_lists()
+{
+  double **x = atom->x;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  reax_list *far_nbrs = lists + FAR_NBRS;
+  far_neighbor_data *far_list = far_nbrs->select.far_nbr_list;
+  double cutsq = control->nonb_cut*control->nonb_cut;
+  int numall = list->inum + list->gnum;
+  int nthreads = comm->nthreads;
+
+  if (numall+1 > nmax_far) {
+    memory->destroy(num_far);
+    nmax_far = atom->nmax+1;
+    if (nmax_far < numall+1) nmax_far = numall+1;
+    memory->create(num_far,nmax_far,"reax/c/omp:num_far");
+  }
+
+#if defined(_OPENMP)
+#pragma omp parallel default(none) shared(x,ilist,numneigh,firstneigh,far_nbrs,far_list,cutsq,numall,nthreads)
+#endif
+  {
+    int ifrom, ito, tid;
+    int itr_i, itr_j, i, j, num;
+    int *jlist;
+    double d_sqr;
+    rvec dvec;
+
+    loop_setup_thr(ifrom, ito, tid, numall, nthreads);
+
+    for (itr_i = ifrom; itr_i < ito; ++itr_i) {
+      i = ilist[itr_i];
+      jlist = firstneigh[i];
+      num = 0;
+      for (itr_j = 0; itr_j < numneigh[i]; ++itr_j) {
+        j = jlist[itr_j] & NEIGHMASK;
+        get_distance( x[j], x[i], &d_sqr, &dvec );
+        if (d_sqr <= cutsq) ++num;
+      }
+      num_far[itr_i] = num;
+    }
+
+    sync_threads();
+
+#if defined(_OPENMP)
+#pragma omp master
+#endif
+    {
+      int start = 0;
+      for (itr_i = 0; itr_i < numall; ++itr_i) {
+        num = num_far[itr_i];
+        num_far[itr_i] = start;
+        start += num;
+      }
+      num_far[numall] = start;
+    }
+
+    sync_threads();
+
+    for (itr_i = ifrom; itr_i < ito; ++itr_i) {
+      i = ilist[itr_i];
+      jlist = firstneigh[i];
+      num = num_far[itr_i];
+      Set_Start_Index( i, num, far_nbrs );
+
+      for (itr_j = 0; itr_j < numneigh[i]; ++itr_j) {
+        j = jlist[itr_j] & NEIGHMASK;
+        get_distance( x[j], x[i], &d_sqr, &dvec );
+        if (d_sqr <= cutsq) {
+          set_far_nbr( &far_list[num], j, sqrt(d_sqr), dvec );
+          ++num;
+        }
+      }
+      Set_End_Index( i, num, far_nbrs );
+    }
+  } // end of omp parallel region
+
+  return num_far[numall];
+}
+
+/* ----------------------------------------------------------------------
+   van der Waals and Coulomb interactions for local atoms ifrom to ito-1
+   forces are accumulated with LAMMPS sign convention in the per-thread
+   force array, energies are added to en_vdW and en_ele
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::nonbonded_thr(int ifrom, int ito, double &en_vdW,
+                                 double &en_ele, ThrData * const thr)
+{
+  int i, j, pj, natoms;
+  int start_i, end_i, flag;
+  rc_tagint orig_i, orig_j;
+  double p_vdW1, p_vdW1i;
+  double powr_vdW1, powgi_vdW1;
+  double tmp, r_ij, fn13, exp1, exp2;
+  double Tap, dTap, dfn13, CEvd, CEclmb, de_core;
+  double dr3gamij_1, dr3gamij_3;
+  double e_ele, e_vdW, e_core, SMALL = 0.0001;
+  double e_lg, de_lg, r_ij5, r_ij6, re6;
+  double pe_vdw, fpair, qi, qj;
+  two_body_parameters *twbp;
+  far_neighbor_data *nbr_pj;
+
+  dbl3_t * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const reax_atom * const my_atoms = system->my_atoms;
+  const double * const Tp = workspace->Tap;
+  reax_list * const far_nbrs = lists + FAR_NBRS;
+  const int vdw_type = system->reax_param.gp.vdw_type;
+  const int evflag_thr = evflag || vflag_atom;
+
+  natoms = system->n;
+  p_vdW1 = system->reax_param.gp.l[28];
+  p_vdW1i = 1.0 / p_vdW1;
+  e_core = 0;
+  e_vdW = 0;
+  e_lg = de_lg = 0.0;
+
+  for( i = ifrom; i < ito; ++i ) {
+    if (my_atoms[i].type < 0) continue;
+    start_i = Start_Index(i, far_nbrs);
+    end_i   = End_Index(i, far_nbrs);
+    orig_i  = my_atoms[i].orig_id;
+    qi = my_atoms[i].q;
+
+    for( pj = start_i; pj < end_i; ++pj ) {
+      nbr_pj = &(far_nbrs->select.far_nbr_list[pj]);
+      j = nbr_pj->nbr;
+      if (my_atoms[j].type < 0) continue;
+      orig_j  = my_atoms[j].orig_id;
+
+      flag = 0;
+      if(nbr_pj->d <= control->nonb_cut) {
+        if (j < natoms) flag = 1;
+        else if (orig_i < orig_j) flag = 1;
+        else if (orig_i == orig_j) {
+          if (nbr_pj->dvec[2] > SMALL) flag = 1;
+          else if (fabs(nbr_pj->dvec[2]) < SMALL) {
+            if (nbr_pj->dvec[1] > SMALL) flag = 1;
+            else if (fabs(nbr_pj->dvec[1]) < SMALL && nbr_pj->dvec[0] > SMALL)
+              flag = 1;
+          }
+        }
+      }
+
+      if (!flag) continue;
+
+      r_ij = nbr_pj->d;
+      twbp = &(system->reax_param.tbp[my_atoms[i].type][my_atoms[j].type]);
+
+      Tap = Tp[7] * r_ij + Tp[6];
+      Tap = Tap * r_ij + Tp[5];
+      Tap = Tap * r_ij + Tp[4];
+      Tap = Tap * r_ij + Tp[3];
+      Tap = Tap * r_ij + Tp[2];
+      Tap = Tap * r_ij + Tp[1];
+      Tap = Tap * r_ij + Tp[0];
+
+      dTap = 7*Tp[7] * r_ij + 6*Tp[6];
+      dTap = dTap * r_ij + 5*Tp[5];
+      dTap = dTap * r_ij + 4*Tp[4];
+      dTap = dTap * r_ij + 3*Tp[3];
+      dTap = dTap * r_ij + 2*Tp[2];
+      dTap += Tp[1]/r_ij;
+
+      // van der Waals
+
+      if (vdw_type == 1 || vdw_type == 3) { // shielding
+        powr_vdW1 = pow(r_ij, p_vdW1);
+        powgi_vdW1 = pow( 1.0 / twbp->gamma_w, p_vdW1);
+
+        fn13 = pow( powr_vdW1 + powgi_vdW1, p_vdW1i );
+        exp1 = exp( twbp->alpha * (1.0 - fn13 / twbp->r_vdW) );
+        exp2 = exp( 0.5 * twbp->alpha * (1.0 - fn13 / twbp->r_vdW) );
+
+        e_vdW = twbp->D * (exp1 - 2.0 * exp2);
+        en_vdW += Tap * e_vdW;
+
+        dfn13 = pow( powr_vdW1 + powgi_vdW1, p_vdW1i - 1.0) *
+          pow(r_ij, p_vdW1 - 2.0);
+
+        CEvd = dTap * e_vdW -
+          Tap * twbp->D * (twbp->alpha / twbp->r_vdW) * (exp1 - exp2) * dfn13;
+      } else { // no shielding
+        exp1 = exp( twbp->alpha * (1.0 - r_ij / twbp->r_vdW) );
+        exp2 = exp( 0.5 * twbp->alpha * (1.0 - r_ij / twbp->r_vdW) );
+
+        e_vdW = twbp->D * (exp1 - 2.0 * exp2);
+        en_vdW += Tap * e_vdW;
+
+        CEvd = dTap * e_vdW -
+          Tap * twbp->D * (twbp->alpha / twbp->r_vdW) * (exp1 - exp2) / r_ij;
+      }
+
+      if (vdw_type == 2 || vdw_type == 3) { // inner wall
+        e_core = twbp->ecore * exp(twbp->acore * (1.0-(r_ij/twbp->rcore)));
+        en_vdW += Tap * e_core;
+
+        de_core = -(twbp->acore/twbp->rcore) * e_core;
+        CEvd += dTap * e_core + Tap * de_core / r_ij;
+
+        //  lg correction, only if lgvdw is yes
+        if (control->lgflag) {
+          r_ij5 = pow( r_ij, 5.0 );
+          r_ij6 = pow( r_ij, 6.0 );
+          re6 = pow( twbp->lgre, 6.0 );
+          e_lg = -(twbp->lgcij/( r_ij6 + re6 ));
+          en_vdW += Tap * e_lg;
+
+          de_lg = -6.0 * e_lg *  r_ij5 / ( r_ij6 + re6 ) ;
+          CEvd += dTap * e_lg + Tap * de_lg / r_ij;
+        }
+      }
+
+      // Coulomb
+
+      qj = my_atoms[j].q;
+      dr3gamij_1 = ( r_ij * r_ij * r_ij + twbp->gamma );
+      dr3gamij_3 = pow( dr3gamij_1 , 0.33333333333333 );
+
+      tmp = Tap / dr3gamij_3;
+      e_ele = C_ele * qi * qj * tmp;
+      en_ele += e_ele;
+
+      CEclmb = C_ele * qi * qj * ( dTap -  Tap * r_ij / dr3gamij_1 ) / dr3gamij_3;
+
+      // dvec points from i to j, so the force on i is +fpair*dvec
+
+      fpair = CEvd + CEclmb;
+      f[i].x += fpair*nbr_pj->dvec[0];
+      f[i].y += fpair*nbr_pj->dvec[1];
+      f[i].z += fpair*nbr_pj->dvec[2];
+      f[j].x -= fpair*nbr_pj->dvec[0];
+      f[j].y -= fpair*nbr_pj->dvec[1];
+      f[j].z -= fpair*nbr_pj->dvec[2];
+
+      if (evflag_thr) {
+        pe_vdw = Tap * (e_vdW + e_core + e_lg);
+        ev_tally_thr(this,i,j,natoms,1,pe_vdw,e_ele,-fpair,
+                     -nbr_pj->dvec[0],-nbr_pj->dvec[1],-nbr_pj->dvec[2],thr);
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as nonbonded_thr() but using the cubic spline lookup tables
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::nonbonded_tabulated_thr(int ifrom, int ito,
+                                           double &en_vdW, double &en_ele,
+                                           ThrData * const thr)
+{
+  int i, j, pj, r, natoms;
+  int type_i, type_j, tmin, tmax;
+  int start_i, end_i, flag;
+  rc_tagint orig_i, orig_j;
+  double r_ij, base, dif, qiqj;
+  double e_vdW, e_ele;
+  double CEvd, CEclmb, SMALL = 0.0001;
+  double fpair;
+  far_neighbor_data *nbr_pj;
+  LR_lookup_table *t;
+
+  dbl3_t * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const far_nbrs = lists + FAR_NBRS;
+  const int evflag_thr = evflag || vflag_atom;
+
+  natoms = system->n;
+
+  for( i = ifrom; i < ito; ++i ) {
+    type_i  = my_atoms[i].type;
+    if (type_i < 0) continue;
+    start_i = Start_Index(i,far_nbrs);
+    end_i   = End_Index(i,far_nbrs);
+    orig_i  = my_atoms[i].orig_id;
+
+    for( pj = start_i; pj < end_i; ++pj ) {
+      nbr_pj = &(far_nbrs->select.far_nbr_list[pj]);
+      j = nbr_pj->nbr;
+      type_j = my_atoms[j].type;
+      if (type_j < 0) continue;
+      orig_j  = my_atoms[j].orig_id;
+
+      flag = 0;
+      if(nbr_pj->d <= control->nonb_cut) {
+        if (j < natoms) flag = 1;
+        else if (orig_i < orig_j) flag = 1;
+        else if (orig_i == orig_j) {
+          if (nbr_pj->dvec[2] > SMALL) flag = 1;
+          else if (fabs(nbr_pj->dvec[2]) < SMALL) {
+            if (nbr_pj->dvec[1] > SMALL) flag = 1;
+            else if (fabs(nbr_pj->dvec[1]) < SMALL && nbr_pj->dvec[0] > SMALL)
+              flag = 1;
+          }
+        }
+      }
+
+      if (!flag) continue;
+
+      r_ij   = nbr_pj->d;
+      tmin  = MIN( type_i, type_j );
+      tmax  = MAX( type_i, type_j );
+      t = &( LR[tmin][tmax] );
+
+      // cubic spline interpolation
+
+      r = (int)(r_ij * t->inv_dx);
+      if( r == 0 )  ++r;
+      base = (double)(r+1) * t->dx;
+      dif = r_ij - base;
+      qiqj = my_atoms[i].q * my_atoms[j].q;
+
+      e_vdW = ((t->vdW[r].d*dif + t->vdW[r].c)*dif + t->vdW[r].b)*dif +
+        t->vdW[r].a;
+
+      e_ele = ((t->ele[r].d*dif + t->ele[r].c)*dif + t->ele[r].b)*dif +
+        t->ele[r].a;
+      e_ele *= qiqj;
+
+      en_vdW += e_vdW;
+      en_ele += e_ele;
+
+      CEvd = ((t->CEvd[r].d*dif + t->CEvd[r].c)*dif + t->CEvd[r].b)*dif +
+        t->CEvd[r].a;
+
+      CEclmb = ((t->CEclmb[r].d*dif+t->CEclmb[r].c)*dif+t->CEclmb[r].b)*dif +
+        t->CEclmb[r].a;
+      CEclmb *= qiqj;
+
+      fpair = CEvd + CEclmb;
+      f[i].x += fpair*nbr_pj->dvec[0];
+      f[i].y += fpair*nbr_pj->dvec[1];
+      f[i].z += fpair*nbr_pj->dvec[2];
+      f[j].x -= fpair*nbr_pj->dvec[0];
+      f[j].y -= fpair*nbr_pj->dvec[1];
+      f[j].z -= fpair*nbr_pj->dvec[2];
+
+      if (evflag_thr)
+        ev_tally_thr(this,i,j,natoms,1,e_vdW,e_ele,-fpair,
+                     -nbr_pj->dvec[0],-nbr_pj->dvec[1],-nbr_pj->dvec[2],thr);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   corrected bond orders and the per-atom quantities derived from them.
+   the thread owning atom i corrects bond i-j if i < j or if j is far
+   from the local atoms, all other bonds copy the values of their
+   partner bond after a barrier.
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::bond_orders_thr(int nthreads)
+{
+  int ifrom, ito, tid;
+  int i, j, pj, type_i, type_j;
+  int start_i, end_i, sym_index;
+  double val_i, Deltap_i, Deltap_boc_i;
+  double val_j, Deltap_j, Deltap_boc_j;
+  double f1, f2, f3, f4, f5, f4f5, exp_f4, exp_f5;
+  double exp_p1i, exp_p2i, exp_p1j, exp_p2j;
+  double temp, u1_ij, u1_ji, Cf1A_ij, Cf1B_ij, Cf1_ij, Cf1_ji;
+  double Cf45_ij, Cf45_ji;
+  double A0_ij, A1_ij, A2_ij, A2_ji, A3_ij, A3_ji;
+  double explp1;
+  single_body_parameters *sbp_i;
+  two_body_parameters *twbp;
+  bond_order_data *bo_ij, *bo_ji;
+
+  const reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const bonds = lists + BONDS;
+  const double p_boc1 = system->reax_param.gp.l[0];
+  const double p_boc2 = system->reax_param.gp.l[1];
+  const double p_lp1 = system->reax_param.gp.l[15];
+
+  loop_setup_thr(ifrom, ito, tid, system->N, nthreads);
+
+  // Deltaprime and Deltaprime_boc from the uncorrected bond orders
+
+  for( i = ifrom; i < ito; ++i ) {
+    type_i = my_atoms[i].type;
+    if (type_i < 0) continue;
+    sbp_i = &(system->reax_param.sbp[type_i]);
+    workspace->Deltap[i] = workspace->total_bond_order[i] - sbp_i->valency;
+    workspace->Deltap_boc[i] =
+      workspace->total_bond_order[i] - sbp_i->valency_val;
+
+    workspace->total_bond_order[i] = 0;
+  }
+
+  sync_threads();
+
+  // corrected bond orders and their derivative coefficients
+
+  for( i = ifrom; i < ito; ++i ) {
+    type_i = my_atoms[i].type;
+    if (type_i < 0) continue;
+    sbp_i = &(system->reax_param.sbp[type_i]);
+    val_i = sbp_i->valency;
+    Deltap_i = workspace->Deltap[i];
+    Deltap_boc_i = workspace->Deltap_boc[i];
+    start_i = Start_Index(i, bonds);
+    end_i = End_Index(i, bonds);
+
+    for( pj = start_i; pj < end_i; ++pj ) {
+      j = bonds->select.bond_list[pj].nbr;
+      type_j = my_atoms[j].type;
+      if (type_j < 0) continue;
+      if( i >= j && workspace->bond_mark[j] <= 3 ) continue;
+      bo_ij = &( bonds->select.bond_list[pj].bo_data );
+      twbp = &( system->reax_param.tbp[type_i][type_j] );
+
+      if( twbp->ovc < 0.001 && twbp->v13cor < 0.001 ) {
+        bo_ij->C1dbo = 1.000000;
+        bo_ij->C2dbo = 0.000000;
+        bo_ij->C3dbo = 0.000000;
+
+        bo_ij->C1dbopi = bo_ij->BO_pi;
+        bo_ij->C2dbopi = 0.000000;
+        bo_ij->C3dbopi = 0.000000;
+        bo_ij->C4dbopi = 0.000000;
+
+        bo_ij->C1dbopi2 = bo_ij->BO_pi2;
+        bo_ij->C2dbopi2 = 0.000000;
+        bo_ij->C3dbopi2 = 0.000000;
+        bo_ij->C4dbopi2 = 0.000000;
+
+      }
+      else {
+        val_j = system->reax_param.sbp[type_j].valency;
+        Deltap_j = workspace->Deltap[j];
+        Deltap_boc_j = workspace->Deltap_boc[j];
+
+        if( twbp->ovc >= 0.001 ) {
+          // correction for overcoordination
+          exp_p1i = exp( -p_boc1 * Deltap_i );
+          exp_p2i = exp( -p_boc2 * Deltap_i );
+          exp_p1j = exp( -p_boc1 * Deltap_j );
+          exp_p2j = exp( -p_boc2 * Deltap_j );
+
+          f2 = exp_p1i + exp_p1j;
+          f3 = -1.0 / p_boc2 * log( 0.5 * ( exp_p2i  + exp_p2j ) );
+          f1 = 0.5 * ( ( val_i + f2 )/( val_i + f2 + f3 ) +
+                       ( val_j + f2 )/( val_j + f2 + f3 ) );
+
+          temp = f2 + f3;
+          u1_ij = val_i + temp;
+          u1_ji = val_j + temp;
+          Cf1A_ij = 0.5 * f3 * (1.0 / SQR( u1_ij ) +
+                                1.0 / SQR( u1_ji ));
+          Cf1B_ij = -0.5 * (( u1_ij - f3 ) / SQR( u1_ij ) +
+                            ( u1_ji - f3 ) / SQR( u1_ji ));
+
+          Cf1_ij = 0.50 * ( -p_boc1 * exp_p1i / u1_ij -
+                            ((val_i+f2) / SQR(u1_ij)) *
+                            ( -p_boc1 * exp_p1i +
+                              exp_p2i / ( exp_p2i + exp_p2j ) ) +
+                            -p_boc1 * exp_p1i / u1_ji -
+                            ((val_j+f2) / SQR(u1_ji)) *
+                            ( -p_boc1 * exp_p1i +
+                              exp_p2i / ( exp_p2i + exp_p2j ) ));
+
+
+          Cf1_ji = -Cf1A_ij * p_boc1 * exp_p1j +
+            Cf1B_ij * exp_p2j / ( exp_p2i + exp_p2j );
+
+        }
+        else {
+          // no overcoordination correction
+          f1 = 1.0;
+          Cf1_ij = Cf1_ji = 0.0;
+        }
+
+        if( twbp->v13cor >= 0.001 ) {
+          // correction for 1-3 bond orders
+          exp_f4 =exp(-(twbp->p_boc4 * SQR( bo_ij->BO ) -
+                        Deltap_boc_i) * twbp->p_boc3 + twbp->p_boc5);
+          exp_f5 =exp(-(twbp->p_boc4 * SQR( bo_ij->BO ) -
+                        Deltap_boc_j) * twbp->p_boc3 + twbp->p_boc5);
+
+          f4 = 1. / (1. + exp_f4);
+          f5 = 1. / (1. + exp_f5);
+          f4f5 = f4 * f5;
+
+          Cf45_ij = -f4 * exp_f4;
+          Cf45_ji = -f5 * exp_f5;
+        }
+        else {
+          f4 = f5 = f4f5 = 1.0;
+          Cf45_ij = Cf45_ji = 0.0;
+        }
+
+        A0_ij = f1 * f4f5;
+        A1_ij = -2 * twbp->p_boc3 * twbp->p_boc4 * bo_ij->BO *
+          (Cf45_ij + Cf45_ji);
+        A2_ij = Cf1_ij / f1 + twbp->p_boc3 * Cf45_ij;
+        A2_ji = Cf1_ji / f1 + twbp->p_boc3 * Cf45_ji;
+        A3_ij = A2_ij + Cf1_ij / f1;
+        A3_ji = A2_ji + Cf1_ji / f1;
+
+        bo_ij->BO    = bo_ij->BO    * A0_ij;
+        bo_ij->BO_pi = bo_ij->BO_pi * A0_ij *f1;
+        bo_ij->BO_pi2= bo_ij->BO_pi2* A0_ij *f1;
+        bo_ij->BO_s  = bo_ij->BO - ( bo_ij->BO_pi + bo_ij->BO_pi2 );
+
+        bo_ij->C1dbo = A0_ij + bo_ij->BO * A1_ij;
+        bo_ij->C2dbo = bo_ij->BO * A2_ij;
+        bo_ij->C3dbo = bo_ij->BO * A2_ji;
+
+        bo_ij->C1dbopi = f1*f1*f4*f5;
+        bo_ij->C2dbopi = bo_ij->BO_pi * A1_ij;
+        bo_ij->C3dbopi = bo_ij->BO_pi * A3_ij;
+        bo_ij->C4dbopi = bo_ij->BO_pi * A3_ji;
+
+        bo_ij->C1dbopi2 = f1*f1*f4*f5;
+        bo_ij->C2dbopi2 = bo_ij->BO_pi2 * A1_ij;
+        bo_ij->C3dbopi2 = bo_ij->BO_pi2 * A3_ij;
+        bo_ij->C4dbopi2 = bo_ij->BO_pi2 * A3_ji;
+      }
+
+      // neglect bonds that are < 1e-10
+
+      if( bo_ij->BO < 1e-10 )
+        bo_ij->BO = 0.0;
+      if( bo_ij->BO_s < 1e-10 )
+        bo_ij->BO_s = 0.0;
+      if( bo_ij->BO_pi < 1e-10 )
+        bo_ij->BO_pi = 0.0;
+      if( bo_ij->BO_pi2 < 1e-10 )
+        bo_ij->BO_pi2 = 0.0;
+    }
+  }
+
+  sync_threads();
+
+  // copy the bond orders of the remaining bonds from their partner,
+  // then the total bond orders and the quantities derived from them
+
+  for( i = ifrom; i < ito; ++i ) {
+    type_i = my_atoms[i].type;
+    if (type_i < 0) continue;
+    sbp_i = &(system->reax_param.sbp[type_i]);
+    start_i = Start_Index(i, bonds);
+    end_i = End_Index(i, bonds);
+
+    for( pj = start_i; pj < end_i; ++pj ) {
+      j = bonds->select.bond_list[pj].nbr;
+      type_j = my_atoms[j].type;
+      if (type_j < 0) continue;
+      bo_ij = &( bonds->select.bond_list[pj].bo_data );
+
+      if( i >= j && workspace->bond_mark[j] <= 3 ) {
+        sym_index = bonds->select.bond_list[pj].sym_index;
+        bo_ji = &(bonds->select.bond_list[ sym_index ].bo_data);
+        bo_ij->BO = bo_ji->BO;
+        bo_ij->BO_s = bo_ji->BO_s;
+        bo_ij->BO_pi = bo_ji->BO_pi;
+        bo_ij->BO_pi2 = bo_ji->BO_pi2;
+      }
+
+      workspace->total_bond_order[i] += bo_ij->BO;
+    }
+
+    workspace->Delta[i] = workspace->total_bond_order[i] - sbp_i->valency;
+    workspace->Delta_e[i] = workspace->total_bond_order[i] - sbp_i->valency_e;
+    workspace->Delta_boc[i] = workspace->total_bond_order[i] -
+      sbp_i->valency_boc;
+    workspace->Delta_val[i] = workspace->total_bond_order[i] -
+      sbp_i->valency_val;
+
+    workspace->vlpex[i] = workspace->Delta_e[i] -
+      2.0 * (int)(workspace->Delta_e[i]/2.0);
+    explp1 = exp(-p_lp1 * SQR(2.0 + workspace->vlpex[i]));
+    workspace->nlp[i] = explp1 - (int)(workspace->Delta_e[i] / 2.0);
+    workspace->Delta_lp[i] = sbp_i->nlp_opt - workspace->nlp[i];
+    workspace->Clp[i] = 2.0 * p_lp1 * explp1 * (2.0 + workspace->vlpex[i]);
+    workspace->dDelta_lp[i] = workspace->Clp[i];
+
+    if( sbp_i->mass > 21.0 ) {
+      workspace->nlp_temp[i] = 0.5 * (sbp_i->valency_e - sbp_i->valency);
+      workspace->Delta_lp_temp[i] = sbp_i->nlp_opt - workspace->nlp_temp[i];
+      workspace->dDelta_lp_temp[i] = 0.;
+    }
+    else {
+      workspace->nlp_temp[i] = workspace->nlp[i];
+      workspace->Delta_lp_temp[i] = sbp_i->nlp_opt - workspace->nlp_temp[i];
+      workspace->dDelta_lp_temp[i] = workspace->Clp[i];
+    }
+  }
+
+  sync_threads();
+}
+
+/* ----------------------------------------------------------------------
+   bond energy of the bonds of local atoms ifrom to ito-1
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::bonds_thr(int ifrom, int ito, double &en_bond,
+                             ThrData * const thr)
+{
+  int i, j, pj, natoms;
+  int start_i, end_i;
+  int type_i, type_j;
+  double ebond, pow_BOs_be2, exp_be12, CEbo;
+  double gp3, gp4, gp7, gp10, gp37;
+  double exphu, exphua1, exphub1, exphuov, hulpov, estriph;
+  double decobdbo, decobdboua, decobdboub;
+  single_body_parameters *sbp_i, *sbp_j;
+  two_body_parameters *twbp;
+  bond_order_data *bo_ij;
+
+  const reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const bonds = lists + BONDS;
+  double * const CdDelta = cddelta_thr + thr->get_tid()*system->N;
+
+  gp3 = system->reax_param.gp.l[3];
+  gp4 = system->reax_param.gp.l[4];
+  gp7 = system->reax_param.gp.l[7];
+  gp10 = system->reax_param.gp.l[10];
+  gp37 = (int) system->reax_param.gp.l[37];
+  natoms = system->n;
+
+  for( i = ifrom; i < ito; ++i ) {
+    start_i = Start_Index(i, bonds);
+    end_i = End_Index(i, bonds);
+
+    for( pj = start_i; pj < end_i; ++pj ) {
+      j = bonds->select.bond_list[pj].nbr;
+
+      if( my_atoms[i].orig_id > my_atoms[j].orig_id )
+        continue;
+      if( my_atoms[i].orig_id == my_atoms[j].orig_id ) {
+        if (my_atoms[j].x[2] <  my_atoms[i].x[2]) continue;
+        if (my_atoms[j].x[2] == my_atoms[i].x[2] &&
+            my_atoms[j].x[1] <  my_atoms[i].x[1]) continue;
+        if (my_atoms[j].x[2] == my_atoms[i].x[2] &&
+            my_atoms[j].x[1] == my_atoms[i].x[1] &&
+            my_atoms[j].x[0] <  my_atoms[i].x[0]) continue;
+      }
+
+      type_i = my_atoms[i].type;
+      type_j = my_atoms[j].type;
+      sbp_i = &( system->reax_param.sbp[type_i] );
+      sbp_j = &( system->reax_param.sbp[type_j] );
+      twbp = &( system->reax_param.tbp[type_i][type_j] );
+      bo_ij = &( bonds->select.bond_list[pj].bo_data );
+
+      pow_BOs_be2 = pow( bo_ij->BO_s, twbp->p_be2 );
+      exp_be12 = exp( twbp->p_be1 * ( 1.0 - pow_BOs_be2 ) );
+      CEbo = -twbp->De_s * exp_be12 *
+        ( 1.0 - twbp->p_be1 * twbp->p_be2 * pow_BOs_be2 );
+
+      en_bond += ebond =
+        -twbp->De_s * bo_ij->BO_s * exp_be12
+        -twbp->De_p * bo_ij->BO_pi
+        -twbp->De_pp * bo_ij->BO_pi2;
+
+      if (evflag)
+        ev_tally_thr(this,i,j,natoms,1,ebond,0.0,0.0,0.0,0.0,0.0,thr);
+
+      bo_ij->Cdbo += CEbo;
+      bo_ij->Cdbopi -= (CEbo + twbp->De_p);
+      bo_ij->Cdbopi2 -= (CEbo + twbp->De_pp);
+
+      // stabilisation terminal triple bond
+
+      if( bo_ij->BO >= 1.00 ) {
+        if( gp37 == 2 ||
+            (sbp_i->mass == 12.0000 && sbp_j->mass == 15.9990) ||
+            (sbp_j->mass == 12.0000 && sbp_i->mass == 15.9990) ) {
+          exphu = exp( -gp7 * SQR(bo_ij->BO - 2.50) );
+          exphua1 = exp(-gp3 * (workspace->total_bond_order[i]-bo_ij->BO));
+          exphub1 = exp(-gp3 * (workspace->total_bond_order[j]-bo_ij->BO));
+          exphuov = exp(gp4 * (workspace->Delta[i] + workspace->Delta[j]));
+          hulpov = 1.0 / (1.0 + 25.0 * exphuov);
+
+          estriph = gp10 * exphu * hulpov * (exphua1 + exphub1);
+          en_bond += estriph;
+
+          decobdbo = gp10 * exphu * hulpov * (exphua1 + exphub1) *
+            ( gp3 - 2.0 * gp7 * (bo_ij->BO-2.50) );
+          decobdboua = -gp10 * exphu * hulpov *
+            (gp3*exphua1 + 25.0*gp4*exphuov*hulpov*(exphua1+exphub1));
+          decobdboub = -gp10 * exphu * hulpov *
+            (gp3*exphub1 + 25.0*gp4*exphuov*hulpov*(exphua1+exphub1));
+
+          if (evflag)
+            ev_tally_thr(this,i,j,natoms,1,estriph,0.0,0.0,0.0,0.0,0.0,thr);
+
+          bo_ij->Cdbo += decobdbo;
+          CdDelta[i] += decobdboua;
+          CdDelta[j] += decobdboub;
+        }
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   lone pair, over- and under-coordination energy of local atoms
+   ifrom to ito-1
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::atom_energy_thr(int ifrom, int ito, double &en_lp,
+                                   double &en_ov, double &en_un,
+                                   ThrData * const thr)
+{
+  int i, j, pj, type_i, type_j, natoms;
+  double Delta_lpcorr, dfvl;
+  double e_lp, expvd2, inv_expvd2, dElp, CElp, DlpVi;
+  double e_lph, Di, vov3, deahu2dbo, deahu2dsbo;
+  double e_ov, CEover1, CEover2, CEover3, CEover4;
+  double exp_ovun1, exp_ovun2, sum_ovun1, sum_ovun2;
+  double exp_ovun2n, exp_ovun6, exp_ovun8;
+  double inv_exp_ovun1, inv_exp_ovun2, inv_exp_ovun2n, inv_exp_ovun8;
+  double e_un, CEunder1, CEunder2, CEunder3, CEunder4;
+  double p_lp2, p_lp3;
+  double p_ovun2, p_ovun3, p_ovun4, p_ovun5, p_ovun6, p_ovun7, p_ovun8;
+  double eng_tmp;
+  int numbonds;
+
+  single_body_parameters *sbp_i;
+  two_body_parameters *twbp;
+  bond_data *pbond;
+  bond_order_data *bo_ij;
+
+  const reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const bonds = lists + BONDS;
+  double * const CdDelta = cddelta_thr + thr->get_tid()*system->N;
+
+  p_lp3 = system->reax_param.gp.l[5];
+  p_ovun3 = system->reax_param.gp.l[32];
+  p_ovun4 = system->reax_param.gp.l[31];
+  p_ovun6 = system->reax_param.gp.l[6];
+  p_ovun7 = system->reax_param.gp.l[8];
+  p_ovun8 = system->reax_param.gp.l[9];
+  natoms = system->n;
+
+  for( i = ifrom; i < ito; ++i ) {
+    type_i = my_atoms[i].type;
+    if (type_i < 0) continue;
+    sbp_i = &(system->reax_param.sbp[ type_i ]);
+
+    // lone-pair energy
+
+    p_lp2 = sbp_i->p_lp2;
+    expvd2 = exp( -75 * workspace->Delta_lp[i] );
+    inv_expvd2 = 1. / (1. + expvd2 );
+
+    numbonds = End_Index(i, bonds) - Start_Index(i, bonds);
+    e_lp = 0.0;
+
+    if (numbonds > 0)
+      en_lp += e_lp = p_lp2 * workspace->Delta_lp[i] * inv_expvd2;
+
+    dElp = p_lp2 * inv_expvd2 +
+      75 * p_lp2 * workspace->Delta_lp[i] * expvd2 * SQR(inv_expvd2);
+    CElp = dElp * workspace->dDelta_lp[i];
+
+    if (numbonds > 0) CdDelta[i] += CElp;
+
+    if (evflag)
+      ev_tally_thr(this,i,i,natoms,1,e_lp,0.0,0.0,0.0,0.0,0.0,thr);
+
+    // correction for C2
+
+    if( p_lp3 > 0.001 && !strcmp(system->reax_param.sbp[type_i].name, "C") )
+      for( pj = Start_Index(i, bonds); pj < End_Index(i, bonds); ++pj ) {
+        j = bonds->select.bond_list[pj].nbr;
+        type_j = my_atoms[j].type;
+        if (type_j < 0) continue;
+
+        if( !strcmp( system->reax_param.sbp[type_j].name, "C" ) ) {
+          twbp = &( system->reax_param.tbp[type_i][type_j]);
+          bo_ij = &( bonds->select.bond_list[pj].bo_data );
+          Di = workspace->Delta[i];
+          vov3 = bo_ij->BO - Di - 0.040*pow(Di, 4.);
+
+          if( vov3 > 3. ) {
+            en_lp += e_lph = p_lp3 * SQR(vov3-3.0);
+
+            deahu2dbo = 2.*p_lp3*(vov3 - 3.);
+            deahu2dsbo = 2.*p_lp3*(vov3 - 3.)*(-1. - 0.16*pow(Di, 3.));
+
+            bo_ij->Cdbo += deahu2dbo;
+            CdDelta[i] += deahu2dsbo;
+
+            if (evflag)
+              ev_tally_thr(this,i,j,natoms,1,e_lph,0.0,0.0,0.0,0.0,0.0,thr);
+          }
+        }
+      }
+  }
+
+  for( i = ifrom; i < ito; ++i ) {
+    type_i = my_atoms[i].type;
+    if (type_i < 0) continue;
+    sbp_i = &(system->reax_param.sbp[ type_i ]);
+
+    // over-coordination energy
+
+    if( sbp_i->mass > 21.0 )
+      dfvl = 0.0;
+    else dfvl = 1.0; // only for 1st-row elements
+
+    p_ovun2 = sbp_i->p_ovun2;
+    sum_ovun1 = sum_ovun2 = 0;
+    for( pj = Start_Index(i, bonds); pj < End_Index(i, bonds); ++pj ) {
+      j = bonds->select.bond_list[pj].nbr;
+      type_j = my_atoms[j].type;
+      if (type_j < 0) continue;
+      bo_ij = &(bonds->select.bond_list[pj].bo_data);
+      twbp = &(system->reax_param.tbp[ type_i ][ type_j ]);
+
+      sum_ovun1 += twbp->p_ovun1 * twbp->De_s * bo_ij->BO;
+      sum_ovun2 += (workspace->Delta[j] - dfvl*workspace->Delta_lp_temp[j])*
+        ( bo_ij->BO_pi + bo_ij->BO_pi2 );
+    }
+
+    exp_ovun1 = p_ovun3 * exp( p_ovun4 * sum_ovun2 );
+    inv_exp_ovun1 = 1.0 / (1 + exp_ovun1);
+    Delta_lpcorr  = workspace->Delta[i] -
+      (dfvl * workspace->Delta_lp_temp[i]) * inv_exp_ovun1;
+
+    exp_ovun2 = exp( p_ovun2 * Delta_lpcorr );
+    inv_exp_ovun2 = 1.0 / (1.0 + exp_ovun2);
+
+    DlpVi = 1.0 / (Delta_lpcorr + sbp_i->valency + 1e-8);
+    CEover1 = Delta_lpcorr * DlpVi * inv_exp_ovun2;
+
+    en_ov += e_ov = sum_ovun1 * CEover1;
+
+    CEover2 = sum_ovun1 * DlpVi * inv_exp_ovun2 *
+      (1.0 - Delta_lpcorr * ( DlpVi + p_ovun2 * exp_ovun2 * inv_exp_ovun2 ));
+
+    CEover3 = CEover2 * (1.0 - dfvl * workspace->dDelta_lp[i] * inv_exp_ovun1 );
+
+    CEover4 = CEover2 * (dfvl * workspace->Delta_lp_temp[i]) *
+      p_ovun4 * exp_ovun1 * SQR(inv_exp_ovun1);
+
+    // under-coordination potential
+
+    p_ovun5 = sbp_i->p_ovun5;
+
+    exp_ovun2n = 1.0 / exp_ovun2;
+    exp_ovun6 = exp( p_ovun6 * Delta_lpcorr );
+    exp_ovun8 = p_ovun7 * exp(p_ovun8 * sum_ovun2);
+    inv_exp_ovun2n = 1.0 / (1.0 + exp_ovun2n);
+    inv_exp_ovun8 = 1.0 / (1.0 + exp_ovun8);
+
+    numbonds = End_Index(i, bonds) - Start_Index(i, bonds);
+    e_un = 0.0;
+
+    if (numbonds > 0)
+      en_un += e_un =
+        -p_ovun5 * (1.0 - exp_ovun6) * inv_exp_ovun2n * inv_exp_ovun8;
+
+    CEunder1 = inv_exp_ovun2n *
+      ( p_ovun5 * p_ovun6 * exp_ovun6 * inv_exp_ovun8 +
+        p_ovun2 * e_un * exp_ovun2n );
+    CEunder2 = -e_un * p_ovun8 * exp_ovun8 * inv_exp_ovun8;
+    CEunder3 = CEunder1 * (1.0 - dfvl*workspace->dDelta_lp[i]*inv_exp_ovun1);
+    CEunder4 = CEunder1 * (dfvl*workspace->Delta_lp_temp[i]) *
+      p_ovun4 * exp_ovun1 * SQR(inv_exp_ovun1) + CEunder2;
+
+    if (evflag) {
+      eng_tmp = e_ov;
+      if (numbonds > 0) eng_tmp += e_un;
+      ev_tally_thr(this,i,i,natoms,1,eng_tmp,0.0,0.0,0.0,0.0,0.0,thr);
+    }
+
+    // forces
+
+    CdDelta[i] += CEover3;   // OvCoor - 2nd term
+    if (numbonds > 0) CdDelta[i] += CEunder3;  // UnCoor - 1st term
+
+    for( pj = Start_Index(i, bonds); pj < End_Index(i, bonds); ++pj ) {
+      pbond = &(bonds->select.bond_list[pj]);
+      j = pbond->nbr;
+      bo_ij = &(pbond->bo_data);
+      twbp  = &(system->reax_param.tbp[ my_atoms[i].type ]
+                [my_atoms[pbond->nbr].type]);
+
+      bo_ij->Cdbo += CEover1 * twbp->p_ovun1 * twbp->De_s;// OvCoor-1st
+      CdDelta[j] += CEover4 * (1.0 - dfvl*workspace->dDelta_lp[j]) *
+        (bo_ij->BO_pi + bo_ij->BO_pi2); // OvCoor-3a
+      bo_ij->Cdbopi += CEover4 *
+        (workspace->Delta[j] - dfvl*workspace->Delta_lp_temp[j]); // OvCoor-3b
+      bo_ij->Cdbopi2 += CEover4 *
+        (workspace->Delta[j] - dfvl*workspace->Delta_lp_temp[j]);  // OvCoor-3b
+
+      CdDelta[j] += CEunder4 * (1.0 - dfvl*workspace->dDelta_lp[j]) *
+        (bo_ij->BO_pi + bo_ij->BO_pi2);   // UnCoor - 2a
+      bo_ij->Cdbopi += CEunder4 *
+        (workspace->Delta[j] - dfvl*workspace->Delta_lp_temp[j]);  // UnCoor-2b
+      bo_ij->Cdbopi2 += CEunder4 *
+        (workspace->Delta[j] - dfvl*workspace->Delta_lp_temp[j]);  // UnCoor-2b
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   hydrogen bonds X-H...Z centered on local hydrogens ifrom to ito-1
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::hydrogen_bonds_thr(int ifrom, int ito, double &en_hb,
+                                      ThrData * const thr)
+{
+  int  i, j, k, pi, pk;
+  int  type_i, type_j, type_k;
+  int  start_j, end_j, hb_start_j, hb_end_j;
+  int  hblist[MAX_BONDS];
+  int  itr, top;
+  double r_jk, theta, cos_theta, sin_xhz4, cos_xhz1, sin_theta2;
+  double e_hb, exp_hb2, exp_hb3, CEhb1, CEhb2, CEhb3;
+  rvec dcos_theta_di, dcos_theta_dj, dcos_theta_dk;
+  rvec dvec_jk;
+  hbond_parameters *hbp;
+  bond_order_data *bo_ij;
+  bond_data *pbond_ij;
+  far_neighbor_data *nbr_jk;
+
+  // tally variables
+  double fi_tmp[3], fk_tmp[3], delij[3], delkj[3];
+
+  rvec * const f = (rvec *) thr->get_f()[0];
+  reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const bonds = lists + BONDS;
+  reax_list * const hbonds = lists + HBONDS;
+  bond_data * const bond_list = bonds->select.bond_list;
+  hbond_data * const hbond_list = hbonds->select.hbond_list;
+  const int evflag_thr = evflag || vflag_atom;
+
+  for( j = ifrom; j < ito; ++j )
+    if( system->reax_param.sbp[my_atoms[j].type].p_hbond == 1 ) {
+      type_j     = my_atoms[j].type;
+      start_j    = Start_Index(j, bonds);
+      end_j      = End_Index(j, bonds);
+      hb_start_j = Start_Index( my_atoms[j].Hindex, hbonds );
+      hb_end_j   = End_Index( my_atoms[j].Hindex, hbonds );
+      if (type_j < 0) continue;
+
+      top = 0;
+      for( pi = start_j; pi < end_j; ++pi )  {
+        pbond_ij = &( bond_list[pi] );
+        i = pbond_ij->nbr;
+        type_i = my_atoms[i].type;
+        if (type_i < 0) continue;
+        bo_ij = &(pbond_ij->bo_data);
+
+        if( system->reax_param.sbp[type_i].p_hbond == 2 &&
+            bo_ij->BO >= HB_THRESHOLD )
+          hblist[top++] = pi;
+      }
+
+      for( pk = hb_start_j; pk < hb_end_j; ++pk ) {
+        k = hbond_list[pk].nbr;
+        type_k = my_atoms[k].type;
+        if (type_k < 0) continue;
+        nbr_jk = hbond_list[pk].ptr;
+        r_jk = nbr_jk->d;
+        rvec_Scale( dvec_jk, hbond_list[pk].scl, nbr_jk->dvec );
+
+        for( itr = 0; itr < top; ++itr ) {
+          pi = hblist[itr];
+          pbond_ij = &( bond_list[pi] );
+          i = pbond_ij->nbr;
+
+          if( my_atoms[i].orig_id != my_atoms[k].orig_id ) {
+            bo_ij = &(pbond_ij->bo_data);
+            type_i = my_atoms[i].type;
+            if (type_i < 0) continue;
+            hbp = &(system->reax_param.hbp[ type_i ][ type_j ][ type_k ]);
+            if (hbp->r0_hb <= 0.0) continue;
+
+            Calculate_Theta( pbond_ij->dvec, pbond_ij->d, dvec_jk, r_jk,
+                             &theta, &cos_theta );
+            Calculate_dCos_Theta( pbond_ij->dvec, pbond_ij->d, dvec_jk, r_jk,
+                                  &dcos_theta_di, &dcos_theta_dj,
+                                  &dcos_theta_dk );
+
+            // hydrogen bond energy
+
+            sin_theta2 = sin( theta/2.0 );
+            sin_xhz4 = SQR(sin_theta2);
+            sin_xhz4 *= sin_xhz4;
+            cos_xhz1 = ( 1.0 - cos_theta );
+            exp_hb2 = exp( -hbp->p_hb2 * bo_ij->BO );
+            exp_hb3 = exp( -hbp->p_hb3 * ( hbp->r0_hb / r_jk +
+                                           r_jk / hbp->r0_hb - 2.0 ) );
+
+            en_hb += e_hb =
+              hbp->p_hb1 * (1.0 - exp_hb2) * exp_hb3 * sin_xhz4;
+
+            CEhb1 = hbp->p_hb1 * hbp->p_hb2 * exp_hb2 * exp_hb3 * sin_xhz4;
+            CEhb2 = -hbp->p_hb1/2.0 * (1.0 - exp_hb2) * exp_hb3 * cos_xhz1;
+            CEhb3 = -hbp->p_hb3 *
+              (-hbp->r0_hb / SQR(r_jk) + 1.0 / hbp->r0_hb) * e_hb;
+
+            // hydrogen bond forces, bond i-j belongs to j
+
+            bo_ij->Cdbo += CEhb1;
+
+            rvec_ScaledAdd( f[i], -CEhb2, dcos_theta_di );
+            rvec_ScaledAdd( f[j], -CEhb2, dcos_theta_dj );
+            rvec_ScaledAdd( f[k], -CEhb2, dcos_theta_dk );
+            rvec_ScaledAdd( f[j], CEhb3/r_jk, dvec_jk );
+            rvec_ScaledAdd( f[k], -CEhb3/r_jk, dvec_jk );
+
+            if (evflag_thr) {
+              rvec_ScaledSum( delij, 1., my_atoms[j].x,
+                                    -1., my_atoms[i].x );
+              rvec_ScaledSum( delkj, 1., my_atoms[j].x,
+                                     -1., my_atoms[k].x );
+
+              rvec_Scale(fi_tmp, CEhb2, dcos_theta_di);
+              rvec_Scale(fk_tmp, CEhb2, dcos_theta_dk);
+              rvec_ScaledAdd(fk_tmp, CEhb3/r_jk, dvec_jk);
+
+              ev_tally3_thr(this,i,j,k,e_hb,0.0,fi_tmp,fk_tmp,delij,delkj,thr);
+            }
+          }
+        }
+      }
+    }
+}
+
+/* ----------------------------------------------------------------------
+   valence angle, penalty and coalition energy of all angles i-j-k,
+   also builds the three-body list used by the torsions.
+   all threads first count the entries per central atom j, so each
+   thread can fill in its part of the list at the same offsets the
+   serial code would use.
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::valence_angles_thr(int nthreads, double &en_ang,
+                                      double &en_pen, double &en_coa,
+                                      ThrData * const thr)
+{
+  int ifrom, ito, tid;
+  int i, j, pi, k, pk, t;
+  int type_i, type_j, type_k;
+  int start_j, end_j, start_pk, end_pk;
+  int cnt, num, nvalid, num_thb_intrs;
+
+  double temp, temp_bo_jt, pBOjt7;
+  double p_val1, p_val2, p_val3, p_val4, p_val5;
+  double p_val6, p_val7, p_val8, p_val9, p_val10;
+  double p_pen1, p_pen2, p_pen3, p_pen4;
+  double p_coa1, p_coa2, p_coa3, p_coa4;
+  double trm8, expval6, expval7, expval2theta, expval12theta, exp3ij, exp3jk;
+  double exp_pen2ij, exp_pen2jk, exp_pen3, exp_pen4, trm_pen34, exp_coa2;
+  double dSBO1, dSBO2, SBO, SBO2, CSBO2, SBOp, prod_SBO, vlpadj;
+  double CEval1, CEval2, CEval3, CEval4, CEval5, CEval6, CEval7, CEval8;
+  double CEpen1, CEpen2, CEpen3;
+  double e_ang, e_coa, e_pen;
+  double CEcoa1, CEcoa2, CEcoa3, CEcoa4, CEcoa5;
+  double Cf7ij, Cf7jk, Cf8j, Cf9j;
+  double f7_ij, f7_jk, f8_Dj, f9_Dj;
+  double Ctheta_0, theta_0, theta_00, theta, cos_theta, sin_theta;
+  double BOA_ij, BOA_jk;
+
+  // tallying variables
+  double eng_tmp, fi_tmp[3], fk_tmp[3];
+  double delij[3], delkj[3];
+
+  three_body_header *thbh;
+  three_body_parameters *thbp;
+  three_body_interaction_data *p_ijk, *p_kji;
+  bond_data *pbond_ij, *pbond_jk, *pbond_jt;
+  bond_order_data *bo_ij, *bo_jk, *bo_jt;
+
+  rvec * const f = (rvec *) thr->get_f()[0];
+  double * const CdDelta = cddelta_thr + thr->get_tid()*system->N;
+  reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const bonds = lists + BONDS;
+  reax_list * const thb_intrs = lists + THREE_BODIES;
+  const int nall = system->N;
+  const int natoms = system->n;
+  const int evflag_thr = evflag || vflag_atom;
+
+  p_val6 = system->reax_param.gp.l[14];
+  p_val8 = system->reax_param.gp.l[33];
+  p_val9 = system->reax_param.gp.l[16];
+  p_val10 = system->reax_param.gp.l[17];
+
+  loop_setup_thr(ifrom, ito, tid, nall, nthreads);
+
+  // bond j-i with a large enough bond order gets a new entry for every
+  // later bond of j and a copy for every earlier bond of j with a list
+
+  for( j = ifrom; j < ito; ++j ) {
+    num = 0;
+    if (my_atoms[j].type >= 0) {
+      start_j = Start_Index(j, bonds);
+      end_j = End_Index(j, bonds);
+      nvalid = 0;
+      for( pi = start_j; pi < end_j; ++pi ) {
+        pbond_ij = &(bonds->select.bond_list[pi]);
+        BOA_ij = pbond_ij->bo_data.BO - control->thb_cut;
+        if( BOA_ij > 0.0 && ( j < natoms || pbond_ij->nbr < natoms ) ) {
+          num += nvalid + (end_j - pi - 1);
+          ++nvalid;
+        }
+      }
+    }
+    num_thb[j] = num;
+  }
+
+  sync_threads();
+
+#if defined(_OPENMP)
+#pragma omp master
+#endif
+  {
+    num = 0;
+    for( j = 0; j < nall; ++j ) {
+      cnt = num_thb[j];
+      num_thb[j] = num;
+      num += cnt;
+    }
+    num_thb[nall] = num;
+
+    if( num >= thb_intrs->num_intrs * DANGER_ZONE ) {
+      workspace->realloc.num_3body = num;
+      if( num > thb_intrs->num_intrs )
+        error->one(FLERR,"Ran out of space on ReaxFF angle list");
+    }
+  }
+
+  sync_threads();
+
+  for( j = ifrom; j < ito; ++j ) {
+    type_j = my_atoms[j].type;
+    start_j = Start_Index(j, bonds);
+    end_j = End_Index(j, bonds);
+    num_thb_intrs = num_thb[j];
+
+    if (type_j < 0) {
+      for( pi = start_j; pi < end_j; ++pi ) {
+        Set_Start_Index( pi, num_thb_intrs, thb_intrs );
+        Set_End_Index( pi, num_thb_intrs, thb_intrs );
+      }
+      continue;
+    }
+
+    p_val3 = system->reax_param.sbp[ type_j ].p_val3;
+    p_val5 = system->reax_param.sbp[ type_j ].p_val5;
+
+    SBOp = 0, prod_SBO = 1;
+    for( t = start_j; t < end_j; ++t ) {
+      bo_jt = &(bonds->select.bond_list[t].bo_data);
+      SBOp += (bo_jt->BO_pi + bo_jt->BO_pi2);
+      temp = SQR( bo_jt->BO );
+      temp *= temp;
+      temp *= temp;
+      prod_SBO *= exp( -temp );
+    }
+
+    if( workspace->vlpex[j] >= 0 ){
+      vlpadj = 0;
+      dSBO2 = prod_SBO - 1;
+    }
+    else{
+      vlpadj = workspace->nlp[j];
+      dSBO2 = (prod_SBO - 1) * (1 - p_val8 * workspace->dDelta_lp[j]);
+    }
+
+    SBO = SBOp + (1 - prod_SBO) * (-workspace->Delta_boc[j] - p_val8 * vlpadj);
+    dSBO1 = -8 * prod_SBO * ( workspace->Delta_boc[j] + p_val8 * vlpadj );
+
+    if( SBO <= 0 )
+      SBO2 = 0, CSBO2 = 0;
+    else if( SBO > 0 && SBO <= 1 ) {
+        SBO2 = pow( SBO, p_val9 );
+        CSBO2 = p_val9 * pow( SBO, p_val9 - 1 );
+    }
+    else if( SBO > 1 && SBO < 2 ) {
+      SBO2 = 2 - pow( 2-SBO, p_val9 );
+      CSBO2 = p_val9 * pow( 2 - SBO, p_val9 - 1 );
+    }
+    else
+      SBO2 = 2, CSBO2 = 0;
+
+    expval6 = exp( p_val6 * workspace->Delta_boc[j] );
+
+    for( pi = start_j; pi < end_j; ++pi ) {
+      Set_Start_Index( pi, num_thb_intrs, thb_intrs );
+      pbond_ij = &(bonds->select.bond_list[pi]);
+      bo_ij = &(pbond_ij->bo_data);
+      BOA_ij = bo_ij->BO - control->thb_cut;
+
+      if( BOA_ij > 0.0 &&
+          ( j < natoms || pbond_ij->nbr < natoms ) ) {
+        i = pbond_ij->nbr;
+        type_i = my_atoms[i].type;
+
+        for( pk = start_j; pk < pi; ++pk ) {
+          start_pk = Start_Index( pk, thb_intrs );
+          end_pk = End_Index( pk, thb_intrs );
+
+          for( t = start_pk; t < end_pk; ++t )
+            if( thb_intrs->select.three_body_list[t].thb == i ) {
+              p_ijk = &(thb_intrs->select.three_body_list[num_thb_intrs] );
+              p_kji = &(thb_intrs->select.three_body_list[t]);
+
+              p_ijk->thb = bonds->select.bond_list[pk].nbr;
+              p_ijk->pthb  = pk;
+              p_ijk->theta = p_kji->theta;
+              rvec_Copy( p_ijk->dcos_di, p_kji->dcos_dk );
+              rvec_Copy( p_ijk->dcos_dj, p_kji->dcos_dj );
+              rvec_Copy( p_ijk->dcos_dk, p_kji->dcos_di );
+
+              ++num_thb_intrs;
+              break;
+            }
+        }
+
+        for( pk = pi+1; pk < end_j; ++pk ) {
+          pbond_jk = &(bonds->select.bond_list[pk]);
+          bo_jk    = &(pbond_jk->bo_data);
+          BOA_jk   = bo_jk->BO - control->thb_cut;
+          k        = pbond_jk->nbr;
+          type_k   = my_atoms[k].type;
+          p_ijk    = &( thb_intrs->select.three_body_list[num_thb_intrs] );
+
+          Calculate_Theta( pbond_ij->dvec, pbond_ij->d,
+                           pbond_jk->dvec, pbond_jk->d,
+                           &theta, &cos_theta );
+
+          Calculate_dCos_Theta( pbond_ij->dvec, pbond_ij->d,
+                                pbond_jk->dvec, pbond_jk->d,
+                                &(p_ijk->dcos_di), &(p_ijk->dcos_dj),
+                                &(p_ijk->dcos_dk) );
+          p_ijk->thb = k;
+          p_ijk->pthb = pk;
+          p_ijk->theta = theta;
+
+          sin_theta = sin( theta );
+          if( sin_theta < 1.0e-5 )
+            sin_theta = 1.0e-5;
+
+          ++num_thb_intrs;
+
+          if( (j < natoms) && (BOA_jk > 0.0) &&
+              (bo_ij->BO > control->thb_cut) &&
+              (bo_jk->BO > control->thb_cut) &&
+              (bo_ij->BO * bo_jk->BO > control->thb_cutsq) ) {
+            thbh = &( system->reax_param.thbp[ type_i ][ type_j ][ type_k ] );
+
+            for( cnt = 0; cnt < thbh->cnt; ++cnt ) {
+              if( fabs(thbh->prm[cnt].p_val1) > 0.001 ) {
+                thbp = &( thbh->prm[cnt] );
+
+                // angle energy
+
+                p_val1 = thbp->p_val1;
+                p_val2 = thbp->p_val2;
+                p_val4 = thbp->p_val4;
+                p_val7 = thbp->p_val7;
+                theta_00 = thbp->theta_00;
+
+                exp3ij = exp( -p_val3 * pow( BOA_ij, p_val4 ) );
+                f7_ij = 1.0 - exp3ij;
+                Cf7ij = p_val3 * p_val4 * pow( BOA_ij, p_val4 - 1.0 ) * exp3ij;
+
+                exp3jk = exp( -p_val3 * pow( BOA_jk, p_val4 ) );
+                f7_jk = 1.0 - exp3jk;
+                Cf7jk = p_val3 * p_val4 * pow( BOA_jk, p_val4 - 1.0 ) * exp3jk;
+
+                expval7 = exp( -p_val7 * workspace->Delta_boc[j] );
+                trm8 = 1.0 + expval6 + expval7;
+                f8_Dj = p_val5 - ( (p_val5 - 1.0) * (2.0 + expval6) / trm8 );
+                Cf8j = ( (1.0 - p_val5) / SQR(trm8) ) *
+                  ( p_val6 * expval6 * trm8 -
+                    (2.0 + expval6) * ( p_val6*expval6 - p_val7*expval7 ) );
+
+                theta_0 = 180.0 - theta_00 * (1.0 -
+                                              exp(-p_val10 * (2.0 - SBO2)));
+                theta_0 = DEG2RAD( theta_0 );
+
+                expval2theta  = exp( -p_val2 * SQR(theta_0 - theta) );
+                if( p_val1 >= 0 )
+                  expval12theta = p_val1 * (1.0 - expval2theta);
+                else // To avoid linear Me-H-Me angles (6/6/06)
+                  expval12theta = p_val1 * -expval2theta;
+
+                CEval1 = Cf7ij * f7_jk * f8_Dj * expval12theta;
+                CEval2 = Cf7jk * f7_ij * f8_Dj * expval12theta;
+                CEval3 = Cf8j  * f7_ij * f7_jk * expval12theta;
+                CEval4 = -2.0 * p_val1 * p_val2 * f7_ij * f7_jk * f8_Dj *
+                  expval2theta * (theta_0 - theta);
+
+                Ctheta_0 = p_val10 * DEG2RAD(theta_00) *
+                  exp( -p_val10 * (2.0 - SBO2) );
+
+                CEval5 = -CEval4 * Ctheta_0 * CSBO2;
+                CEval6 = CEval5 * dSBO1;
+                CEval7 = CEval5 * dSBO2;
+                CEval8 = -CEval4 / sin_theta;
+
+                en_ang += e_ang =
+                  f7_ij * f7_jk * f8_Dj * expval12theta;
+
+                // penalty energy
+
+                p_pen1 = thbp->p_pen1;
+                p_pen2 = system->reax_param.gp.l[19];
+                p_pen3 = system->reax_param.gp.l[20];
+                p_pen4 = system->reax_param.gp.l[21];
+
+                exp_pen2ij = exp( -p_pen2 * SQR( BOA_ij - 2.0 ) );
+                exp_pen2jk = exp( -p_pen2 * SQR( BOA_jk - 2.0 ) );
+                exp_pen3 = exp( -p_pen3 * workspace->Delta[j] );
+                exp_pen4 = exp(  p_pen4 * workspace->Delta[j] );
+                trm_pen34 = 1.0 + exp_pen3 + exp_pen4;
+                f9_Dj = ( 2.0 + exp_pen3 ) / trm_pen34;
+                Cf9j = ( -p_pen3 * exp_pen3 * trm_pen34 -
+                         (2.0 + exp_pen3) * ( -p_pen3 * exp_pen3 +
+                                              p_pen4 * exp_pen4 ) ) /
+                  SQR( trm_pen34 );
+
+                en_pen += e_pen =
+                  p_pen1 * f9_Dj * exp_pen2ij * exp_pen2jk;
+
+                CEpen1 = e_pen * Cf9j / f9_Dj;
+                temp   = -2.0 * p_pen2 * e_pen;
+                CEpen2 = temp * (BOA_ij - 2.0);
+                CEpen3 = temp * (BOA_jk - 2.0);
+
+                // coalition energy
+
+                p_coa1 = thbp->p_coa1;
+                p_coa2 = system->reax_param.gp.l[2];
+                p_coa3 = system->reax_param.gp.l[38];
+                p_coa4 = system->reax_param.gp.l[30];
+
+                exp_coa2 = exp( p_coa2 * workspace->Delta_val[j] );
+                en_coa += e_coa =
+                  p_coa1 / (1. + exp_coa2) *
+                  exp( -p_coa3 * SQR(workspace->total_bond_order[i]-BOA_ij) ) *
+                  exp( -p_coa3 * SQR(workspace->total_bond_order[k]-BOA_jk) ) *
+                  exp( -p_coa4 * SQR(BOA_ij - 1.5) ) *
+                  exp( -p_coa4 * SQR(BOA_jk - 1.5) );
+
+                CEcoa1 = -2 * p_coa4 * (BOA_ij - 1.5) * e_coa;
+                CEcoa2 = -2 * p_coa4 * (BOA_jk - 1.5) * e_coa;
+                CEcoa3 = -p_coa2 * exp_coa2 * e_coa / (1 + exp_coa2);
+                CEcoa4 = -2 * p_coa3 *
+                  (workspace->total_bond_order[i]-BOA_ij) * e_coa;
+                CEcoa5 = -2 * p_coa3 *
+                  (workspace->total_bond_order[k]-BOA_jk) * e_coa;
+
+                // forces, all bonds j-t belong to j
+
+                bo_ij->Cdbo += (CEval1 + CEpen2 + (CEcoa1 - CEcoa4));
+                bo_jk->Cdbo += (CEval2 + CEpen3 + (CEcoa2 - CEcoa5));
+                CdDelta[j] += ((CEval3 + CEval7) + CEpen1 + CEcoa3);
+                CdDelta[i] += CEcoa4;
+                CdDelta[k] += CEcoa5;
+
+                for( t = start_j; t < end_j; ++t ) {
+                  pbond_jt = &( bonds->select.bond_list[t] );
+                  bo_jt = &(pbond_jt->bo_data);
+                  temp_bo_jt = bo_jt->BO;
+                  temp = CUBE( temp_bo_jt );
+                  pBOjt7 = temp * temp * temp_bo_jt;
+
+                  bo_jt->Cdbo += (CEval6 * pBOjt7);
+                  bo_jt->Cdbopi += CEval5;
+                  bo_jt->Cdbopi2 += CEval5;
+                }
+
+                rvec_ScaledAdd( f[i], -CEval8, p_ijk->dcos_di );
+                rvec_ScaledAdd( f[j], -CEval8, p_ijk->dcos_dj );
+                rvec_ScaledAdd( f[k], -CEval8, p_ijk->dcos_dk );
+
+                if (evflag_thr) {
+                  rvec_ScaledSum( delij, 1., my_atoms[i].x,
+                                        -1., my_atoms[j].x );
+                  rvec_ScaledSum( delkj, 1., my_atoms[k].x,
+                                        -1., my_atoms[j].x );
+
+                  rvec_Scale( fi_tmp, -CEval8, p_ijk->dcos_di );
+                  rvec_Scale( fk_tmp, -CEval8, p_ijk->dcos_dk );
+
+                  eng_tmp = e_ang + e_pen + e_coa;
+
+                  if (evflag)
+                    ev_tally_thr(this,j,j,nall,1,eng_tmp,0.0,0.0,0.0,0.0,0.0,thr);
+                  if (vflag_atom)
+                    v_tally3_thr(i,j,k,fi_tmp,fk_tmp,delij,delkj,thr);
+                }
+              }
+            }
+          }
+        }
+      }
+
+      Set_End_Index( pi, num_thb_intrs, thb_intrs );
+    }
+  }
+
+  sync_threads();
+}
+
+/* ----------------------------------------------------------------------
+   torsion and four-body conjugation energy of all dihedrals i-j-k-l
+   with a local atom j, ifrom <= j < ito. bond k-l belongs to k,
+   so its Cdbo term goes to the per-thread accumulator.
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::torsion_angles_thr(int ifrom, int ito, double &en_tor,
+                                      double &en_con, ThrData * const thr)
+{
+  int i, j, k, l, pi, pj, pk, pl, pij, plk, natoms;
+  int type_i, type_j, type_k, type_l;
+  int start_j, end_j;
+  int start_pj, end_pj, start_pk, end_pk;
+
+  double Delta_j, Delta_k;
+  double r_ij, r_jk, r_kl, r_li;
+  double BOA_ij, BOA_jk, BOA_kl;
+
+  double exp_tor2_ij, exp_tor2_jk, exp_tor2_kl;
+  double exp_tor1, exp_tor3_DjDk, exp_tor4_DjDk, exp_tor34_inv;
+  double exp_cot2_jk, exp_cot2_ij, exp_cot2_kl;
+  double fn10, f11_DjDk, dfn11, fn12;
+  double theta_ijk, theta_jkl;
+  double sin_ijk, sin_jkl;
+  double cos_ijk, cos_jkl;
+  double tan_ijk_i, tan_jkl_i;
+  double omega, cos_omega, cos2omega, cos3omega;
+  rvec dcos_omega_di, dcos_omega_dj, dcos_omega_dk, dcos_omega_dl;
+  double CV, cmn, CEtors1, CEtors2, CEtors3, CEtors4;
+  double CEtors5, CEtors6, CEtors7, CEtors8, CEtors9;
+  double Cconj, CEconj1, CEconj2, CEconj3;
+  double CEconj4, CEconj5, CEconj6;
+  double e_tor, e_con;
+  rvec dvec_li;
+  four_body_header *fbh;
+  four_body_parameters *fbp;
+  bond_data *pbond_ij, *pbond_jk, *pbond_kl;
+  bond_order_data *bo_ij, *bo_jk, *bo_kl;
+  three_body_interaction_data *p_ijk, *p_jkl;
+
+  // virial tallying variables
+  double delil[3], deljl[3], delkl[3];
+  double eng_tmp, fi_tmp[3], fj_tmp[3], fk_tmp[3];
+
+  rvec * const f = (rvec *) thr->get_f()[0];
+  reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const bonds = lists + BONDS;
+  reax_list * const thb_intrs = lists + THREE_BODIES;
+  double * const CdDelta = cddelta_thr + thr->get_tid()*system->N;
+  double * const Cdbo = cdbo_thr + thr->get_tid()*bonds->num_intrs;
+  const double p_tor2 = system->reax_param.gp.l[23];
+  const double p_tor3 = system->reax_param.gp.l[24];
+  const double p_tor4 = system->reax_param.gp.l[25];
+  const double p_cot2 = system->reax_param.gp.l[27];
+  const int evflag_thr = evflag || vflag_atom;
+
+  natoms = system->n;
+
+  for( j = ifrom; j < ito; ++j ) {
+    type_j = my_atoms[j].type;
+    Delta_j = workspace->Delta_boc[j];
+    start_j = Start_Index(j, bonds);
+    end_j = End_Index(j, bonds);
+
+    for( pk = start_j; pk < end_j; ++pk ) {
+      pbond_jk = &( bonds->select.bond_list[pk] );
+      k = pbond_jk->nbr;
+      bo_jk = &( pbond_jk->bo_data );
+      BOA_jk = bo_jk->BO - control->thb_cut;
+
+      if( my_atoms[j].orig_id > my_atoms[k].orig_id )
+        continue;
+      if( my_atoms[j].orig_id == my_atoms[k].orig_id ) {
+        if (my_atoms[k].x[2] <  my_atoms[j].x[2]) continue;
+        if (my_atoms[k].x[2] == my_atoms[j].x[2] &&
+            my_atoms[k].x[1] <  my_atoms[j].x[1]) continue;
+        if (my_atoms[k].x[2] == my_atoms[j].x[2] &&
+            my_atoms[k].x[1] == my_atoms[j].x[1] &&
+            my_atoms[k].x[0] <  my_atoms[j].x[0]) continue;
+      }
+
+      if( bo_jk->BO > control->thb_cut && Num_Entries(pk, thb_intrs) ) {
+        pj = pbond_jk->sym_index; // pj points to j on k's list
+
+        if( Num_Entries(pj, thb_intrs) ) {
+          type_k = my_atoms[k].type;
+          Delta_k = workspace->Delta_boc[k];
+          r_jk = pbond_jk->d;
+
+          start_pk = Start_Index(pk, thb_intrs );
+          end_pk = End_Index(pk, thb_intrs );
+          start_pj = Start_Index(pj, thb_intrs );
+          end_pj = End_Index(pj, thb_intrs );
+
+          exp_tor2_jk = exp( -p_tor2 * BOA_jk );
+          exp_cot2_jk = exp( -p_cot2 * SQR(BOA_jk - 1.5) );
+          exp_tor3_DjDk = exp( -p_tor3 * (Delta_j + Delta_k) );
+          exp_tor4_DjDk = exp( p_tor4  * (Delta_j + Delta_k) );
+          exp_tor34_inv = 1.0 / (1.0 + exp_tor3_DjDk + exp_tor4_DjDk);
+          f11_DjDk = (2.0 + exp_tor3_DjDk) * exp_tor34_inv;
+
+          for( pi = start_pk; pi < end_pk; ++pi ) {
+            p_ijk = &( thb_intrs->select.three_body_list[pi] );
+            pij = p_ijk->pthb; // pij is pointer to i on j's bond_list
+            pbond_ij = &( bonds->select.bond_list[pij] );
+            bo_ij = &( pbond_ij->bo_data );
+
+            if( bo_ij->BO > control->thb_cut ) {
+              i = p_ijk->thb;
+              type_i = my_atoms[i].type;
+              r_ij = pbond_ij->d;
+              BOA_ij = bo_ij->BO - control->thb_cut;
+
+              theta_ijk = p_ijk->theta;
+              sin_ijk = sin( theta_ijk );
+              cos_ijk = cos( theta_ijk );
+              if( sin_ijk >= 0 && sin_ijk <= MIN_SINE )
+                tan_ijk_i = cos_ijk / MIN_SINE;
+              else if( sin_ijk <= 0 && sin_ijk >= -MIN_SINE )
+                tan_ijk_i = cos_ijk / -MIN_SINE;
+              else tan_ijk_i = cos_ijk / sin_ijk;
+
+              exp_tor2_ij = exp( -p_tor2 * BOA_ij );
+              exp_cot2_ij = exp( -p_cot2 * SQR(BOA_ij -1.5) );
+
+              for( pl = start_pj; pl < end_pj; ++pl ) {
+                p_jkl = &( thb_intrs->select.three_body_list[pl] );
+                l = p_jkl->thb;
+                plk = p_jkl->pthb; //pointer to l on k's bond_list!
+                pbond_kl = &( bonds->select.bond_list[plk] );
+                bo_kl = &( pbond_kl->bo_data );
+                type_l = my_atoms[l].type;
+                fbh = &(system->reax_param.fbp[type_i][type_j]
+                        [type_k][type_l]);
+                fbp = &(system->reax_param.fbp[type_i][type_j]
+                        [type_k][type_l].prm[0]);
+
+                if( i != l && fbh->cnt &&
+                    bo_kl->BO > control->thb_cut &&
+                    bo_ij->BO * bo_jk->BO * bo_kl->BO > control->thb_cut ){
+                  r_kl = pbond_kl->d;
+                  BOA_kl = bo_kl->BO - control->thb_cut;
+
+                  theta_jkl = p_jkl->theta;
+                  sin_jkl = sin( theta_jkl );
+                  cos_jkl = cos( theta_jkl );
+                  if( sin_jkl >= 0 && sin_jkl <= MIN_SINE )
+                    tan_jkl_i = cos_jkl / MIN_SINE;
+                  else if( sin_jkl <= 0 && sin_jkl >= -MIN_SINE )
+                    tan_jkl_i = cos_jkl / -MIN_SINE;
+                  else tan_jkl_i = cos_jkl /sin_jkl;
+
+                  rvec_ScaledSum( dvec_li, 1., my_atoms[i].x,
+                                  -1., my_atoms[l].x );
+                  r_li = rvec_Norm( dvec_li );
+
+                  // omega and its derivative
+
+                  omega = Calculate_Omega( pbond_ij->dvec, r_ij,
+                                           pbond_jk->dvec, r_jk,
+                                           pbond_kl->dvec, r_kl,
+                                           dvec_li, r_li,
+                                           p_ijk, p_jkl,
+                                           dcos_omega_di, dcos_omega_dj,
+                                           dcos_omega_dk, dcos_omega_dl,
+                                           out_control );
+
+                  cos_omega = cos( omega );
+                  cos2omega = cos( 2. * omega );
+                  cos3omega = cos( 3. * omega );
+
+                  // torsion energy
+
+                  exp_tor1 = exp( fbp->p_tor1 *
+                                  SQR(2.0 - bo_jk->BO_pi - f11_DjDk) );
+                  exp_tor2_kl = exp( -p_tor2 * BOA_kl );
+                  exp_cot2_kl = exp( -p_cot2 * SQR(BOA_kl - 1.5) );
+                  fn10 = (1.0 - exp_tor2_ij) * (1.0 - exp_tor2_jk) *
+                    (1.0 - exp_tor2_kl);
+
+                  CV = 0.5 * ( fbp->V1 * (1.0 + cos_omega) +
+                               fbp->V2 * exp_tor1 * (1.0 - cos2omega) +
+                               fbp->V3 * (1.0 + cos3omega) );
+
+                  en_tor += e_tor = fn10 * sin_ijk * sin_jkl * CV;
+
+                  dfn11 = (-p_tor3 * exp_tor3_DjDk +
+                           (p_tor3 * exp_tor3_DjDk - p_tor4 * exp_tor4_DjDk) *
+                           (2.0 + exp_tor3_DjDk) * exp_tor34_inv) *
+                    exp_tor34_inv;
+
+                  CEtors1 = sin_ijk * sin_jkl * CV;
+
+                  CEtors2 = -fn10 * 2.0 * fbp->p_tor1 * fbp->V2 * exp_tor1 *
+                    (2.0 - bo_jk->BO_pi - f11_DjDk) * (1.0 - SQR(cos_omega)) *
+                    sin_ijk * sin_jkl;
+                  CEtors3 = CEtors2 * dfn11;
+
+                  CEtors4 = CEtors1 * p_tor2 * exp_tor2_ij *
+                    (1.0 - exp_tor2_jk) * (1.0 - exp_tor2_kl);
+                  CEtors5 = CEtors1 * p_tor2 *
+                    (1.0 - exp_tor2_ij) * exp_tor2_jk * (1.0 - exp_tor2_kl);
+                  CEtors6 = CEtors1 * p_tor2 *
+                    (1.0 - exp_tor2_ij) * (1.0 - exp_tor2_jk) * exp_tor2_kl;
+
+                  cmn = -fn10 * CV;
+                  CEtors7 = cmn * sin_jkl * tan_ijk_i;
+                  CEtors8 = cmn * sin_ijk * tan_jkl_i;
+
+                  CEtors9 = fn10 * sin_ijk * sin_jkl *
+                    (0.5 * fbp->V1 - 2.0 * fbp->V2 * exp_tor1 * cos_omega +
+                     1.5 * fbp->V3 * (cos2omega + 2.0 * SQR(cos_omega)));
+
+                  // 4-body conjugation energy
+
+                  fn12 = exp_cot2_ij * exp_cot2_jk * exp_cot2_kl;
+                  en_con += e_con =
+                    fbp->p_cot1 * fn12 *
+                    (1.0 + (SQR(cos_omega) - 1.0) * sin_ijk * sin_jkl);
+
+                  Cconj = -2.0 * fn12 * fbp->p_cot1 * p_cot2 *
+                    (1.0 + (SQR(cos_omega) - 1.0) * sin_ijk * sin_jkl);
+
+                  CEconj1 = Cconj * (BOA_ij - 1.5e0);
+                  CEconj2 = Cconj * (BOA_jk - 1.5e0);
+                  CEconj3 = Cconj * (BOA_kl - 1.5e0);
+
+                  CEconj4 = -fbp->p_cot1 * fn12 *
+                    (SQR(cos_omega) - 1.0) * sin_jkl * tan_ijk_i;
+                  CEconj5 = -fbp->p_cot1 * fn12 *
+                    (SQR(cos_omega) - 1.0) * sin_ijk * tan_jkl_i;
+                  CEconj6 = 2.0 * fbp->p_cot1 * fn12 *
+                    cos_omega * sin_ijk * sin_jkl;
+
+                  // forces
+
+                  bo_jk->Cdbopi += CEtors2;
+                  CdDelta[j] += CEtors3;
+                  CdDelta[k] += CEtors3;
+                  bo_ij->Cdbo += (CEtors4 + CEconj1);
+                  bo_jk->Cdbo += (CEtors5 + CEconj2);
+                  Cdbo[plk] += (CEtors6 + CEconj3);
+
+                  // dcos_theta_ijk
+                  rvec_ScaledAdd( f[i], -(CEtors7 + CEconj4), p_ijk->dcos_dk );
+                  rvec_ScaledAdd( f[j], -(CEtors7 + CEconj4), p_ijk->dcos_dj );
+                  rvec_ScaledAdd( f[k], -(CEtors7 + CEconj4), p_ijk->dcos_di );
+
+                  // dcos_theta_jkl
+                  rvec_ScaledAdd( f[j], -(CEtors8 + CEconj5), p_jkl->dcos_di );
+                  rvec_ScaledAdd( f[k], -(CEtors8 + CEconj5), p_jkl->dcos_dj );
+                  rvec_ScaledAdd( f[l], -(CEtors8 + CEconj5), p_jkl->dcos_dk );
+
+                  // dcos_omega
+                  rvec_ScaledAdd( f[i], -(CEtors9 + CEconj6), dcos_omega_di );
+                  rvec_ScaledAdd( f[j], -(CEtors9 + CEconj6), dcos_omega_dj );
+                  rvec_ScaledAdd( f[k], -(CEtors9 + CEconj6), dcos_omega_dk );
+                  rvec_ScaledAdd( f[l], -(CEtors9 + CEconj6), dcos_omega_dl );
+
+                  if (evflag_thr) {
+                    rvec_ScaledSum( delil, 1., my_atoms[l].x,
+                                          -1., my_atoms[i].x );
+                    rvec_ScaledSum( deljl, 1., my_atoms[l].x,
+                                          -1., my_atoms[j].x );
+                    rvec_ScaledSum( delkl, 1., my_atoms[l].x,
+                                          -1., my_atoms[k].x );
+
+                    rvec_Scale( fi_tmp, CEtors7 + CEconj4, p_ijk->dcos_dk );
+                    rvec_Scale( fj_tmp, CEtors7 + CEconj4, p_ijk->dcos_dj );
+                    rvec_Scale( fk_tmp, CEtors7 + CEconj4, p_ijk->dcos_di );
+
+                    rvec_ScaledAdd( fj_tmp, CEtors8 + CEconj5, p_jkl->dcos_di );
+                    rvec_ScaledAdd( fk_tmp, CEtors8 + CEconj5, p_jkl->dcos_dj );
+
+                    rvec_ScaledAdd( fi_tmp, CEtors9 + CEconj6, dcos_omega_di );
+                    rvec_ScaledAdd( fj_tmp, CEtors9 + CEconj6, dcos_omega_dj );
+                    rvec_ScaledAdd( fk_tmp, CEtors9 + CEconj6, dcos_omega_dk );
+
+                    eng_tmp = e_tor + e_con;
+                    if (evflag)
+                      ev_tally_thr(this,j,k,natoms,1,eng_tmp,0.0,0.0,0.0,0.0,0.0,thr);
+                    if (vflag_atom)
+                      v_tally4_thr(i,j,k,l,fi_tmp,fj_tmp,fk_tmp,
+                                   delil,deljl,delkl,thr);
+                  }
+                } // pl check ends
+              } // pl loop ends
+            } // pi check ends
+          } // pi loop ends
+        } // k-j neighbor check ends
+      } // j-k neighbor check ends
+    } // pk loop ends
+  } // j loop
+}
+
+/* ----------------------------------------------------------------------
+   add the per-thread CdDelta and Cdbo terms, then the forces from the
+   bond order derivatives of all bonds i-j with i < j
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::total_force_thr(int nthreads, ThrData * const thr)
+{
+  int ifrom, ito, bfrom, bto, tid;
+  int i, pj;
+
+  reax_list * const bonds = lists + BONDS;
+  bond_data * const bond_list = bonds->select.bond_list;
+  const int nall = system->N;
+  const int nbonds = bonds->num_intrs;
+
+  loop_setup_thr(ifrom, ito, tid, nall, nthreads);
+  loop_setup_thr(bfrom, bto, tid, nbonds, nthreads);
+
+  data_reduce_thr(cddelta_thr, nall, nthreads, 1, tid);
+  data_reduce_thr(cdbo_thr, nbonds, nthreads, 1, tid);
+  sync_threads();
+
+  for( i = ifrom; i < ito; ++i ) {
+    workspace->CdDelta[i] += cddelta_thr[i];
+    cddelta_thr[i] = 0.0;
+  }
+
+  for( pj = bfrom; pj < bto; ++pj ) {
+    bond_list[pj].bo_data.Cdbo += cdbo_thr[pj];
+    cdbo_thr[pj] = 0.0;
+  }
+
+  sync_threads();
+
+  for( i = ifrom; i < ito; ++i )
+    for( pj = Start_Index(i, bonds); pj < End_Index(i, bonds); ++pj )
+      if( i < bond_list[pj].nbr )
+        add_dbond_thr(i, pj, thr);
+}
+
+/* ----------------------------------------------------------------------
+   forces on i, j, and their bonded neighbors from the derivatives of
+   the bond order of bond i-j
+------------------------------------------------------------------------- */
+
+void PairReaxCOMP::add_dbond_thr(int i, int pj, ThrData * const thr)
+{
+  bond_data *nbr_j, *nbr_k;
+  bond_order_data *bo_ij, *bo_ji;
+  dbond_coefficients coef;
+  int pk, k, j;
+
+  // virial tallying variables
+  rvec fi_tmp, fj_tmp, fk_tmp, delij, delji, delki, delkj, temp;
+
+  rvec * const f = (rvec *) thr->get_f()[0];
+  reax_atom * const my_atoms = system->my_atoms;
+  reax_list * const bonds = lists + BONDS;
+
+  nbr_j = &(bonds->select.bond_list[pj]);
+  j = nbr_j->nbr;
+  bo_ij = &(nbr_j->bo_data);
+  bo_ji = &(bonds->select.bond_list[ nbr_j->sym_index ].bo_data);
+
+  coef.C1dbo = bo_ij->C1dbo * (bo_ij->Cdbo + bo_ji->Cdbo);
+  coef.C2dbo = bo_ij->C2dbo * (bo_ij->Cdbo + bo_ji->Cdbo);
+  coef.C3dbo = bo_ij->C3dbo * (bo_ij->Cdbo + bo_ji->Cdbo);
+
+  coef.C1dbopi = bo_ij->C1dbopi * (bo_ij->Cdbopi + bo_ji->Cdbopi);
+  coef.C2dbopi = bo_ij->C2dbopi * (bo_ij->Cdbopi + bo_ji->Cdbopi);
+  coef.C3dbopi = bo_ij->C3dbopi * (bo_ij->Cdbopi + bo_ji->Cdbopi);
+  coef.C4dbopi = bo_ij->C4dbopi * (bo_ij->Cdbopi + bo_ji->Cdbopi);
+
+  coef.C1dbopi2 = bo_ij->C1dbopi2 * (bo_ij->Cdbopi2 + bo_ji->Cdbopi2);
+  coef.C2dbopi2 = bo_ij->C2dbopi2 * (bo_ij->Cdbopi2 + bo_ji->Cdbopi2);
+  coef.C3dbopi2 = bo_ij->C3dbopi2 * (bo_ij->Cdbopi2 + bo_ji->Cdbopi2);
+  coef.C4dbopi2 = bo_ij->C4dbopi2 * (bo_ij->Cdbopi2 + bo_ji->Cdbopi2);
+
+  coef.C1dDelta = bo_ij->C1dbo * (workspace->CdDelta[i]+workspace->CdDelta[j]);
+  coef.C2dDelta = bo_ij->C2dbo * (workspace->CdDelta[i]+workspace->CdDelta[j]);
+  coef.C3dDelta = bo_ij->C3dbo * (workspace->CdDelta[i]+workspace->CdDelta[j]);
+
+  // forces on i
+
+  rvec_Scale(     temp, coef.C1dbo,    bo_ij->dBOp );
+  rvec_ScaledAdd( temp, coef.C2dbo,    workspace->dDeltap_self[i] );
+  rvec_ScaledAdd( temp, coef.C1dDelta, bo_ij->dBOp );
+  rvec_ScaledAdd( temp, coef.C2dDelta, workspace->dDeltap_self[i] );
+  rvec_ScaledAdd( temp, coef.C1dbopi,  bo_ij->dln_BOp_pi );
+  rvec_ScaledAdd( temp, coef.C2dbopi,  bo_ij->dBOp );
+  rvec_ScaledAdd( temp, coef.C3dbopi,  workspace->dDeltap_self[i]);
+  rvec_ScaledAdd( temp, coef.C1dbopi2, bo_ij->dln_BOp_pi2 );
+  rvec_ScaledAdd( temp, coef.C2dbopi2, bo_ij->dBOp );
+  rvec_ScaledAdd( temp, coef.C3dbopi2, workspace->dDeltap_self[i] );
+  rvec_ScaledAdd( f[i], -1.0, temp );
+
+  if (vflag_atom) {
+    rvec_Scale( fi_tmp, -1.0, temp );
+    rvec_ScaledSum( delij, 1., my_atoms[i].x, -1., my_atoms[j].x );
+    v_tally_thr(i, fi_tmp, delij, thr);
+  }
+
+  // forces on j
+
+  rvec_Scale(     temp, -coef.C1dbo,    bo_ij->dBOp );
+  rvec_ScaledAdd( temp,  coef.C3dbo,    workspace->dDeltap_self[j] );
+  rvec_ScaledAdd( temp, -coef.C1dDelta, bo_ij->dBOp );
+  rvec_ScaledAdd( temp,  coef.C3dDelta, workspace->dDeltap_self[j]);
+  rvec_ScaledAdd( temp, -coef.C1dbopi,  bo_ij->dln_BOp_pi );
+  rvec_ScaledAdd( temp, -coef.C2dbopi,  bo_ij->dBOp );
+  rvec_ScaledAdd( temp,  coef.C4dbopi,  workspace->dDeltap_self[j]);
+  rvec_ScaledAdd( temp, -coef.C1dbopi2, bo_ij->dln_BOp_pi2 );
+  rvec_ScaledAdd( temp, -coef.C2dbopi2, bo_ij->dBOp );
+  rvec_ScaledAdd( temp,  coef.C4dbopi2, workspace->dDeltap_self[j]);
+  rvec_ScaledAdd( f[j], -1.0, temp );
+
+  if (vflag_atom) {
+    rvec_Scale( fj_tmp, -1.0, temp );
+    rvec_ScaledSum( delji, 1., my_atoms[j].x, -1., my_atoms[i].x );
+    v_tally_thr(j, fj_tmp, delji, thr);
+  }
+
+  // forces on k: i neighbor
+
+  for( pk = Start_Index(i, bonds); pk < End_Index(i, bonds); ++pk ) {
+    nbr_k = &(bonds->select.bond_list[pk]);
+    k = nbr_k->nbr;
+
+    rvec_Scale(     temp, -coef.C2dbo,    nbr_k->bo_data.dBOp);
+    rvec_ScaledAdd( temp, -coef.C2dDelta, nbr_k->bo_data.dBOp);
+    rvec_ScaledAdd( temp, -coef.C3dbopi,  nbr_k->bo_data.dBOp);
+    rvec_ScaledAdd( temp, -coef.C3dbopi2, nbr_k->bo_data.dBOp);
+    rvec_ScaledAdd( f[k], -1.0, temp );
+
+    if (vflag_atom) {
+      rvec_Scale( fk_tmp, -1.0, temp );
+      rvec_ScaledSum( delki, 1., my_atoms[k].x, -1., my_atoms[i].x );
+      v_tally_thr(k, fk_tmp, delki, thr);
+      rvec_ScaledSum( delkj, 1., my_atoms[k].x, -1., my_atoms[j].x );
+      v_tally_thr(k, fk_tmp, delkj, thr);
+    }
+  }
+
+  // forces on k: j neighbor
+
+  for( pk = Start_Index(j, bonds); pk < End_Index(j, bonds); ++pk ) {
+    nbr_k = &(bonds->select.bond_list[pk]);
+    k = nbr_k->nbr;
+
+    rvec_Scale(     temp, -coef.C3dbo,    nbr_k->bo_data.dBOp );
+    rvec_ScaledAdd( temp, -coef.C3dDelta, nbr_k->bo_data.dBOp);
+    rvec_ScaledAdd( temp, -coef.C4dbopi,  nbr_k->bo_data.dBOp);
+    rvec_ScaledAdd( temp, -coef.C4dbopi2, nbr_k->bo_data.dBOp);
+    rvec_ScaledAdd( f[k], -1.0, temp );
+
+    if (vflag_atom) {
+      rvec_Scale( fk_tmp, -1.0, temp );
+      rvec_ScaledSum( delki, 1., my_atoms[k].x, -1., my_atoms[i].x );
+      v_tally_thr(k, fk_tmp, delki, thr);
+      rvec_ScaledSum( delkj, 1., my_atoms[k].x, -1., my_atoms[j].x );
+      v_tally_thr(k, fk_tmp, delkj, thr);
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairReaxCOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairReaxC::memory_usage();
+  bytes += nmax_far * sizeof(int);
+  bytes += nmax_thb * sizeof(int);
+  bytes += maxcddelta * sizeof(double);
+  bytes += maxcdbo * sizeof(double);
+
+  return bytes;
+}
@@ -0,0 +1,78 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(reax/c/omp,PairReaxCOMP)
+
+#else
+
+#ifndef LMP_PAIR_REAXC_OMP_H
+#define LMP_PAIR_REAXC_OMP_H
+
+#include "pair_reax_c.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairReaxCOMP : public PairReaxC, public ThrOMP {
+
+ public:
+  PairReaxCOMP(class LAMMPS *);
+  virtual ~PairReaxCOMP();
+
+  virtual void compute(int, int);
+  virtual double memory_usage();
+
+ protected:
+  int *num_far;                 // per atom far neighbor counts
+  int nmax_far;                 // allocated size of num_far
+  int *num_thb;                 // per atom three-body list offsets
+  int nmax_thb;                 // allocated size of num_thb
+  double *cddelta_thr;          // per thread CdDelta terms of all atoms
+  int maxcddelta;               // allocated size of cddelta_thr
+  double *cdbo_thr;             // per thread Cdbo terms of all bonds
+  int maxcdbo;                  // allocated size of cdbo_thr
+
+  virtual int write_reax_lists();
+
+ private:
+  void nonbonded_thr(int, int, double &, double &, ThrData * const);
+  void nonbonded_tabulated_thr(int, int, double &, double &, ThrData * const);
+  void bond_orders_thr(int);
+  void bonds_thr(int, int, double &, ThrData * const);
+  void atom_energy_thr(int, int, double &, double &, double &,
+                       ThrData * const);
+  void hydrogen_bonds_thr(int, int, double &, ThrData * const);
+  void valence_angles_thr(int, double &, double &, double &,
+                          ThrData * const);
+  void torsion_angles_thr(int, int, double &, double &, ThrData * const);
+  void total_force_thr(int, ThrData * const);
+  void add_dbond_thr(int, int, ThrData * const);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Ran out of space on ReaxFF angle list
+
+The three-body list of the valence angle terms is too small for the
+current configuration. It is enlarged on the next step, but this step
+cannot be completed. Try increasing the safezone keyword of the
+pair_style command.
+
+*/
@@ -1142,6 +1142,27 @@ void ThrOMP::ev_tally_thr(Improper * const imprp, const int i1, const int i2,
   }
 }
 
+/* ----------------------------------------------------------------------
+   tally virial into per-atom accumulators
+   called by ReaxFF potential, newton_pair is always on
+   fi is force on atom I, deli is its displacement
+------------------------------------------------------------------------- */
+
+void ThrOMP::v_tally_thr(const int i, const double * const fi,
+                         const double * const deli, ThrData * const thr)
+{
+  double v[6];
+
+  v[0] = 0.5*deli[0]*fi[0];
+  v[1] = 0.5*deli[1]*fi[1];
+  v[2] = 0.5*deli[2]*fi[2];
+  v[3] = 0.5*deli[0]*fi[1];
+  v[4] = 0.5*deli[0]*fi[2];
+  v[5] = 0.5*deli[1]*fi[2];
+
+  v_tally(thr->vatom_pair[i],v);
+}
+
 /* ----------------------------------------------------------------------
    tally virial into per-atom accumulators
    called by AIREBO potential, newton_pair is always on
@@ -158,6 +158,7 @@ class ThrOMP {
                     const double, ThrData * const);
 
   // style independent versions
+  void v_tally_thr(const int, const double * const, const double * const, ThrData * const);
   void v_tally2_thr(const int, const int, const double, const double * const, ThrData * const);
   void v_tally3_thr(const int, const int, const int, const double * const, const double * const,
                     const double * const, const double * const, ThrData * const);
@@ -337,7 +337,7 @@ void FixPhonon::end_of_step()
   double xcur[3];
 
   // to get the current temperature
-  if (!(temperature->invoked_flag & INVOKED_VECTOR)) temperature->compute_vector();
+  if (!(temperature->invoked_flag & INVOKED_VECTOR)) temperature->invoke_vector();
   for (idim = 0; idim < sysdim; ++idim) TempSum[idim] += temperature->vector[idim];
 
   // evaluate R(r) on local proc
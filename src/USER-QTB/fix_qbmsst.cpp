@@ -428,8 +428,8 @@ void FixQBMSST::setup(int vflag)
 {
   lagrangian_position = 0.0;
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   couple();
   velocity_sum = compute_vsum();
 
@@ -464,7 +464,7 @@ void FixQBMSST::setup(int vflag)
 
   }
 
-  temperature->compute_vector();
+  temperature->invoke_vector();
   double *ke_tensor = temperature->vector;
   double ke_temp = ke_tensor[0]+ke_tensor[1]+ke_tensor[2];
   if (ke_temp > 0.0 && tscale > 0.0 ) {
@@ -527,8 +527,8 @@ void FixQBMSST::initial_integrate(int vflag)
   check_alloc(nlocal);
 
   // compute new pressure and volume.
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   couple();
   vol = compute_vol();
 
@@ -750,9 +750,9 @@ void FixQBMSST::final_integrate()
 
   // compute new pressure and volume.
 
-  temperature->compute_vector();
+  temperature->invoke_vector();
 
-  pressure->compute_vector();
+  pressure->invoke_vector();
   couple();
   velocity_sum = compute_vsum();
   vol = compute_vol();
@@ -947,8 +947,8 @@ double FixQBMSST::compute_scalar()
 {
   // compute new pressure and volume.
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   couple();
 
   double volume = compute_vol();
@@ -997,8 +997,8 @@ double FixQBMSST::compute_hugoniot()
 
   e = compute_etotal();
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   p = pressure->vector[direction];
 
   v = compute_vol();
@@ -1019,8 +1019,8 @@ double FixQBMSST::compute_rayleigh()
   double v, p;
   double drayleigh;
 
-  temperature->compute_vector();
-  pressure->compute_vector();
+  temperature->invoke_vector();
+  pressure->invoke_vector();
   p = pressure->vector[direction];
 
   v = compute_vol();
@@ -1058,9 +1058,9 @@ double FixQBMSST::compute_lagrangian_position()
 double FixQBMSST::compute_etotal()
 {
   double epot,ekin,etot;
-  epot = pe->compute_scalar();
+  epot = pe->invoke_scalar();
   if (thermo_energy) epot -= compute_scalar();
-  ekin = temperature->compute_scalar();
+  ekin = temperature->invoke_scalar();
   ekin *= 0.5 * temperature->dof * force->boltz;
   etot = epot+ekin;
   return etot;
@@ -1072,9 +1072,9 @@ double FixQBMSST::compute_etotal()
 double FixQBMSST::compute_egrand()
 {
   double epot,ekin,etot;
-  epot = pe->compute_scalar();
+  epot = pe->invoke_scalar();
   if (!thermo_energy) epot += compute_scalar();
-  ekin = temperature->compute_scalar();
+  ekin = temperature->invoke_scalar();
   ekin *= 0.5 * temperature->dof * force->boltz;
   etot = epot+ekin;
   return etot;
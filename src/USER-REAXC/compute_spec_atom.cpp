@@ -46,6 +46,8 @@ ComputeSpecAtom::ComputeSpecAtom(LAMMPS *lmp, int narg, char **arg) :
   reaxc = (PairReaxC *) force->pair_match("reax/c",1);
   if (reaxc == NULL)
     reaxc = (PairReaxC *) force->pair_match("reax/c/kk",1);
+  if (reaxc == NULL)
+    reaxc = (PairReaxC *) force->pair_match("reax/c/omp",1);
 
   pack_choice = new FnPtrPack[nvalues];
 
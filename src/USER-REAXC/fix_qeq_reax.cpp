@@ -50,6 +50,21 @@ using namespace FixConst;
 #define CUBE(x) ((x)*(x)*(x))
 #define MIN_NBRS 100
 
+/* ----------------------------------------------------------------------
+   extrapolate initial guess from the last order+1 solutions in hist
+   order 2 and 3 are the quadratic and cubic forms used by PuReMD
+------------------------------------------------------------------------- */
+
+static inline double extrapolate(double *hist, int order)
+{
+  if (order == 1) return 2.0*hist[0] - hist[1];
+  if (order == 2) return hist[2] + 3.0*(hist[0] - hist[1]);
+  if (order == 3) return 4.0*(hist[0] + hist[2]) - (6.0*hist[1] + hist[3]);
+  if (order == 4) return 5.0*(hist[0] - hist[3]) + 10.0*(hist[2] - hist[1])
+                    + hist[4];
+  return hist[0];
+}
+
 static const char cite_fix_qeq_reax[] =
   "fix qeq/reax command:\n\n"
   "@Article{Aktulga12,\n"
@@ -68,7 +83,7 @@ FixQEqReax::FixQEqReax(LAMMPS *lmp, int narg, char **arg) :
 {
   if (lmp->citeme) lmp->citeme->add(cite_fix_qeq_reax);
 
-  if (narg != 8) error->all(FLERR,"Illegal fix qeq/reax command");
+  if (narg < 8) error->all(FLERR,"Illegal fix qeq/reax command");
 
   nevery = force->inumeric(FLERR,arg[3]);
   if (nevery <= 0) error->all(FLERR,"Illegal fix qeq/reax command");
@@ -78,7 +93,49 @@ FixQEqReax::FixQEqReax(LAMMPS *lmp, int narg, char **arg) :
   tolerance = force->numeric(FLERR,arg[6]);
   pertype_parameters(arg[7]);
 
+  // optional keywords
+
+  dualflag = 0;
+  pipeflag = 0;
+  extrap_s = 3;
+  extrap_t = 2;
+  ntab = 0;
+
+  int iarg = 8;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"dual") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix qeq/reax command");
+      if (strcmp(arg[iarg+1],"yes") == 0) dualflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) dualflag = 0;
+      else error->all(FLERR,"Illegal fix qeq/reax command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"solver") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix qeq/reax command");
+      if (strcmp(arg[iarg+1],"cg") == 0) pipeflag = 0;
+      else if (strcmp(arg[iarg+1],"pipe") == 0) pipeflag = 1;
+      else error->all(FLERR,"Illegal fix qeq/reax command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"extrap") == 0) {
+      if (iarg+3 > narg) error->all(FLERR,"Illegal fix qeq/reax command");
+      extrap_s = force->inumeric(FLERR,arg[iarg+1]);
+      extrap_t = force->inumeric(FLERR,arg[iarg+2]);
+      if (extrap_s < 0 || extrap_s > 4 || extrap_t < 0 || extrap_t > 4)
+        error->all(FLERR,"Illegal fix qeq/reax command");
+      iarg += 3;
+    } else if (strcmp(arg[iarg],"table") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix qeq/reax command");
+      ntab = force->inumeric(FLERR,arg[iarg+1]);
+      if (ntab < 0) error->all(FLERR,"Illegal fix qeq/reax command");
+      iarg += 2;
+    } else error->all(FLERR,"Illegal fix qeq/reax command");
+  }
+
+  if (dualflag && pipeflag)
+    error->all(FLERR,"Fix qeq/reax dual and solver pipe "
+               "cannot be used together");
+
   shld = NULL;
+  htab = NULL;
 
   n = n_cap = 0;
   N = nmax = 0;
@@ -99,6 +156,11 @@ FixQEqReax::FixQEqReax(LAMMPS *lmp, int narg, char **arg) :
   q = NULL;
   r = NULL;
   d = NULL;
+  p2 = NULL;
+  q2 = NULL;
+  r2 = NULL;
+  d2 = NULL;
+  z = NULL;
 
   // H matrix
   H.firstnbr = NULL;
@@ -106,7 +168,14 @@ FixQEqReax::FixQEqReax(LAMMPS *lmp, int narg, char **arg) :
   H.jlist = NULL;
   H.val = NULL;
 
-  comm_forward = comm_reverse = 1;
+  Hpat.firstnbr = NULL;
+  Hpat.numnbrs = NULL;
+  Hpat.jlist = NULL;
+  Hpat.val = NULL;
+  m_pat = 0;
+  pattern_build = -1;
+
+  comm_forward = comm_reverse = 2;
 
   // perform initial allocation of atom-based arrays
   // register with Atom class
@@ -120,6 +189,8 @@ FixQEqReax::FixQEqReax(LAMMPS *lmp, int narg, char **arg) :
 
   reaxc = NULL;
   reaxc = (PairReaxC *) force->pair_match("reax/c",1);
+  if (reaxc == NULL)
+    reaxc = (PairReaxC *) force->pair_match("reax/c/omp",1);
 
 }
 
@@ -140,6 +211,7 @@ FixQEqReax::~FixQEqReax()
   deallocate_matrix();
 
   memory->destroy(shld);
+  memory->destroy(htab);
 
   if (!reaxflag) {
     memory->destroy(chi);
@@ -168,6 +240,8 @@ void FixQEqReax::pertype_parameters(char *arg)
     Pair *pair = force->pair_match("reax/c",1);
     if (pair == NULL)
       pair = force->pair_match("reax/c/kk",1);
+    if (pair == NULL)
+      pair = force->pair_match("reax/c/omp",1);
 
     if (pair == NULL) error->all(FLERR,"No pair reax/c for fix qeq/reax");
     int tmp;
@@ -231,6 +305,14 @@ void FixQEqReax::allocate_storage()
   memory->create(q,nmax,"qeq:q");
   memory->create(r,nmax,"qeq:r");
   memory->create(d,nmax,"qeq:d");
+
+  if (dualflag) {
+    memory->create(p2,nmax,"qeq:p2");
+    memory->create(q2,nmax,"qeq:q2");
+    memory->create(r2,nmax,"qeq:r2");
+    memory->create(d2,nmax,"qeq:d2");
+  }
+  if (pipeflag) memory->create(z,nmax,"qeq:z");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -250,6 +332,12 @@ void FixQEqReax::deallocate_storage()
   memory->destroy( q );
   memory->destroy( r );
   memory->destroy( d );
+
+  memory->destroy( p2 );
+  memory->destroy( q2 );
+  memory->destroy( r2 );
+  memory->destroy( d2 );
+  memory->destroy( z );
 }
 
 /* ---------------------------------------------------------------------- */
@@ -307,6 +395,13 @@ void FixQEqReax::allocate_matrix()
   memory->create(H.numnbrs,n_cap,"qeq:H.numnbrs");
   memory->create(H.jlist,m_cap,"qeq:H.jlist");
   memory->create(H.val,m_cap,"qeq:H.val");
+
+  Hpat.n = n_cap;
+  Hpat.m = m_cap;
+  memory->create(Hpat.firstnbr,n_cap,"qeq:Hpat.firstnbr");
+  memory->create(Hpat.numnbrs,n_cap,"qeq:Hpat.numnbrs");
+  memory->create(Hpat.jlist,m_cap,"qeq:Hpat.jlist");
+  pattern_build = -1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -317,6 +412,10 @@ void FixQEqReax::deallocate_matrix()
   memory->destroy( H.numnbrs );
   memory->destroy( H.jlist );
   memory->destroy( H.val );
+
+  memory->destroy( Hpat.firstnbr );
+  memory->destroy( Hpat.numnbrs );
+  memory->destroy( Hpat.jlist );
 }
 
 /* ---------------------------------------------------------------------- */
@@ -354,6 +453,7 @@ void FixQEqReax::init()
 
   init_shielding();
   init_taper();
+  if (ntab) init_table();
 
   if (strstr(update->integrate_style,"respa"))
     nlevels_respa = ((Respa *) update->integrate)->nlevels;
@@ -412,6 +512,57 @@ void FixQEqReax::init_taper()
             7.0*swa*swb3*swb3 + swb3*swb3*swb ) / d7;
 }
 
+/* ----------------------------------------------------------------------
+   tabulate calculate_H() for each pair of types as cubic Hermite
+   polynomials on ntab intervals between 0 and swb
+------------------------------------------------------------------------- */
+
+void FixQEqReax::init_table()
+{
+  int i,j,m;
+  int ntypes = atom->ntypes;
+  double dr,r,r3,Taper,dTaper,denom,f[2],df[2];
+
+  memory->destroy(htab);
+  memory->create(htab,ntypes+1,ntypes+1,ntab,4,"qeq:htab");
+
+  dr = swb / ntab;
+  rdr_tab = 1.0 / dr;
+
+  for (i = 1; i <= ntypes; ++i)
+    for (j = 1; j <= ntypes; ++j)
+      for (m = 0; m < ntab; ++m) {
+        for (int k = 0; k < 2; ++k) {
+          r = (m+k) * dr;
+          r3 = r*r*r;
+
+          Taper = Tap[7] * r + Tap[6];
+          dTaper = 7.0*Tap[7] * r + 6.0*Tap[6];
+          Taper = Taper * r + Tap[5];
+          dTaper = dTaper * r + 5.0*Tap[5];
+          Taper = Taper * r + Tap[4];
+          dTaper = dTaper * r + 4.0*Tap[4];
+          Taper = Taper * r + Tap[3];
+          dTaper = dTaper * r + 3.0*Tap[3];
+          Taper = Taper * r + Tap[2];
+          dTaper = dTaper * r + 2.0*Tap[2];
+          Taper = Taper * r + Tap[1];
+          dTaper = dTaper * r + Tap[1];
+          Taper = Taper * r + Tap[0];
+
+          denom = pow(r3 + shld[i][j],0.3333333333333);
+          f[k] = Taper * EV_TO_KCAL_PER_MOL / denom;
+          df[k] = EV_TO_KCAL_PER_MOL / denom *
+            (dTaper - Taper * r*r / (r3 + shld[i][j])) * dr;
+        }
+
+        htab[i][j][m][0] = f[0];
+        htab[i][j][m][1] = df[0];
+        htab[i][j][m][2] = 3.0*(f[1]-f[0]) - 2.0*df[0] - df[1];
+        htab[i][j][m][3] = 2.0*(f[0]-f[1]) + df[0] + df[1];
+      }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixQEqReax::setup_pre_force(int vflag)
@@ -475,12 +626,20 @@ void FixQEqReax::pre_force(int vflag)
   // need to be atom->nmax in length
 
   if( atom->nmax > nmax ) reallocate_storage();
-  if( n > n_cap*DANGER_ZONE || m_fill > m_cap*DANGER_ZONE )
+  if( n > n_cap*DANGER_ZONE || m_fill > m_cap*DANGER_ZONE ||
+      m_pat > m_cap*DANGER_ZONE )
     reallocate_matrix();
 
   init_matvec();
-  matvecs = CG(b_s, s);    	// CG on s - parallel
-  matvecs += CG(b_t, t); 	// CG on t - parallel
+  if (dualflag) {
+    matvecs = dual_CG();        // fused CG on s & t - parallel
+  } else if (pipeflag) {
+    matvecs = CG_pipe(b_s, s);  // pipelined CG on s - parallel
+    matvecs += CG_pipe(b_t, t); // pipelined CG on t - parallel
+  } else {
+    matvecs = CG(b_s, s);    	// CG on s - parallel
+    matvecs += CG(b_t, t); 	// CG on t - parallel
+  }
   calculate_Q();
 
   if( comm->me == 0 ) {
@@ -530,36 +689,25 @@ void FixQEqReax::init_matvec()
       b_s[i]      = -chi[ atom->type[i] ];
       b_t[i]      = -1.0;
 
-      /* linear extrapolation for s & t from previous solutions */
-      //s[i] = 2 * s_hist[i][0] - s_hist[i][1];
-      //t[i] = 2 * t_hist[i][0] - t_hist[i][1];
-
-      /* quadratic extrapolation for s & t from previous solutions */
-      //s[i] = s_hist[i][2] + 3 * ( s_hist[i][0] - s_hist[i][1] );
-      t[i] = t_hist[i][2] + 3 * ( t_hist[i][0] - t_hist[i][1] );
-
-      /* cubic extrapolation for s & t from previous solutions */
-      s[i] = 4*(s_hist[i][0]+s_hist[i][2])-(6*s_hist[i][1]+s_hist[i][3]);
-      //t[i] = 4*(t_hist[i][0]+t_hist[i][2])-(6*t_hist[i][1]+t_hist[i][3]);
+      /* polynomial extrapolation for s & t from previous solutions */
+      s[i] = extrapolate( s_hist[i], extrap_s );
+      t[i] = extrapolate( t_hist[i], extrap_t );
     }
   }
 
-  pack_flag = 2;
-  comm->forward_comm_fix(this); //Dist_vector( s );
-  pack_flag = 3;
-  comm->forward_comm_fix(this); //Dist_vector( t );
+  pack_flag = 6;
+  comm->forward_comm_fix(this); //Dist_vector( s & t );
 }
 
 /* ---------------------------------------------------------------------- */
 
-void FixQEqReax::compute_H()
+void FixQEqReax::build_pattern()
 {
   int inum, jnum, *ilist, *jlist, *numneigh, **firstneigh;
   int i, j, ii, jj, flag;
   double **x, SMALL = 0.0001;
-  double dx, dy, dz, r_sqr;
+  double dx, dy, dz;
 
-  int *type = atom->type;
   tagint *tag = atom->tag;
   x = atom->x;
   int *mask = atom->mask;
@@ -576,41 +724,106 @@ void FixQEqReax::compute_H()
     firstneigh = list->firstneigh;
   }
 
-  // fill in the H matrix
-  m_fill = 0;
-  r_sqr = 0;
+  // keep every neighbor pair owned by i, regardless of distance,
+  // so the pattern stays valid until the next reneighboring
+
+  m_pat = 0;
   for( ii = 0; ii < inum; ii++ ) {
     i = ilist[ii];
     if (mask[i] & groupbit) {
       jlist = firstneigh[i];
       jnum = numneigh[i];
-      H.firstnbr[i] = m_fill;
+      Hpat.firstnbr[i] = m_pat;
 
       for( jj = 0; jj < jnum; jj++ ) {
         j = jlist[jj];
 
-        dx = x[j][0] - x[i][0];
-        dy = x[j][1] - x[i][1];
-        dz = x[j][2] - x[i][2];
-        r_sqr = SQR(dx) + SQR(dy) + SQR(dz);
-
         flag = 0;
-        if (r_sqr <= SQR(swb)) {
-          if (j < n) flag = 1;
-          else if (tag[i] < tag[j]) flag = 1;
-          else if (tag[i] == tag[j]) {
-            if (dz > SMALL) flag = 1;
-            else if (fabs(dz) < SMALL) {
-              if (dy > SMALL) flag = 1;
-              else if (fabs(dy) < SMALL && dx > SMALL)
-                flag = 1;
-	    }
-	  }
-	}
+        if (j < n) flag = 1;
+        else if (tag[i] < tag[j]) flag = 1;
+        else if (tag[i] == tag[j]) {
+          dx = x[j][0] - x[i][0];
+          dy = x[j][1] - x[i][1];
+          dz = x[j][2] - x[i][2];
+          if (dz > SMALL) flag = 1;
+          else if (fabs(dz) < SMALL) {
+            if (dy > SMALL) flag = 1;
+            else if (fabs(dy) < SMALL && dx > SMALL)
+              flag = 1;
+          }
+        }
 
         if( flag ) {
+          if (m_pat >= Hpat.m)
+            error->one(FLERR,"Fix qeq/reax has insufficient QEq matrix size");
+          Hpat.jlist[m_pat] = j;
+          m_pat++;
+        }
+      }
+      Hpat.numnbrs[i] = m_pat - Hpat.firstnbr[i];
+    }
+  }
+
+  pattern_build = neighbor->ncalls;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixQEqReax::compute_H()
+{
+  int inum, *ilist;
+  int i, j, ii, jj, jfrom, jto, itype, m;
+  double **x, *xi;
+  double dx, dy, dz, r_sqr, p, cutsq;
+  double *coeff;
+
+  int *type = atom->type;
+  x = atom->x;
+  int *mask = atom->mask;
+
+  if (reaxc) {
+    inum = reaxc->list->inum;
+    ilist = reaxc->list->ilist;
+  } else {
+    inum = list->inum;
+    ilist = list->ilist;
+  }
+
+  // candidate pairs only change when the neighbor lists are rebuilt
+
+  if (pattern_build != neighbor->ncalls) build_pattern();
+
+  // fill in the H matrix
+  m_fill = 0;
+  cutsq = SQR(swb);
+  for( ii = 0; ii < inum; ii++ ) {
+    i = ilist[ii];
+    if (mask[i] & groupbit) {
+      xi = x[i];
+      itype = type[i];
+      jfrom = Hpat.firstnbr[i];
+      jto = jfrom + Hpat.numnbrs[i];
+      H.firstnbr[i] = m_fill;
+
+      for( jj = jfrom; jj < jto; jj++ ) {
+        j = Hpat.jlist[jj];
+
+        dx = x[j][0] - xi[0];
+        dy = x[j][1] - xi[1];
+        dz = x[j][2] - xi[2];
+        r_sqr = SQR(dx) + SQR(dy) + SQR(dz);
+
+        if (r_sqr <= cutsq) {
           H.jlist[m_fill] = j;
-          H.val[m_fill] = calculate_H( sqrt(r_sqr), shld[type[i]][type[j]] );
+          if (ntab) {
+            p = sqrt(r_sqr) * rdr_tab;
+            m = static_cast<int> (p);
+            if (m >= ntab) m = ntab-1;
+            p -= m;
+            coeff = htab[itype][type[j]][m];
+            H.val[m_fill] = ((coeff[3]*p + coeff[2])*p + coeff[1])*p + coeff[0];
+          } else
+            H.val[m_fill] = calculate_H( sqrt(r_sqr), shld[itype][type[j]] );
           m_fill++;
         }
       }
@@ -718,6 +931,242 @@ int FixQEqReax::CG( double *b, double *x )
   return i;
 }
 
+/* ----------------------------------------------------------------------
+   Chronopoulos-Gear variant of preconditioned CG
+   the two dot products of an iteration are combined into one reduction
+------------------------------------------------------------------------- */
+
+int FixQEqReax::CG_pipe( double *b, double *x )
+{
+  int  i, j, imax;
+  double alpha, beta, b_norm, delta;
+  double sig_old, sig_new;
+  double my_buf[3], buf[3];
+
+  int nn, jj;
+  int *ilist;
+  if (reaxc) {
+    nn = reaxc->list->inum;
+    ilist = reaxc->list->ilist;
+  } else {
+    nn = list->inum;
+    ilist = list->ilist;
+  }
+
+  imax = 200;
+
+  pack_flag = 1;
+  sparse_matvec( &H, x, q );
+  comm->reverse_comm_fix( this ); //Coll_Vector( q );
+
+  vector_sum( r , 1.,  b, -1., q, nn );
+
+  for( jj = 0; jj < nn; ++jj ) {
+    j = ilist[jj];
+    if (atom->mask[j] & groupbit)
+      d[j] = r[j] * Hdia_inv[j]; //pre-condition
+  }
+
+  comm->forward_comm_fix(this); //Dist_vector( d );
+  sparse_matvec( &H, d, q );
+  comm->reverse_comm_fix(this); //Coll_vector( q );
+
+  my_buf[0] = my_buf[1] = my_buf[2] = 0.0;
+  for( jj = 0; jj < nn; ++jj ) {
+    j = ilist[jj];
+    if (atom->mask[j] & groupbit) {
+      my_buf[0] += b[j] * b[j];
+      my_buf[1] += r[j] * d[j];
+      my_buf[2] += q[j] * d[j];
+    }
+  }
+  MPI_Allreduce( my_buf, buf, 3, MPI_DOUBLE, MPI_SUM, world );
+
+  b_norm = sqrt( buf[0] );
+  sig_new = buf[1];
+  delta = buf[2];
+  alpha = sig_new / delta;
+
+  vector_sum( p, 1., d, 0., d, nn );
+  vector_sum( z, 1., q, 0., q, nn );
+
+  for( i = 1; i < imax && sqrt(sig_new) / b_norm > tolerance; ++i ) {
+    vector_add( x, alpha, p, nn );
+    vector_add( r, -alpha, z, nn );
+
+    // pre-conditioning
+    for( jj = 0; jj < nn; ++jj ) {
+      j = ilist[jj];
+      if (atom->mask[j] & groupbit)
+        d[j] = r[j] * Hdia_inv[j];
+    }
+
+    comm->forward_comm_fix(this); //Dist_vector( d );
+    sparse_matvec( &H, d, q );
+    comm->reverse_comm_fix(this); //Coll_vector( q );
+
+    my_buf[0] = my_buf[1] = 0.0;
+    for( jj = 0; jj < nn; ++jj ) {
+      j = ilist[jj];
+      if (atom->mask[j] & groupbit) {
+        my_buf[0] += r[j] * d[j];
+        my_buf[1] += q[j] * d[j];
+      }
+    }
+    MPI_Allreduce( my_buf, buf, 2, MPI_DOUBLE, MPI_SUM, world );
+
+    sig_old = sig_new;
+    sig_new = buf[0];
+    delta = buf[1];
+
+    beta = sig_new / sig_old;
+    alpha = sig_new / (delta - beta * sig_new / alpha);
+
+    vector_sum( p, 1., d, beta, p, nn );
+    vector_sum( z, 1., q, beta, z, nn );
+  }
+
+  if (i >= imax && comm->me == 0) {
+    char str[128];
+    sprintf(str,"Fix qeq/reax CG convergence failed after %d iterations "
+            "at " BIGINT_FORMAT " step",i,update->ntimestep);
+    error->warning(FLERR,str);
+  }
+
+  return i;
+}
+
+/* ----------------------------------------------------------------------
+   CG on s and t in a single loop
+   sharing the matrix sweep, the communication and the reductions
+   once one system has converged the other one is finished with CG()
+------------------------------------------------------------------------- */
+
+int FixQEqReax::dual_CG()
+{
+  int  i, j, imax;
+  double alpha[2], beta[2], b_norm[2];
+  double sig_old[2], sig_new[2];
+  double my_buf[4], buf[4];
+
+  int nn, jj;
+  int *ilist;
+  if (reaxc) {
+    nn = reaxc->list->inum;
+    ilist = reaxc->list->ilist;
+  } else {
+    nn = list->inum;
+    ilist = list->ilist;
+  }
+
+  imax = 200;
+
+  pack_flag = 5;
+  sparse_matvec_dual( &H, s, t, q, q2 );
+  comm->reverse_comm_fix( this ); //Coll_Vector( q & q2 );
+
+  vector_sum( r , 1.,  b_s, -1., q, nn );
+  vector_sum( r2 , 1.,  b_t, -1., q2, nn );
+
+  for( jj = 0; jj < nn; ++jj ) {
+    j = ilist[jj];
+    if (atom->mask[j] & groupbit) {
+      d[j] = r[j] * Hdia_inv[j]; //pre-condition
+      d2[j] = r2[j] * Hdia_inv[j];
+    }
+  }
+
+  my_buf[0] = my_buf[1] = my_buf[2] = my_buf[3] = 0.0;
+  for( jj = 0; jj < nn; ++jj ) {
+    j = ilist[jj];
+    if (atom->mask[j] & groupbit) {
+      my_buf[0] += b_s[j] * b_s[j];
+      my_buf[1] += b_t[j] * b_t[j];
+      my_buf[2] += r[j] * d[j];
+      my_buf[3] += r2[j] * d2[j];
+    }
+  }
+  MPI_Allreduce( my_buf, buf, 4, MPI_DOUBLE, MPI_SUM, world );
+
+  b_norm[0] = sqrt( buf[0] );
+  b_norm[1] = sqrt( buf[1] );
+  sig_new[0] = buf[2];
+  sig_new[1] = buf[3];
+
+  for( i = 1; i < imax; ++i ) {
+    if (sqrt(sig_new[0]) / b_norm[0] <= tolerance ||
+        sqrt(sig_new[1]) / b_norm[1] <= tolerance) break;
+
+    comm->forward_comm_fix(this); //Dist_vector( d & d2 );
+    sparse_matvec_dual( &H, d, d2, q, q2 );
+    comm->reverse_comm_fix(this); //Coll_vector( q & q2 );
+
+    my_buf[0] = my_buf[1] = 0.0;
+    for( jj = 0; jj < nn; ++jj ) {
+      j = ilist[jj];
+      if (atom->mask[j] & groupbit) {
+        my_buf[0] += d[j] * q[j];
+        my_buf[1] += d2[j] * q2[j];
+      }
+    }
+    MPI_Allreduce( my_buf, buf, 2, MPI_DOUBLE, MPI_SUM, world );
+
+    alpha[0] = sig_new[0] / buf[0];
+    alpha[1] = sig_new[1] / buf[1];
+
+    my_buf[0] = my_buf[1] = 0.0;
+    for( jj = 0; jj < nn; ++jj ) {
+      j = ilist[jj];
+      if (atom->mask[j] & groupbit) {
+        s[j] += alpha[0] * d[j];
+        t[j] += alpha[1] * d2[j];
+        r[j] -= alpha[0] * q[j];
+        r2[j] -= alpha[1] * q2[j];
+
+        // pre-conditioning
+        p[j] = r[j] * Hdia_inv[j];
+        p2[j] = r2[j] * Hdia_inv[j];
+
+        my_buf[0] += r[j] * p[j];
+        my_buf[1] += r2[j] * p2[j];
+      }
+    }
+    MPI_Allreduce( my_buf, buf, 2, MPI_DOUBLE, MPI_SUM, world );
+
+    sig_old[0] = sig_new[0];
+    sig_old[1] = sig_new[1];
+    sig_new[0] = buf[0];
+    sig_new[1] = buf[1];
+
+    beta[0] = sig_new[0] / sig_old[0];
+    beta[1] = sig_new[1] / sig_old[1];
+    vector_sum( d, 1., p, beta[0], d, nn );
+    vector_sum( d2, 1., p2, beta[1], d2, nn );
+  }
+
+  // finish the remaining system; its ghost values are stale
+
+  if (sqrt(sig_new[0]) / b_norm[0] > tolerance) {
+    pack_flag = 2;
+    comm->forward_comm_fix(this); //Dist_vector( s );
+    i += CG(b_s, s);
+  }
+  if (sqrt(sig_new[1]) / b_norm[1] > tolerance) {
+    pack_flag = 3;
+    comm->forward_comm_fix(this); //Dist_vector( t );
+    i += CG(b_t, t);
+  }
+
+  if (i >= imax && comm->me == 0) {
+    char str[128];
+    sprintf(str,"Fix qeq/reax CG convergence failed after %d iterations "
+            "at " BIGINT_FORMAT " step",i,update->ntimestep);
+    error->warning(FLERR,str);
+  }
+
+  return i;
+}
+
 
 /* ---------------------------------------------------------------------- */
 
@@ -762,6 +1211,58 @@ void FixQEqReax::sparse_matvec( sparse_matrix *A, double *x, double *b )
 
 }
 
+/* ----------------------------------------------------------------------
+   b1 = A x1 and b2 = A x2 with a single pass over the matrix
+------------------------------------------------------------------------- */
+
+void FixQEqReax::sparse_matvec_dual( sparse_matrix *A, double *x1, double *x2,
+                                     double *b1, double *b2 )
+{
+  int i, j, itr_j;
+  int nn, NN, ii;
+  int *ilist;
+  double eta_i, val;
+
+  if (reaxc) {
+    nn = reaxc->list->inum;
+    NN = reaxc->list->inum + reaxc->list->gnum;
+    ilist = reaxc->list->ilist;
+  } else {
+    nn = list->inum;
+    NN = list->inum + list->gnum;
+    ilist = list->ilist;
+  }
+
+  for( ii = 0; ii < nn; ++ii ) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      eta_i = eta[ atom->type[i] ];
+      b1[i] = eta_i * x1[i];
+      b2[i] = eta_i * x2[i];
+    }
+  }
+
+  for( ii = nn; ii < NN; ++ii ) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit)
+      b1[i] = b2[i] = 0;
+  }
+
+  for( ii = 0; ii < nn; ++ii ) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      for( itr_j=A->firstnbr[i]; itr_j<A->firstnbr[i]+A->numnbrs[i]; itr_j++) {
+        j = A->jlist[itr_j];
+        val = A->val[itr_j];
+        b1[i] += val * x1[j];
+        b2[i] += val * x2[j];
+        b1[j] += val * x1[i];
+        b2[j] += val * x2[i];
+      }
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixQEqReax::calculate_Q()
@@ -819,6 +1320,19 @@ int FixQEqReax::pack_forward_comm(int n, int *list, double *buf,
     for(m = 0; m < n; m++) buf[m] = t[list[m]];
   else if( pack_flag == 4 )
     for(m = 0; m < n; m++) buf[m] = atom->q[list[m]];
+  else if( pack_flag == 5 ) {
+    for(m = 0; m < n; m++) {
+      buf[2*m] = d[list[m]];
+      buf[2*m+1] = d2[list[m]];
+    }
+    return 2*n;
+  } else if( pack_flag == 6 ) {
+    for(m = 0; m < n; m++) {
+      buf[2*m] = s[list[m]];
+      buf[2*m+1] = t[list[m]];
+    }
+    return 2*n;
+  }
 
   return n;
 }
@@ -837,6 +1351,16 @@ void FixQEqReax::unpack_forward_comm(int n, int first, double *buf)
     for(m = 0, i = first; m < n; m++, i++) t[i] = buf[m];
   else if( pack_flag == 4)
     for(m = 0, i = first; m < n; m++, i++) atom->q[i] = buf[m];
+  else if( pack_flag == 5)
+    for(m = 0, i = first; m < n; m++, i++) {
+      d[i] = buf[2*m];
+      d2[i] = buf[2*m+1];
+    }
+  else if( pack_flag == 6)
+    for(m = 0, i = first; m < n; m++, i++) {
+      s[i] = buf[2*m];
+      t[i] = buf[2*m+1];
+    }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -844,6 +1368,13 @@ void FixQEqReax::unpack_forward_comm(int n, int first, double *buf)
 int FixQEqReax::pack_reverse_comm(int n, int first, double *buf)
 {
   int i, m;
+  if( pack_flag == 5) {
+    for(m = 0, i = first; m < n; m++, i++) {
+      buf[2*m] = q[i];
+      buf[2*m+1] = q2[i];
+    }
+    return 2*n;
+  }
   for(m = 0, i = first; m < n; m++, i++) buf[m] = q[i];
   return n;
 }
@@ -852,7 +1383,13 @@ int FixQEqReax::pack_reverse_comm(int n, int first, double *buf)
 
 void FixQEqReax::unpack_reverse_comm(int n, int *list, double *buf)
 {
-  for(int m = 0; m < n; m++) q[list[m]] += buf[m];
+  if( pack_flag == 5) {
+    for(int m = 0; m < n; m++) {
+      q[list[m]] += buf[2*m];
+      q2[list[m]] += buf[2*m+1];
+    }
+  } else
+    for(int m = 0; m < n; m++) q[list[m]] += buf[m];
 }
 
 /* ----------------------------------------------------------------------
@@ -865,9 +1402,14 @@ double FixQEqReax::memory_usage()
 
   bytes = atom->nmax*nprev*2 * sizeof(double); // s_hist & t_hist
   bytes += atom->nmax*11 * sizeof(double); // storage
+  if (dualflag) bytes += atom->nmax*4 * sizeof(double); // dual CG storage
+  if (pipeflag) bytes += atom->nmax * sizeof(double); // pipelined CG storage
   bytes += n_cap*2 * sizeof(int); // matrix...
   bytes += m_cap * sizeof(int);
   bytes += m_cap * sizeof(double);
+  bytes += n_cap*2 * sizeof(int); // candidate pattern
+  bytes += m_cap * sizeof(int);
+  if (ntab) bytes += (atom->ntypes+1)*(atom->ntypes+1)*ntab*4 * sizeof(double);
 
   return bytes;
 }
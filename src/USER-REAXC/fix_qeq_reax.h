@@ -76,6 +76,10 @@ class FixQEqReax : public Fix {
   double *s, *t;
   double **s_hist, **t_hist;
   int nprev;
+  int extrap_s, extrap_t;   // order of extrapolation for initial guesses
+
+  int dualflag;             // 1 = solve s and t in one fused CG loop
+  int pipeflag;             // 1 = single reduction (pipelined) CG
 
   typedef struct{
     int n, m;
@@ -86,12 +90,22 @@ class FixQEqReax : public Fix {
   } sparse_matrix;
 
   sparse_matrix H;
+  sparse_matrix Hpat;       // candidate pairs of H since last reneighboring
+  int m_pat;
+  bigint pattern_build;     // Neighbor::ncalls value of the candidates
+
+  int ntab;                 // # of taper*shielding table intervals, 0 = off
+  double rdr_tab;
+  double ****htab;          // cubic coeffs of H(r) per type pair & interval
+
   double *Hdia_inv;
   double *b_s, *b_t;
   double *b_prc, *b_prm;
 
   //CG storage
   double *p, *q, *r, *d;
+  double *p2, *q2, *r2, *d2;  // second system for dual CG
+  double *z;                  // A*p for pipelined CG
 
   //GMRES storage
   //double *g,*y;
@@ -102,6 +116,7 @@ class FixQEqReax : public Fix {
   void pertype_parameters(char*);
   void init_shielding();
   void init_taper();
+  void init_table();
   void allocate_storage();
   void deallocate_storage();
   void reallocate_storage();
@@ -112,12 +127,16 @@ class FixQEqReax : public Fix {
   void init_matvec();
   void init_H();
   void compute_H();
+  void build_pattern();
   double calculate_H(double,double);
   void calculate_Q();
 
   int CG(double*,double*);
+  int CG_pipe(double*,double*);
+  int dual_CG();
   //int GMRES(double*,double*);
   void sparse_matvec(sparse_matrix*,double*,double*);
+  void sparse_matvec_dual(sparse_matrix*,double*,double*,double*,double*);
 
   int pack_forward_comm(int, int *, double *, int, int *);
   void unpack_forward_comm(int, int, double *);
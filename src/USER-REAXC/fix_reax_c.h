@@ -36,6 +36,7 @@ namespace LAMMPS_NS {
 
 class FixReaxC : public Fix {
   friend class PairReaxC;
+  friend class PairReaxCOMP;
 
  public:
   FixReaxC(class LAMMPS *,int, char **);
@@ -110,6 +110,8 @@ void FixReaxCBonds::init()
   reaxc = (PairReaxC *) force->pair_match("reax/c",1);
   if (reaxc == NULL)
     reaxc = (PairReaxC *) force->pair_match("reax/c/kk",1);
+  if (reaxc == NULL)
+    reaxc = (PairReaxC *) force->pair_match("reax/c/omp",1);
 
   if (reaxc == NULL) error->all(FLERR,"Cannot use fix reax/c/bonds without "
                   "pair_style reax/c");
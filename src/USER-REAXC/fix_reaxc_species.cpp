@@ -287,6 +287,8 @@ void FixReaxCSpecies::init()
   reaxc = (PairReaxC *) force->pair_match("reax/c",1);
   if (reaxc == NULL)
     reaxc = (PairReaxC *) force->pair_match("reax/c/kk",1);
+  if (reaxc == NULL)
+    reaxc = (PairReaxC *) force->pair_match("reax/c/omp",1);
 
   if (reaxc == NULL) error->all(FLERR,"Cannot use fix reax/c/species without "
 		  "pair_style reax/c");
@@ -52,8 +52,8 @@ class PairReaxC : public Pair {
   mpi_datatypes *mpi_data;
 
   PairReaxC(class LAMMPS *);
-  ~PairReaxC();
-  void compute(int, int);
+  virtual ~PairReaxC();
+  virtual void compute(int, int);
   void settings(int, char **);
   void coeff(int, char **);
   void init_style();
@@ -78,7 +78,7 @@ class PairReaxC : public Pair {
   void get_distance(rvec, rvec, double *, rvec *);
   void set_far_nbr(far_neighbor_data *, int, double, rvec);
   int estimate_reax_lists();
-  int write_reax_lists();
+  virtual int write_reax_lists();
   void read_reax_forces(int);
 
   int nmax;
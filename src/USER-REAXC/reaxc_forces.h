@@ -35,6 +35,12 @@ extern interaction_function Interaction_Functions[NUM_INTRS];
 void Init_Force_Functions( control_params* );
 void Compute_Forces( reax_system*, control_params*, simulation_data*,
                      storage*, reax_list**, output_controls*, mpi_datatypes* );
+void Init_Forces_noQEq( reax_system*, control_params*, simulation_data*,
+                        storage*, reax_list**, output_controls*, MPI_Comm );
+void Compute_Bonded_Forces( reax_system*, control_params*, simulation_data*,
+                            storage*, reax_list**, output_controls*, MPI_Comm );
+void Compute_Total_Force( reax_system*, control_params*, simulation_data*,
+                          storage*, reax_list**, mpi_datatypes* );
 void Estimate_Storages( reax_system*, control_params*, reax_list**,
                         int*, int*, int*, int*, MPI_Comm );
 #endif
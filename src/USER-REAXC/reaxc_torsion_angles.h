@@ -31,5 +31,9 @@
 
 void Torsion_Angles( reax_system*, control_params*, simulation_data*,
                      storage*, reax_list**, output_controls* );
+double Calculate_Omega( rvec, double, rvec, double, rvec, double, rvec, double,
+                        three_body_interaction_data*,
+                        three_body_interaction_data*,
+                        rvec, rvec, rvec, rvec, output_controls* );
 
 #endif
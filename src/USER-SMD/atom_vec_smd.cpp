@@ -1093,6 +1093,83 @@ void AtomVecSMD::data_atom(double *coord, imageint imagetmp, char **values) {
 	atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecSMD::data_atom(double *coord, imageint imagetmp, double *values) {
+	int nlocal = atom->nlocal;
+	if (nlocal == nmax)
+		grow(0);
+
+	tag[nlocal] = (tagint) ubuf(values[0]).i;
+
+	type[nlocal] = (int) ubuf(values[1]).i;
+	if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+		error->one(FLERR, "Invalid atom type in Atoms section of data file");
+
+	molecule[nlocal] = (tagint) ubuf(values[2]).i;
+	if (molecule[nlocal] <= 0)
+		error->one(FLERR, "Invalid molecule in Atoms section of data file");
+
+	vfrac[nlocal] = values[3];
+	if (vfrac[nlocal] < 0.0)
+		error->one(FLERR, "Invalid volume in Atoms section of data file");
+
+	rmass[nlocal] = values[4];
+	if (rmass[nlocal] == 0.0)
+		error->one(FLERR, "Invalid mass in Atoms section of data file");
+
+	radius[nlocal] = values[5];
+	if (radius[nlocal] < 0.0)
+		error->one(FLERR, "Invalid radius in Atoms section of data file");
+
+	contact_radius[nlocal] = values[6];
+	if (contact_radius[nlocal] < 0.0)
+		error->one(FLERR, "Invalid contact radius in Atoms section of data file");
+
+	e[nlocal] = 0.0;
+
+	x0[nlocal][0] = values[7];
+	x0[nlocal][1] = values[8];
+	x0[nlocal][2] = values[9];
+
+	x[nlocal][0] = coord[0];
+	x[nlocal][1] = coord[1];
+	x[nlocal][2] = coord[2];
+
+	image[nlocal] = imagetmp;
+
+	mask[nlocal] = 1;
+	v[nlocal][0] = 0.0;
+	v[nlocal][1] = 0.0;
+	v[nlocal][2] = 0.0;
+	vest[nlocal][0] = 0.0;
+	vest[nlocal][1] = 0.0;
+	vest[nlocal][2] = 0.0;
+
+	damage[nlocal] = 0.0;
+
+	eff_plastic_strain[nlocal] = 0.0;
+	eff_plastic_strain_rate[nlocal] = 0.0;
+
+	for (int k = 0; k < NMAT_FULL; k++) {
+		smd_data_9[nlocal][k] = 0.0;
+	}
+
+	for (int k = 0; k < NMAT_SYMM; k++) {
+		tlsph_stress[nlocal][k] = 0.0;
+	}
+
+	smd_data_9[nlocal][0] = 1.0; // xx
+	smd_data_9[nlocal][4] = 1.0; // yy
+	smd_data_9[nlocal][8] = 1.0; // zz
+
+	atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
  unpack hybrid quantities from one line in Atoms section of data file
  initialize other atom quantities for this sub-style
@@ -1103,6 +1180,16 @@ int AtomVecSMD::data_atom_hybrid(int nlocal, char **values) {
 	return -1;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecSMD::data_atom_hybrid(int nlocal, double *values) {
+	error->one(FLERR, "hybrid atom style functionality not yet implemented for atom style tlsph");
+	return -1;
+}
+
 /* ----------------------------------------------------------------------
  unpack one line from Velocities section of data file
  ------------------------------------------------------------------------- */
@@ -1116,6 +1203,19 @@ void AtomVecSMD::data_vel(int m, char **values) {
 	vest[m][2] = atof(values[2]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecSMD::data_vel(int m, double *values) {
+	v[m][0] = values[0];
+	v[m][1] = values[1];
+	v[m][2] = values[2];
+	vest[m][0] = values[0];
+	vest[m][1] = values[1];
+	vest[m][2] = values[2];
+}
+
 /* ----------------------------------------------------------------------
  unpack hybrid quantities from one line in Velocities section of data file
  ------------------------------------------------------------------------- */
@@ -1125,6 +1225,15 @@ int AtomVecSMD::data_vel_hybrid(int m, char **values) {
 	return 0;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Velocities section
+------------------------------------------------------------------------- */
+
+int AtomVecSMD::data_vel_hybrid(int m, double *values) {
+	error->one(FLERR, "hybrid atom style functionality not yet implemented for atom style tlsph");
+	return 0;
+}
+
 /* ----------------------------------------------------------------------
  pack atom info for data file including 3 image flags
  ------------------------------------------------------------------------- */
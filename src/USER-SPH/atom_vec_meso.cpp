@@ -874,6 +874,46 @@ void AtomVecMeso::data_atom(double *coord, imageint imagetmp, char **values) {
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecMeso::data_atom(double *coord, imageint imagetmp, double *values) {
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  rho[nlocal] = values[2];
+  e[nlocal] = values[3];
+  cv[nlocal] = values[4];
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+
+  vest[nlocal][0] = 0.0;
+  vest[nlocal][1] = 0.0;
+  vest[nlocal][2] = 0.0;
+
+  de[nlocal] = 0.0;
+  drho[nlocal] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -888,6 +928,20 @@ int AtomVecMeso::data_atom_hybrid(int nlocal, char **values) {
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecMeso::data_atom_hybrid(int nlocal, double *values) {
+
+  rho[nlocal] = values[0];
+  e[nlocal] = values[1];
+  cv[nlocal] = values[2];
+
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -97,6 +97,7 @@ DumpCustomVTK::DumpCustomVTK(LAMMPS *lmp, int narg, char **arg) :
   DumpCustom(lmp, narg, arg)
 {
   if (narg == 5) error->all(FLERR,"No dump custom/vtk arguments specified");
+  async_allow = 0;
 
   pack_choice.clear();
   vtype.clear();
@@ -295,7 +296,7 @@ int DumpCustomVTK::count()
     } else {
       for (i = 0; i < ncompute; i++) {
         if (!(compute[i]->invoked_flag & INVOKED_PERATOM)) {
-          compute[i]->compute_peratom();
+          compute[i]->invoke_peratom();
           compute[i]->invoked_flag |= INVOKED_PERATOM;
         }
       }
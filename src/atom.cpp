@@ -200,12 +200,11 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
   tag_enable = 1;
   map_style = map_user = 0;
   map_tag_max = -1;
-  map_maxarray = map_nhash = -1;
+  map_maxarray = -1;
 
   max_same = 0;
   sametag = NULL;
   map_array = NULL;
-  map_bucket = NULL;
   map_hash = NULL;
 
   atom_style = NULL;
@@ -804,10 +803,12 @@ void Atom::deallocate_topology()
 /* ----------------------------------------------------------------------
    unpack N lines from Atom section of data file
    call style-specific routine to parse line
+   if allflag, keep all atoms inside the global box, not just my sub-domain,
+     caller will migrate them to their owning procs
 ------------------------------------------------------------------------- */
 
 void Atom::data_atoms(int n, char *buf, tagint id_offset, int type_offset,
-                      int shiftflag, double *shift)
+                      int shiftflag, double *shift, int allflag)
 {
   int m,xptr,iptr;
   imageint imagedata;
@@ -820,64 +821,17 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, int type_offset,
   int nwords = count_words(buf);
   *next = '\n';
 
-  if (nwords != avec->size_data_atom && nwords != avec->size_data_atom + 3)
+  if (nwords != avec->size_data_atom && nwords != avec->size_data_atom + 3) {
+    if (allflag) error->one(FLERR,"Incorrect atom format in data file");
     error->all(FLERR,"Incorrect atom format in data file");
+  }
 
   char **values = new char*[nwords];
 
-  // set bounds for my proc
-  // if periodic and I am lo/hi proc, adjust bounds by EPSILON
-  // insures all data atoms will be owned even with round-off
-
   int triclinic = domain->triclinic;
 
-  double epsilon[3];
-  if (triclinic) epsilon[0] = epsilon[1] = epsilon[2] = EPSILON;
-  else {
-    epsilon[0] = domain->prd[0] * EPSILON;
-    epsilon[1] = domain->prd[1] * EPSILON;
-    epsilon[2] = domain->prd[2] * EPSILON;
-  }
-
   double sublo[3],subhi[3];
-  if (triclinic == 0) {
-    sublo[0] = domain->sublo[0]; subhi[0] = domain->subhi[0];
-    sublo[1] = domain->sublo[1]; subhi[1] = domain->subhi[1];
-    sublo[2] = domain->sublo[2]; subhi[2] = domain->subhi[2];
-  } else {
-    sublo[0] = domain->sublo_lamda[0]; subhi[0] = domain->subhi_lamda[0];
-    sublo[1] = domain->sublo_lamda[1]; subhi[1] = domain->subhi_lamda[1];
-    sublo[2] = domain->sublo_lamda[2]; subhi[2] = domain->subhi_lamda[2];
-  }
-
-  if (comm->layout != LAYOUT_TILED) {
-    if (domain->xperiodic) {
-      if (comm->myloc[0] == 0) sublo[0] -= epsilon[0];
-      if (comm->myloc[0] == comm->procgrid[0]-1) subhi[0] += epsilon[0];
-    }
-    if (domain->yperiodic) {
-      if (comm->myloc[1] == 0) sublo[1] -= epsilon[1];
-      if (comm->myloc[1] == comm->procgrid[1]-1) subhi[1] += epsilon[1];
-    }
-    if (domain->zperiodic) {
-      if (comm->myloc[2] == 0) sublo[2] -= epsilon[2];
-      if (comm->myloc[2] == comm->procgrid[2]-1) subhi[2] += epsilon[2];
-    }
-
-  } else {
-    if (domain->xperiodic) {
-      if (comm->mysplit[0][0] == 0.0) sublo[0] -= epsilon[0];
-      if (comm->mysplit[0][1] == 1.0) subhi[0] += epsilon[0];
-    }
-    if (domain->yperiodic) {
-      if (comm->mysplit[1][0] == 0.0) sublo[1] -= epsilon[1];
-      if (comm->mysplit[1][1] == 1.0) subhi[1] += epsilon[1];
-    }
-    if (domain->zperiodic) {
-      if (comm->mysplit[2][0] == 0.0) sublo[2] -= epsilon[2];
-      if (comm->mysplit[2][1] == 1.0) subhi[2] += epsilon[2];
-    }
-  }
+  data_bounds(allflag,sublo,subhi);
 
   // xptr = which word in line starts xyz coords
   // iptr = which word in line starts ix,iy,iz image flags
@@ -897,12 +851,16 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, int type_offset,
     next = strchr(buf,'\n');
 
     values[0] = strtok(buf," \t\n\r\f");
-    if (values[0] == NULL)
+    if (values[0] == NULL) {
+      if (allflag) error->one(FLERR,"Incorrect atom format in data file");
       error->all(FLERR,"Incorrect atom format in data file");
+    }
     for (m = 1; m < nwords; m++) {
       values[m] = strtok(NULL," \t\n\r\f");
-      if (values[m] == NULL)
+      if (values[m] == NULL) {
+        if (allflag) error->one(FLERR,"Incorrect atom format in data file");
         error->all(FLERR,"Incorrect atom format in data file");
+      }
     }
 
     if (imageflag)
@@ -945,6 +903,149 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, int type_offset,
   delete [] values;
 }
 
+/* ----------------------------------------------------------------------
+   unpack N records from Binary Atoms section of data file
+   each record = size_data_atom + 3 values as packed by AtomVec::pack_data(),
+     integer values stored as int64, image flags are last 3 values
+   call style-specific routine to unpack record
+   if allflag, keep all atoms inside the global box, not just my sub-domain,
+     caller will migrate them to their owning procs
+------------------------------------------------------------------------- */
+
+void Atom::data_atoms(int n, double *values, tagint id_offset, int type_offset,
+                      int shiftflag, double *shift, int allflag)
+{
+  imageint imagedata;
+  double xdata[3],lamda[3];
+  double *coord,*record;
+
+  int triclinic = domain->triclinic;
+
+  double sublo[3],subhi[3];
+  data_bounds(allflag,sublo,subhi);
+
+  int ncol = avec->size_data_atom + 3;
+  int xptr = avec->xcol_data - 1;
+  int iptr = ncol - 3;
+
+  // loop over records of atom data
+  // extract xyz coords and image flags
+  // remap atom into simulation box
+  // if atom is in my sub-domain, unpack its values
+
+  for (int i = 0; i < n; i++) {
+    record = &values[i*ncol];
+
+    imagedata =
+      ((imageint) (ubuf(record[iptr]).i + IMGMAX) & IMGMASK) |
+      (((imageint) (ubuf(record[iptr+1]).i + IMGMAX) & IMGMASK) << IMGBITS) |
+      (((imageint) (ubuf(record[iptr+2]).i + IMGMAX) & IMGMASK) << IMG2BITS);
+
+    xdata[0] = record[xptr];
+    xdata[1] = record[xptr+1];
+    xdata[2] = record[xptr+2];
+    if (shiftflag) {
+      xdata[0] += shift[0];
+      xdata[1] += shift[1];
+      xdata[2] += shift[2];
+    }
+
+    domain->remap(xdata,imagedata);
+    if (triclinic) {
+      domain->x2lamda(xdata,lamda);
+      coord = lamda;
+    } else coord = xdata;
+
+    if (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
+        coord[1] >= sublo[1] && coord[1] < subhi[1] &&
+        coord[2] >= sublo[2] && coord[2] < subhi[2]) {
+      avec->data_atom(xdata,imagedata,record);
+      if (id_offset) tag[nlocal-1] += id_offset;
+      if (type_offset) {
+        type[nlocal-1] += type_offset;
+        if (type[nlocal-1] > ntypes)
+          error->one(FLERR,"Invalid atom type in Atoms section of data file");
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   set bounds of region whose atoms are kept by data_atoms()
+   my sub-domain, or the global box if allflag
+   if periodic and I am lo/hi proc, adjust bounds by EPSILON
+   insures all data atoms will be owned even with round-off
+   bounds are in lamda coords for triclinic
+------------------------------------------------------------------------- */
+
+void Atom::data_bounds(int allflag, double *sublo, double *subhi)
+{
+  int triclinic = domain->triclinic;
+
+  double epsilon[3];
+  if (triclinic) epsilon[0] = epsilon[1] = epsilon[2] = EPSILON;
+  else {
+    epsilon[0] = domain->prd[0] * EPSILON;
+    epsilon[1] = domain->prd[1] * EPSILON;
+    epsilon[2] = domain->prd[2] * EPSILON;
+  }
+
+  if (allflag) {
+    if (triclinic == 0) {
+      sublo[0] = domain->boxlo[0]; subhi[0] = domain->boxhi[0];
+      sublo[1] = domain->boxlo[1]; subhi[1] = domain->boxhi[1];
+      sublo[2] = domain->boxlo[2]; subhi[2] = domain->boxhi[2];
+    } else {
+      sublo[0] = sublo[1] = sublo[2] = 0.0;
+      subhi[0] = subhi[1] = subhi[2] = 1.0;
+    }
+  } else if (triclinic == 0) {
+    sublo[0] = domain->sublo[0]; subhi[0] = domain->subhi[0];
+    sublo[1] = domain->sublo[1]; subhi[1] = domain->subhi[1];
+    sublo[2] = domain->sublo[2]; subhi[2] = domain->subhi[2];
+  } else {
+    sublo[0] = domain->sublo_lamda[0]; subhi[0] = domain->subhi_lamda[0];
+    sublo[1] = domain->sublo_lamda[1]; subhi[1] = domain->subhi_lamda[1];
+    sublo[2] = domain->sublo_lamda[2]; subhi[2] = domain->subhi_lamda[2];
+  }
+
+  if (allflag) {
+    for (int idim = 0; idim < 3; idim++)
+      if (domain->periodicity[idim]) {
+        sublo[idim] -= epsilon[idim];
+        subhi[idim] += epsilon[idim];
+      }
+
+  } else if (comm->layout != LAYOUT_TILED) {
+    if (domain->xperiodic) {
+      if (comm->myloc[0] == 0) sublo[0] -= epsilon[0];
+      if (comm->myloc[0] == comm->procgrid[0]-1) subhi[0] += epsilon[0];
+    }
+    if (domain->yperiodic) {
+      if (comm->myloc[1] == 0) sublo[1] -= epsilon[1];
+      if (comm->myloc[1] == comm->procgrid[1]-1) subhi[1] += epsilon[1];
+    }
+    if (domain->zperiodic) {
+      if (comm->myloc[2] == 0) sublo[2] -= epsilon[2];
+      if (comm->myloc[2] == comm->procgrid[2]-1) subhi[2] += epsilon[2];
+    }
+
+  } else {
+    if (domain->xperiodic) {
+      if (comm->mysplit[0][0] == 0.0) sublo[0] -= epsilon[0];
+      if (comm->mysplit[0][1] == 1.0) subhi[0] += epsilon[0];
+    }
+    if (domain->yperiodic) {
+      if (comm->mysplit[1][0] == 0.0) sublo[1] -= epsilon[1];
+      if (comm->mysplit[1][1] == 1.0) subhi[1] += epsilon[1];
+    }
+    if (domain->zperiodic) {
+      if (comm->mysplit[2][0] == 0.0) sublo[2] -= epsilon[2];
+      if (comm->mysplit[2][1] == 1.0) subhi[2] += epsilon[2];
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    unpack N lines from Velocity section of data file
    check that atom IDs are > 0 and <= map_tag_max
@@ -989,56 +1090,103 @@ void Atom::data_vels(int n, char *buf, tagint id_offset)
   delete [] values;
 }
 
+/* ----------------------------------------------------------------------
+   unpack N records from Binary Velocities section of data file
+   each record = atom ID stored as int64, then size_data_vel-1 values
+   check that atom IDs are > 0 and <= map_tag_max
+   call style-specific routine to unpack record
+------------------------------------------------------------------------- */
+
+void Atom::data_vels(int n, double *values, tagint id_offset)
+{
+  int m;
+  tagint tagdata;
+  double *record;
+
+  int ncol = avec->size_data_vel;
+
+  for (int i = 0; i < n; i++) {
+    record = &values[i*ncol];
+    tagdata = (tagint) ubuf(record[0]).i + id_offset;
+    if (tagdata <= 0 || tagdata > map_tag_max)
+      error->one(FLERR,"Invalid atom ID in Velocities section of data file");
+    if ((m = map(tagdata)) >= 0) avec->data_vel(m,&record[1]);
+  }
+}
+
 /* ----------------------------------------------------------------------
    process N bonds read into buf from data files
    if count is non-NULL, just count bonds per atom
    else store them with atoms
-   check that atom IDs are > 0 and <= map_tag_max
 ------------------------------------------------------------------------- */
 
 void Atom::data_bonds(int n, char *buf, int *count, tagint id_offset,
                       int type_offset)
 {
-  int m,tmp,itype;
+  int tmp,itype;
   tagint atom1,atom2;
   char *next;
-  int newton_bond = force->newton_bond;
 
   for (int i = 0; i < n; i++) {
     next = strchr(buf,'\n');
     *next = '\0';
     sscanf(buf,"%d %d " TAGINT_FORMAT " " TAGINT_FORMAT,
            &tmp,&itype,&atom1,&atom2);
-    if (id_offset) {
-      atom1 += id_offset;
-      atom2 += id_offset;
-    }
-    itype += type_offset;
+    store_bond(itype+type_offset,atom1+id_offset,atom2+id_offset,count);
+    buf = next + 1;
+  }
+}
 
-    if (atom1 <= 0 || atom1 > map_tag_max ||
-        atom2 <= 0 || atom2 > map_tag_max)
-      error->one(FLERR,"Invalid atom ID in Bonds section of data file");
-    if (itype <= 0 || itype > nbondtypes)
-      error->one(FLERR,"Invalid bond type in Bonds section of data file");
-    if ((m = map(atom1)) >= 0) {
+/* ----------------------------------------------------------------------
+   process N records of a Binary Bonds section
+   each record = index, type, 2 atom IDs as int64
+------------------------------------------------------------------------- */
+
+void Atom::data_bonds(int n, int64_t *values, int *count, tagint id_offset,
+                      int type_offset)
+{
+  int64_t *record;
+
+  for (int i = 0; i < n; i++) {
+    record = &values[4*i];
+    store_bond((int) record[1] + type_offset,
+               (tagint) record[2] + id_offset,
+               (tagint) record[3] + id_offset,count);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add one bond to the atoms I own
+   if count is non-NULL, just count bonds per atom
+   check that atom IDs are > 0 and <= map_tag_max
+------------------------------------------------------------------------- */
+
+void Atom::store_bond(int itype, tagint atom1, tagint atom2, int *count)
+{
+  int m;
+
+  if (atom1 <= 0 || atom1 > map_tag_max ||
+      atom2 <= 0 || atom2 > map_tag_max)
+    error->one(FLERR,"Invalid atom ID in Bonds section of data file");
+  if (itype <= 0 || itype > nbondtypes)
+    error->one(FLERR,"Invalid bond type in Bonds section of data file");
+  if ((m = map(atom1)) >= 0) {
+    if (count) count[m]++;
+    else {
+      bond_type[m][num_bond[m]] = itype;
+      bond_atom[m][num_bond[m]] = atom2;
+      num_bond[m]++;
+    }
+  }
+  if (force->newton_bond == 0) {
+    if ((m = map(atom2)) >= 0) {
       if (count) count[m]++;
       else {
         bond_type[m][num_bond[m]] = itype;
-        bond_atom[m][num_bond[m]] = atom2;
+        bond_atom[m][num_bond[m]] = atom1;
         num_bond[m]++;
       }
     }
-    if (newton_bond == 0) {
-      if ((m = map(atom2)) >= 0) {
-        if (count) count[m]++;
-        else {
-          bond_type[m][num_bond[m]] = itype;
-          bond_atom[m][num_bond[m]] = atom1;
-          num_bond[m]++;
-        }
-      }
-    }
-    buf = next + 1;
   }
 }
 
@@ -1046,36 +1194,74 @@ void Atom::data_bonds(int n, char *buf, int *count, tagint id_offset,
    process N angles read into buf from data files
    if count is non-NULL, just count angles per atom
    else store them with atoms
-   check that atom IDs are > 0 and <= map_tag_max
 ------------------------------------------------------------------------- */
 
 void Atom::data_angles(int n, char *buf, int *count, tagint id_offset,
                        int type_offset)
 {
-  int m,tmp,itype;
+  int tmp,itype;
   tagint atom1,atom2,atom3;
   char *next;
-  int newton_bond = force->newton_bond;
 
   for (int i = 0; i < n; i++) {
     next = strchr(buf,'\n');
     *next = '\0';
     sscanf(buf,"%d %d " TAGINT_FORMAT " " TAGINT_FORMAT " " TAGINT_FORMAT,
            &tmp,&itype,&atom1,&atom2,&atom3);
-    if (id_offset) {
-      atom1 += id_offset;
-      atom2 += id_offset;
-      atom3 += id_offset;
+    store_angle(itype+type_offset,atom1+id_offset,atom2+id_offset,
+                atom3+id_offset,count);
+    buf = next + 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   process N records of a Binary Angles section
+   each record = index, type, 3 atom IDs as int64
+------------------------------------------------------------------------- */
+
+void Atom::data_angles(int n, int64_t *values, int *count, tagint id_offset,
+                       int type_offset)
+{
+  int64_t *record;
+
+  for (int i = 0; i < n; i++) {
+    record = &values[5*i];
+    store_angle((int) record[1] + type_offset,
+                (tagint) record[2] + id_offset,
+                (tagint) record[3] + id_offset,
+                (tagint) record[4] + id_offset,count);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add one angle to the atoms I own
+   if count is non-NULL, just count angles per atom
+   check that atom IDs are > 0 and <= map_tag_max
+------------------------------------------------------------------------- */
+
+void Atom::store_angle(int itype, tagint atom1, tagint atom2, tagint atom3,
+                       int *count)
+{
+  int m;
+
+  if (atom1 <= 0 || atom1 > map_tag_max ||
+      atom2 <= 0 || atom2 > map_tag_max ||
+      atom3 <= 0 || atom3 > map_tag_max)
+    error->one(FLERR,"Invalid atom ID in Angles section of data file");
+  if (itype <= 0 || itype > nangletypes)
+    error->one(FLERR,"Invalid angle type in Angles section of data file");
+  if ((m = map(atom2)) >= 0) {
+    if (count) count[m]++;
+    else {
+      angle_type[m][num_angle[m]] = itype;
+      angle_atom1[m][num_angle[m]] = atom1;
+      angle_atom2[m][num_angle[m]] = atom2;
+      angle_atom3[m][num_angle[m]] = atom3;
+      num_angle[m]++;
     }
-    itype += type_offset;
-
-    if (atom1 <= 0 || atom1 > map_tag_max ||
-        atom2 <= 0 || atom2 > map_tag_max ||
-        atom3 <= 0 || atom3 > map_tag_max)
-      error->one(FLERR,"Invalid atom ID in Angles section of data file");
-    if (itype <= 0 || itype > nangletypes)
-      error->one(FLERR,"Invalid angle type in Angles section of data file");
-    if ((m = map(atom2)) >= 0) {
+  }
+  if (force->newton_bond == 0) {
+    if ((m = map(atom1)) >= 0) {
       if (count) count[m]++;
       else {
         angle_type[m][num_angle[m]] = itype;
@@ -1085,29 +1271,16 @@ void Atom::data_angles(int n, char *buf, int *count, tagint id_offset,
         num_angle[m]++;
       }
     }
-    if (newton_bond == 0) {
-      if ((m = map(atom1)) >= 0) {
-        if (count) count[m]++;
-        else {
-          angle_type[m][num_angle[m]] = itype;
-          angle_atom1[m][num_angle[m]] = atom1;
-          angle_atom2[m][num_angle[m]] = atom2;
-          angle_atom3[m][num_angle[m]] = atom3;
-          num_angle[m]++;
-        }
-      }
-      if ((m = map(atom3)) >= 0) {
-        if (count) count[m]++;
-        else {
-          angle_type[m][num_angle[m]] = itype;
-          angle_atom1[m][num_angle[m]] = atom1;
-          angle_atom2[m][num_angle[m]] = atom2;
-          angle_atom3[m][num_angle[m]] = atom3;
-          num_angle[m]++;
-        }
+    if ((m = map(atom3)) >= 0) {
+      if (count) count[m]++;
+      else {
+        angle_type[m][num_angle[m]] = itype;
+        angle_atom1[m][num_angle[m]] = atom1;
+        angle_atom2[m][num_angle[m]] = atom2;
+        angle_atom3[m][num_angle[m]] = atom3;
+        num_angle[m]++;
       }
     }
-    buf = next + 1;
   }
 }
 
@@ -1115,16 +1288,14 @@ void Atom::data_angles(int n, char *buf, int *count, tagint id_offset,
    process N dihedrals read into buf from data files
    if count is non-NULL, just count diihedrals per atom
    else store them with atoms
-   check that atom IDs are > 0 and <= map_tag_max
 ------------------------------------------------------------------------- */
 
 void Atom::data_dihedrals(int n, char *buf, int *count, tagint id_offset,
                           int type_offset)
 {
-  int m,tmp,itype;
+  int tmp,itype;
   tagint atom1,atom2,atom3,atom4;
   char *next;
-  int newton_bond = force->newton_bond;
 
   for (int i = 0; i < n; i++) {
     next = strchr(buf,'\n');
@@ -1132,23 +1303,64 @@ void Atom::data_dihedrals(int n, char *buf, int *count, tagint id_offset,
     sscanf(buf,"%d %d "
            TAGINT_FORMAT " " TAGINT_FORMAT " " TAGINT_FORMAT " " TAGINT_FORMAT,
            &tmp,&itype,&atom1,&atom2,&atom3,&atom4);
-    if (id_offset) {
-      atom1 += id_offset;
-      atom2 += id_offset;
-      atom3 += id_offset;
-      atom4 += id_offset;
+    store_dihedral(itype+type_offset,atom1+id_offset,atom2+id_offset,
+                   atom3+id_offset,atom4+id_offset,count);
+    buf = next + 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   process N records of a Binary Dihedrals section
+   each record = index, type, 4 atom IDs as int64
+------------------------------------------------------------------------- */
+
+void Atom::data_dihedrals(int n, int64_t *values, int *count,
+                          tagint id_offset, int type_offset)
+{
+  int64_t *record;
+
+  for (int i = 0; i < n; i++) {
+    record = &values[6*i];
+    store_dihedral((int) record[1] + type_offset,
+                   (tagint) record[2] + id_offset,
+                   (tagint) record[3] + id_offset,
+                   (tagint) record[4] + id_offset,
+                   (tagint) record[5] + id_offset,count);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add one dihedral to the atoms I own
+   if count is non-NULL, just count dihedrals per atom
+   check that atom IDs are > 0 and <= map_tag_max
+------------------------------------------------------------------------- */
+
+void Atom::store_dihedral(int itype, tagint atom1, tagint atom2,
+                          tagint atom3, tagint atom4, int *count)
+{
+  int m;
+
+  if (atom1 <= 0 || atom1 > map_tag_max ||
+      atom2 <= 0 || atom2 > map_tag_max ||
+      atom3 <= 0 || atom3 > map_tag_max ||
+      atom4 <= 0 || atom4 > map_tag_max)
+    error->one(FLERR,"Invalid atom ID in Dihedrals section of data file");
+  if (itype <= 0 || itype > ndihedraltypes)
+    error->one(FLERR,
+               "Invalid dihedral type in Dihedrals section of data file");
+  if ((m = map(atom2)) >= 0) {
+    if (count) count[m]++;
+    else {
+      dihedral_type[m][num_dihedral[m]] = itype;
+      dihedral_atom1[m][num_dihedral[m]] = atom1;
+      dihedral_atom2[m][num_dihedral[m]] = atom2;
+      dihedral_atom3[m][num_dihedral[m]] = atom3;
+      dihedral_atom4[m][num_dihedral[m]] = atom4;
+      num_dihedral[m]++;
     }
-    itype += type_offset;
-
-    if (atom1 <= 0 || atom1 > map_tag_max ||
-        atom2 <= 0 || atom2 > map_tag_max ||
-        atom3 <= 0 || atom3 > map_tag_max ||
-        atom4 <= 0 || atom4 > map_tag_max)
-      error->one(FLERR,"Invalid atom ID in Dihedrals section of data file");
-    if (itype <= 0 || itype > ndihedraltypes)
-      error->one(FLERR,
-                 "Invalid dihedral type in Dihedrals section of data file");
-    if ((m = map(atom2)) >= 0) {
+  }
+  if (force->newton_bond == 0) {
+    if ((m = map(atom1)) >= 0) {
       if (count) count[m]++;
       else {
         dihedral_type[m][num_dihedral[m]] = itype;
@@ -1159,42 +1371,28 @@ void Atom::data_dihedrals(int n, char *buf, int *count, tagint id_offset,
         num_dihedral[m]++;
       }
     }
-    if (newton_bond == 0) {
-      if ((m = map(atom1)) >= 0) {
-        if (count) count[m]++;
-        else {
-          dihedral_type[m][num_dihedral[m]] = itype;
-          dihedral_atom1[m][num_dihedral[m]] = atom1;
-          dihedral_atom2[m][num_dihedral[m]] = atom2;
-          dihedral_atom3[m][num_dihedral[m]] = atom3;
-          dihedral_atom4[m][num_dihedral[m]] = atom4;
-          num_dihedral[m]++;
-        }
-      }
-      if ((m = map(atom3)) >= 0) {
-        if (count) count[m]++;
-        else {
-          dihedral_type[m][num_dihedral[m]] = itype;
-          dihedral_atom1[m][num_dihedral[m]] = atom1;
-          dihedral_atom2[m][num_dihedral[m]] = atom2;
-          dihedral_atom3[m][num_dihedral[m]] = atom3;
-          dihedral_atom4[m][num_dihedral[m]] = atom4;
-          num_dihedral[m]++;
-        }
+    if ((m = map(atom3)) >= 0) {
+      if (count) count[m]++;
+      else {
+        dihedral_type[m][num_dihedral[m]] = itype;
+        dihedral_atom1[m][num_dihedral[m]] = atom1;
+        dihedral_atom2[m][num_dihedral[m]] = atom2;
+        dihedral_atom3[m][num_dihedral[m]] = atom3;
+        dihedral_atom4[m][num_dihedral[m]] = atom4;
+        num_dihedral[m]++;
       }
-      if ((m = map(atom4)) >= 0) {
-        if (count) count[m]++;
-        else {
-          dihedral_type[m][num_dihedral[m]] = itype;
-          dihedral_atom1[m][num_dihedral[m]] = atom1;
-          dihedral_atom2[m][num_dihedral[m]] = atom2;
-          dihedral_atom3[m][num_dihedral[m]] = atom3;
-          dihedral_atom4[m][num_dihedral[m]] = atom4;
-          num_dihedral[m]++;
-        }
+    }
+    if ((m = map(atom4)) >= 0) {
+      if (count) count[m]++;
+      else {
+        dihedral_type[m][num_dihedral[m]] = itype;
+        dihedral_atom1[m][num_dihedral[m]] = atom1;
+        dihedral_atom2[m][num_dihedral[m]] = atom2;
+        dihedral_atom3[m][num_dihedral[m]] = atom3;
+        dihedral_atom4[m][num_dihedral[m]] = atom4;
+        num_dihedral[m]++;
       }
     }
-    buf = next + 1;
   }
 }
 
@@ -1202,16 +1400,14 @@ void Atom::data_dihedrals(int n, char *buf, int *count, tagint id_offset,
    process N impropers read into buf from data files
    if count is non-NULL, just count impropers per atom
    else store them with atoms
-   check that atom IDs are > 0 and <= map_tag_max
 ------------------------------------------------------------------------- */
 
 void Atom::data_impropers(int n, char *buf, int *count, tagint id_offset,
                           int type_offset)
 {
-  int m,tmp,itype;
+  int tmp,itype;
   tagint atom1,atom2,atom3,atom4;
   char *next;
-  int newton_bond = force->newton_bond;
 
   for (int i = 0; i < n; i++) {
     next = strchr(buf,'\n');
@@ -1219,23 +1415,64 @@ void Atom::data_impropers(int n, char *buf, int *count, tagint id_offset,
     sscanf(buf,"%d %d "
            TAGINT_FORMAT " " TAGINT_FORMAT " " TAGINT_FORMAT " " TAGINT_FORMAT,
            &tmp,&itype,&atom1,&atom2,&atom3,&atom4);
-    if (id_offset) {
-      atom1 += id_offset;
-      atom2 += id_offset;
-      atom3 += id_offset;
-      atom4 += id_offset;
+    store_improper(itype+type_offset,atom1+id_offset,atom2+id_offset,
+                   atom3+id_offset,atom4+id_offset,count);
+    buf = next + 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   process N records of a Binary Impropers section
+   each record = index, type, 4 atom IDs as int64
+------------------------------------------------------------------------- */
+
+void Atom::data_impropers(int n, int64_t *values, int *count,
+                          tagint id_offset, int type_offset)
+{
+  int64_t *record;
+
+  for (int i = 0; i < n; i++) {
+    record = &values[6*i];
+    store_improper((int) record[1] + type_offset,
+                   (tagint) record[2] + id_offset,
+                   (tagint) record[3] + id_offset,
+                   (tagint) record[4] + id_offset,
+                   (tagint) record[5] + id_offset,count);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add one improper to the atoms I own
+   if count is non-NULL, just count impropers per atom
+   check that atom IDs are > 0 and <= map_tag_max
+------------------------------------------------------------------------- */
+
+void Atom::store_improper(int itype, tagint atom1, tagint atom2,
+                          tagint atom3, tagint atom4, int *count)
+{
+  int m;
+
+  if (atom1 <= 0 || atom1 > map_tag_max ||
+      atom2 <= 0 || atom2 > map_tag_max ||
+      atom3 <= 0 || atom3 > map_tag_max ||
+      atom4 <= 0 || atom4 > map_tag_max)
+    error->one(FLERR,"Invalid atom ID in Impropers section of data file");
+  if (itype <= 0 || itype > nimpropertypes)
+    error->one(FLERR,
+               "Invalid improper type in Impropers section of data file");
+  if ((m = map(atom2)) >= 0) {
+    if (count) count[m]++;
+    else {
+      improper_type[m][num_improper[m]] = itype;
+      improper_atom1[m][num_improper[m]] = atom1;
+      improper_atom2[m][num_improper[m]] = atom2;
+      improper_atom3[m][num_improper[m]] = atom3;
+      improper_atom4[m][num_improper[m]] = atom4;
+      num_improper[m]++;
     }
-    itype += type_offset;
-
-    if (atom1 <= 0 || atom1 > map_tag_max ||
-        atom2 <= 0 || atom2 > map_tag_max ||
-        atom3 <= 0 || atom3 > map_tag_max ||
-        atom4 <= 0 || atom4 > map_tag_max)
-      error->one(FLERR,"Invalid atom ID in Impropers section of data file");
-    if (itype <= 0 || itype > nimpropertypes)
-      error->one(FLERR,
-                 "Invalid improper type in Impropers section of data file");
-    if ((m = map(atom2)) >= 0) {
+  }
+  if (force->newton_bond == 0) {
+    if ((m = map(atom1)) >= 0) {
       if (count) count[m]++;
       else {
         improper_type[m][num_improper[m]] = itype;
@@ -1246,42 +1483,28 @@ void Atom::data_impropers(int n, char *buf, int *count, tagint id_offset,
         num_improper[m]++;
       }
     }
-    if (newton_bond == 0) {
-      if ((m = map(atom1)) >= 0) {
-        if (count) count[m]++;
-        else {
-          improper_type[m][num_improper[m]] = itype;
-          improper_atom1[m][num_improper[m]] = atom1;
-          improper_atom2[m][num_improper[m]] = atom2;
-          improper_atom3[m][num_improper[m]] = atom3;
-          improper_atom4[m][num_improper[m]] = atom4;
-          num_improper[m]++;
-        }
-      }
-      if ((m = map(atom3)) >= 0) {
-        if (count) count[m]++;
-        else {
-          improper_type[m][num_improper[m]] = itype;
-          improper_atom1[m][num_improper[m]] = atom1;
-          improper_atom2[m][num_improper[m]] = atom2;
-          improper_atom3[m][num_improper[m]] = atom3;
-          improper_atom4[m][num_improper[m]] = atom4;
-          num_improper[m]++;
-        }
+    if ((m = map(atom3)) >= 0) {
+      if (count) count[m]++;
+      else {
+        improper_type[m][num_improper[m]] = itype;
+        improper_atom1[m][num_improper[m]] = atom1;
+        improper_atom2[m][num_improper[m]] = atom2;
+        improper_atom3[m][num_improper[m]] = atom3;
+        improper_atom4[m][num_improper[m]] = atom4;
+        num_improper[m]++;
       }
-      if ((m = map(atom4)) >= 0) {
-        if (count) count[m]++;
-        else {
-          improper_type[m][num_improper[m]] = itype;
-          improper_atom1[m][num_improper[m]] = atom1;
-          improper_atom2[m][num_improper[m]] = atom2;
-          improper_atom3[m][num_improper[m]] = atom3;
-          improper_atom4[m][num_improper[m]] = atom4;
-          num_improper[m]++;
-        }
+    }
+    if ((m = map(atom4)) >= 0) {
+      if (count) count[m]++;
+      else {
+        improper_type[m][num_improper[m]] = itype;
+        improper_atom1[m][num_improper[m]] = atom1;
+        improper_atom2[m][num_improper[m]] = atom2;
+        improper_atom3[m][num_improper[m]] = atom3;
+        improper_atom4[m][num_improper[m]] = atom4;
+        num_improper[m]++;
       }
     }
-    buf = next + 1;
   }
 }
 
@@ -2163,10 +2386,8 @@ bigint Atom::memory_usage()
   bytes += max_same*sizeof(int);
   if (map_style == 1)
     bytes += memory->usage(map_array,map_maxarray);
-  else if (map_style == 2) {
-    bytes += map_nbucket*sizeof(int);
-    bytes += map_nhash*sizeof(HashElem);
-  }
+  else if (map_style == 2)
+    bytes += map_hash->memory_usage();
   if (maxnext) {
     bytes += memory->usage(next,maxnext);
     bytes += memory->usage(permute,maxnext);
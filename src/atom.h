@@ -15,6 +15,7 @@
 #define LMP_ATOM_H
 
 #include "pointers.h"
+#include "my_hash.h"
 #include <map>
 #include <string>
 
@@ -223,12 +224,18 @@ class Atom : protected Pointers {
 
   void deallocate_topology();
 
-  void data_atoms(int, char *, tagint, int, int, double *);
+  void data_atoms(int, char *, tagint, int, int, double *, int);
+  void data_atoms(int, double *, tagint, int, int, double *, int);
   void data_vels(int, char *, tagint);
+  void data_vels(int, double *, tagint);
   void data_bonds(int, char *, int *, tagint, int);
+  void data_bonds(int, int64_t *, int *, tagint, int);
   void data_angles(int, char *, int *, tagint, int);
+  void data_angles(int, int64_t *, int *, tagint, int);
   void data_dihedrals(int, char *, int *, tagint, int);
+  void data_dihedrals(int, int64_t *, int *, tagint, int);
   void data_impropers(int, char *, int *, tagint, int);
+  void data_impropers(int, int64_t *, int *, tagint, int);
   void data_bonus(int, char *, class AtomVec *, tagint);
   void data_bodies(int, char *, class AtomVecBody *, tagint);
   void data_fix_compute_variable(int, int);
@@ -274,7 +281,7 @@ class Atom : protected Pointers {
 
   inline int map(tagint global) {
     if (map_style == 1) return map_array[global];
-    else if (map_style == 2) return map_find_hash(global);
+    else if (map_style == 2) return map_hash->find(global);
     else return -1;
   };
 
@@ -293,17 +300,7 @@ class Atom : protected Pointers {
   int *map_array;       // direct map via array that holds map_tag_max
   int map_maxarray;     // allocated size of map_array (1 larger than this)
 
-  struct HashElem {     // hashed map
-    tagint global;      // key to search on = global ID
-    int local;          // value associated with key = local index
-    int next;           // next entry in this bucket, -1 if last
-  };
-  int map_nhash;        // # of entries hash table can hold
-  int map_nused;        // # of actual entries in hash table
-  int map_free;         // ptr to 1st unused entry in hash table
-  int map_nbucket;      // # of hash buckets
-  int *map_bucket;      // ptr to 1st entry in each bucket
-  HashElem *map_hash;   // hash table
+  MyHash *map_hash;     // hashed map, key = global ID, value = local index
 
   int max_same;         // allocated size of sametag
 
@@ -323,7 +320,23 @@ class Atom : protected Pointers {
   char *memstr;                   // string of array names already counted
 
   void setup_sort_bins();
-  int next_prime(int);
+
+  // union data struct for packing 32-bit and 64-bit ints into double bufs
+  // see atom_vec.h for documentation
+
+  union ubuf {
+    double d;
+    int64_t i;
+    ubuf(double arg) : d(arg) {}
+    ubuf(int64_t arg) : i(arg) {}
+    ubuf(int arg) : i(arg) {}
+  };
+
+  void data_bounds(int, double *, double *);
+  void store_bond(int, tagint, tagint, int *);
+  void store_angle(int, tagint, tagint, tagint, int *);
+  void store_dihedral(int, tagint, tagint, tagint, tagint, int *);
+  void store_improper(int, tagint, tagint, tagint, tagint, int *);
 
  private:
   template <typename T> static AtomVec *avec_creator(LAMMPS *);
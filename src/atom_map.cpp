@@ -11,7 +11,6 @@
    See the README file in the top-level LAMMPS directory.
 ------------------------------------------------------------------------- */
 
-#include <math.h>
 #include "atom.h"
 #include "comm.h"
 #include "memory.h"
@@ -27,9 +26,9 @@ using namespace LAMMPS_NS;
      array length = 1 to map_tag_max
      set entire array to -1 as initial values
    for hash option:
-     map_nhash = length of hash table
-     map_nbucket = # of hash buckets, prime larger than map_nhash * 2
-       so buckets will only be filled with 0 or 1 atoms on average
+     open addressing table, see my_hash.h
+     sized for max of ave atoms/proc or atoms I can store,
+       so it will only rarely need to grow
 ------------------------------------------------------------------------- */
 
 void Atom::map_init(int check)
@@ -37,28 +36,23 @@ void Atom::map_init(int check)
   // check for new map style if max atomID changed (check = 1 = default)
   // recreate = 1 if must delete old map and create new map
   // recreate = 0 if can re-use old map w/out realloc and just adjust settings
-  // map_maxarray/map_nhash initially -1, to force recreate even when no atoms
+  // map_maxarray initially -1 and map_hash NULL,
+  //   to force recreate even when no atoms
 
   int recreate = 0;
   if (check) recreate = map_style_set();
 
   if (map_style == 1 && map_tag_max > map_maxarray) recreate = 1;
-  else if (map_style == 2 && nlocal+nghost > map_nhash) recreate = 1;
+  else if (map_style == 2 && map_hash == NULL) recreate = 1;
 
   // if not recreating:
   // for array, initialize current map_tag_max values
-  // for hash, set all buckets to empty, put all entries in free list
+  // for hash, remove all entries
 
   if (!recreate) {
     if (map_style == 1) {
       for (int i = 0; i <= map_tag_max; i++) map_array[i] = -1;
-    } else {
-      for (int i = 0; i < map_nbucket; i++) map_bucket[i] = -1;
-      map_nused = 0;
-      map_free = 0;
-      for (int i = 0; i < map_nhash; i++) map_hash[i].next = i+1;
-      map_hash[map_nhash-1].next = -1;
-    }
+    } else map_hash->clear();
 
   // recreating: delete old map and create new one for array or hash
 
@@ -71,35 +65,9 @@ void Atom::map_init(int check)
       for (int i = 0; i <= map_tag_max; i++) map_array[i] = -1;
 
     } else {
-
-      // map_nhash = max # of atoms that can be hashed on this proc
-      // set to max of ave atoms/proc or atoms I can store
-      // multiply by 2, require at least 1000
-      // doubling means hash table will need to be re-init only rarely
-
       int nper = static_cast<int> (natoms/comm->nprocs);
-      map_nhash = MAX(nper,nmax);
-      map_nhash *= 2;
-      map_nhash = MAX(map_nhash,1000);
-
-      // map_nbucket = prime just larger than map_nhash
-      // next_prime() should be fast enough,
-      //   about 10% of odd integers are prime above 1M
-
-      map_nbucket = next_prime(map_nhash);
-
-      // set all buckets to empty
-      // set hash to map_nhash in length
-      // put all hash entries in free list and point them to each other
-
-      map_bucket = new int[map_nbucket];
-      for (int i = 0; i < map_nbucket; i++) map_bucket[i] = -1;
-
-      map_hash = new HashElem[map_nhash];
-      map_nused = 0;
-      map_free = 0;
-      for (int i = 0; i < map_nhash; i++) map_hash[i].next = i+1;
-      map_hash[map_nhash-1].next = -1;
+      map_hash = new MyHash();
+      map_hash->reserve(MAX(nper,nmax));
     }
   }
 }
@@ -108,48 +76,24 @@ void Atom::map_init(int check)
    clear global -> local map for all of my own and ghost atoms
    for hash table option:
      global ID may not be in table if image atom was already cleared
+     if most of table is in use, clearing it all at once is faster
 ------------------------------------------------------------------------- */
 
 void Atom::map_clear()
 {
+  int nall = nlocal + nghost;
+
   if (map_style == 1) {
-    int nall = nlocal + nghost;
     for (int i = 0; i < nall; i++) {
       sametag[i] = -1;
       map_array[tag[i]] = -1;
     }
 
   } else {
-    int previous,ibucket,index;
-    tagint global;
-    int nall = nlocal + nghost;
-    for (int i = 0; i < nall; i++) {
-      sametag[i] = -1;
-
-      // search for key
-      // if don't find it, done
-
-      previous = -1;
-      global = tag[i];
-      ibucket = global % map_nbucket;
-      index = map_bucket[ibucket];
-      while (index > -1) {
-        if (map_hash[index].global == global) break;
-        previous = index;
-        index = map_hash[index].next;
-      }
-      if (index == -1) continue;
-
-      // delete the hash entry and add it to free list
-      // special logic if entry is 1st in the bucket
-
-      if (previous == -1) map_bucket[ibucket] = map_hash[index].next;
-      else map_hash[previous].next = map_hash[index].next;
-
-      map_hash[index].next = map_free;
-      map_free = index;
-      map_nused--;
-    }
+    for (int i = 0; i < nall; i++) sametag[i] = -1;
+    if (4*nall > map_hash->capacity()) map_hash->clear();
+    else
+      for (int i = 0; i < nall; i++) map_hash->erase(tag[i]);
   }
 }
 
@@ -159,80 +103,34 @@ void Atom::map_clear()
      and owned atoms take precedence over images
    this enables valid lookups of bond topology atoms
    for hash table option:
-     if hash table too small, re-init
-     global ID may already be in table if image atom was set
+     grow table once for all atoms, if needed
+     global ID may already be in table if image atom was set,
+       set() returns its previous local index in a single probe
 ------------------------------------------------------------------------- */
 
 void Atom::map_set()
 {
   int nall = nlocal + nghost;
 
-  if (map_style == 1) {
-
-    // possible reallocation of sametag must come before loop over atoms
-    // since loop sets sametag
+  // possible reallocation of sametag must come before loop over atoms
+  // since loop sets sametag
 
-    if (nall > max_same) {
-      max_same = nall + EXTRA;
-      memory->destroy(sametag);
-      memory->create(sametag,max_same,"atom:sametag");
-    }
+  if (nall > max_same) {
+    max_same = nall + EXTRA;
+    memory->destroy(sametag);
+    memory->create(sametag,max_same,"atom:sametag");
+  }
 
+  if (map_style == 1) {
     for (int i = nall-1; i >= 0 ; i--) {
       sametag[i] = map_array[tag[i]];
       map_array[tag[i]] = i;
     }
 
   } else {
-
-    // if this proc has more atoms than hash table size, call map_init()
-    //   call with 0 since max atomID in system has not changed
-    // possible reallocation of sametag must come after map_init(),
-    //   b/c map_init() may invoke map_delete(), whacking sametag
-
-    if (nall > map_nhash) map_init(0);
-    if (nall > max_same) {
-      max_same = nall + EXTRA;
-      memory->destroy(sametag);
-      memory->create(sametag,max_same,"atom:sametag");
-    }
-
-    int previous,ibucket,index;
-    tagint global;
-
-    for (int i = nall-1; i >= 0 ; i--) {
-      sametag[i] = map_find_hash(tag[i]);
-
-      // search for key
-      // if found it, just overwrite local value with index
-
-      previous = -1;
-      global = tag[i];
-      ibucket = global % map_nbucket;
-      index = map_bucket[ibucket];
-      while (index > -1) {
-        if (map_hash[index].global == global) break;
-        previous = index;
-        index = map_hash[index].next;
-      }
-      if (index > -1) {
-        map_hash[index].local = i;
-        continue;
-      }
-
-      // take one entry from free list
-      // add the new global/local pair as entry at end of bucket list
-      // special logic if this entry is 1st in bucket
-
-      index = map_free;
-      map_free = map_hash[map_free].next;
-      if (previous == -1) map_bucket[ibucket] = index;
-      else map_hash[previous].next = index;
-      map_hash[index].global = global;
-      map_hash[index].local = i;
-      map_hash[index].next = -1;
-      map_nused++;
-    }
+    map_hash->reserve(nall);
+    for (int i = nall-1; i >= 0 ; i--)
+      sametag[i] = map_hash->set(tag[i],i);
   }
 }
 
@@ -246,36 +144,7 @@ void Atom::map_set()
 void Atom::map_one(tagint global, int local)
 {
   if (map_style == 1) map_array[global] = local;
-  else {
-    // search for key
-    // if found it, just overwrite local value with index
-
-    int previous = -1;
-    int ibucket = global % map_nbucket;
-    int index = map_bucket[ibucket];
-    while (index > -1) {
-      if (map_hash[index].global == global) break;
-      previous = index;
-      index = map_hash[index].next;
-    }
-    if (index > -1) {
-      map_hash[index].local = local;
-      return;
-    }
-
-    // take one entry from free list
-    // add the new global/local pair as entry at end of bucket list
-    // special logic if this entry is 1st in bucket
-
-    index = map_free;
-    map_free = map_hash[map_free].next;
-    if (previous == -1) map_bucket[ibucket] = index;
-    else map_hash[previous].next = index;
-    map_hash[index].global = global;
-    map_hash[index].local = local;
-    map_hash[index].next = -1;
-    map_nused++;
-  }
+  else map_hash->set(global,local);
 }
 
 /* ----------------------------------------------------------------------
@@ -328,53 +197,17 @@ void Atom::map_delete()
     memory->destroy(map_array);
     map_array = NULL;
   } else {
-    if (map_nhash) {
-      delete [] map_bucket;
-      delete [] map_hash;
-      map_bucket = NULL;
-      map_hash = NULL;
-    }
-    map_nhash = 0;
+    delete map_hash;
+    map_hash = NULL;
   }
 }
 
 /* ----------------------------------------------------------------------
    lookup global ID in hash table, return local index
-   called by map() in atom.h
+   map() in atom.h does the same inline
 ------------------------------------------------------------------------- */
 
 int Atom::map_find_hash(tagint global)
 {
-  int local = -1;
-  int index = map_bucket[global % map_nbucket];
-  while (index > -1) {
-    if (map_hash[index].global == global) {
-      local = map_hash[index].local;
-      break;
-    }
-    index = map_hash[index].next;
-  }
-  return local;
-}
-
-/* ----------------------------------------------------------------------
-   return next prime larger than n
-------------------------------------------------------------------------- */
-
-int Atom::next_prime(int n)
-{
-  int factor;
-
-  int nprime = n+1;
-  if (nprime % 2 == 0) nprime++;
-  int root = static_cast<int> (sqrt(1.0*n)) + 2;
-
-  while (nprime < MAXSMALLINT) {
-    for (factor = 3; factor < root; factor++)
-      if (nprime % factor == 0) break;
-    if (factor == root) return nprime;
-    nprime += 2;
-  }
-
-  return MAXSMALLINT;
+  return map_hash->find(global);
 }
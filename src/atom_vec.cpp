@@ -106,6 +106,16 @@ int AtomVec::grow_nmax_bonus(int nmax_bonus)
   return nmax_bonus;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   styles that support binary data files override this
+------------------------------------------------------------------------- */
+
+void AtomVec::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  error->all(FLERR,"Binary Atoms section not supported for this atom style");
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -118,6 +128,18 @@ void AtomVec::data_vel(int m, char **values)
   v[m][2] = atof(values[2]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVec::data_vel(int m, double *values)
+{
+  double **v = atom->v;
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+}
+
 /* ----------------------------------------------------------------------
    pack velocity info for data file
 ------------------------------------------------------------------------- */
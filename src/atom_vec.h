@@ -89,10 +89,14 @@ class AtomVec : protected Pointers {
   virtual void create_atom(int, double *) = 0;
 
   virtual void data_atom(double *, imageint, char **) = 0;
+  virtual void data_atom(double *, imageint, double *);
   virtual void data_atom_bonus(int, char **) {}
   virtual int data_atom_hybrid(int, char **) {return 0;}
+  virtual int data_atom_hybrid(int, double *) {return 0;}
   virtual void data_vel(int, char **);
+  virtual void data_vel(int, double *);
   virtual int data_vel_hybrid(int, char **) {return 0;}
+  virtual int data_vel_hybrid(int, double *) {return 0;}
 
   virtual void pack_data(double **) = 0;
   virtual int pack_data_hybrid(int, double *) {return 0;}
@@ -160,4 +164,9 @@ E: KOKKOS package requires a kokkos enabled atom_style
 
 Self-explanatory.
 
+E: Binary Atoms section not supported for this atom style
+
+The atom style does not define how to unpack a binary record of
+the Atoms section of a data file.  Use a text data file instead.
+
 */
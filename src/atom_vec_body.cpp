@@ -1307,6 +1307,49 @@ void AtomVecBody::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecBody::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  body[nlocal] = (int) ubuf(values[2]).i;
+  if (body[nlocal] == 0) body[nlocal] = -1;
+  else if (body[nlocal] == 1) body[nlocal] = 0;
+  else error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  rmass[nlocal] = values[3];
+  if (rmass[nlocal] <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  angmom[nlocal][0] = 0.0;
+  angmom[nlocal][1] = 0.0;
+  angmom[nlocal][2] = 0.0;
+  radius[nlocal] = 0.5;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -1326,6 +1369,25 @@ int AtomVecBody::data_atom_hybrid(int nlocal, char **values)
   return 2;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecBody::data_atom_hybrid(int nlocal, double *values)
+{
+  body[nlocal] = (int) ubuf(values[0]).i;
+  if (body[nlocal] == 0) body[nlocal] = -1;
+  else if (body[nlocal] == 1) body[nlocal] = 0;
+  else error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  rmass[nlocal] = values[1];
+  if (rmass[nlocal] <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  return 2;
+}
+
 /* ----------------------------------------------------------------------
    unpack one body from Bodies section of data file
 ------------------------------------------------------------------------- */
@@ -1354,6 +1416,20 @@ void AtomVecBody::data_vel(int m, char **values)
   angmom[m][2] = atof(values[5]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecBody::data_vel(int m, double *values)
+{
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+  angmom[m][0] = values[3];
+  angmom[m][1] = values[4];
+  angmom[m][2] = values[5];
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one body in Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -1366,6 +1442,18 @@ int AtomVecBody::data_vel_hybrid(int m, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Velocities section
+------------------------------------------------------------------------- */
+
+int AtomVecBody::data_vel_hybrid(int m, double *values)
+{
+  angmom[m][0] = values[0];
+  angmom[m][1] = values[1];
+  angmom[m][2] = values[2];
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
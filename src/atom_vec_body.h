@@ -69,9 +69,13 @@ class AtomVecBody : public AtomVec {
   int unpack_restart(double *);
   void create_atom(int, double *);
   void data_atom(double *, imageint, char **);
+  void data_atom(double *, imageint, double *);
   int data_atom_hybrid(int, char **);
+  int data_atom_hybrid(int, double *);
   void data_vel(int, char **);
+  void data_vel(int, double *);
   int data_vel_hybrid(int, char **);
+  int data_vel_hybrid(int, double *);
   void pack_data(double **);
   int pack_data_hybrid(int, double *);
   void write_data(FILE *, int, double **);
@@ -897,6 +897,52 @@ void AtomVecHybrid::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecHybrid::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+  mask[nlocal] = 1;
+
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  if (atom->omega_flag) {
+    omega[nlocal][0] = 0.0;
+    omega[nlocal][1] = 0.0;
+    omega[nlocal][2] = 0.0;
+  }
+  if (atom->angmom_flag) {
+    angmom[nlocal][0] = 0.0;
+    angmom[nlocal][1] = 0.0;
+    angmom[nlocal][2] = 0.0;
+  }
+
+  // each sub-style parses sub-style specific values
+
+  int m = 5;
+  for (int k = 0; k < nstyles; k++)
+    m += styles[k]->data_atom_hybrid(nlocal,&values[m]);
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -914,6 +960,23 @@ void AtomVecHybrid::data_vel(int m, char **values)
     n += styles[k]->data_vel_hybrid(m,&values[n]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecHybrid::data_vel(int m, double *values)
+{
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+
+  // each sub-style parses sub-style specific values
+
+  int n = 3;
+  for (int k = 0; k < nstyles; k++)
+    n += styles[k]->data_vel_hybrid(m,&values[n]);
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
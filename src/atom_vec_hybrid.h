@@ -57,8 +57,11 @@ class AtomVecHybrid : public AtomVec {
   int unpack_restart(double *);
   void create_atom(int, double *);
   void data_atom(double *, imageint, char **);
+  void data_atom(double *, imageint, double *);
   int data_atom_hybrid(int, char **) {return 0;}
+  int data_atom_hybrid(int, double *) {return 0;}
   void data_vel(int, char **);
+  void data_vel(int, double *);
   void pack_data(double **);
   void write_data(FILE *, int, double **);
   void pack_vel(double **);
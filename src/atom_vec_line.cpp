@@ -1073,6 +1073,55 @@ void AtomVecLine::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecLine::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  molecule[nlocal] = (tagint) ubuf(values[1]).i;
+  type[nlocal] = (int) ubuf(values[2]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  line[nlocal] = (int) ubuf(values[3]).i;
+  if (line[nlocal] == 0) line[nlocal] = -1;
+  else if (line[nlocal] == 1) line[nlocal] = 0;
+  else error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  rmass[nlocal] = values[4];
+  if (rmass[nlocal] <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  if (line[nlocal] < 0) {
+    radius[nlocal] = 0.5;
+    rmass[nlocal] *= 4.0*MY_PI/3.0 *
+      radius[nlocal]*radius[nlocal]*radius[nlocal];
+  } else radius[nlocal] = 0.0;
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  omega[nlocal][0] = 0.0;
+  omega[nlocal][1] = 0.0;
+  omega[nlocal][2] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -1100,6 +1149,33 @@ int AtomVecLine::data_atom_hybrid(int nlocal, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecLine::data_atom_hybrid(int nlocal, double *values)
+{
+  molecule[nlocal] = (tagint) ubuf(values[0]).i;
+
+  line[nlocal] = (int) ubuf(values[1]).i;
+  if (line[nlocal] == 0) line[nlocal] = -1;
+  else if (line[nlocal] == 1) line[nlocal] = 0;
+  else error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  rmass[nlocal] = values[2];
+  if (rmass[nlocal] <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  if (line[nlocal] < 0) {
+    radius[nlocal] = 0.5;
+    rmass[nlocal] *= 4.0*MY_PI/3.0 *
+      radius[nlocal]*radius[nlocal]*radius[nlocal];
+  } else radius[nlocal] = 0.0;
+
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Lines section of data file
 ------------------------------------------------------------------------- */
@@ -1158,6 +1234,20 @@ void AtomVecLine::data_vel(int m, char **values)
   omega[m][2] = atof(values[5]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecLine::data_vel(int m, double *values)
+{
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+  omega[m][0] = values[3];
+  omega[m][1] = values[4];
+  omega[m][2] = values[5];
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -1170,6 +1260,18 @@ int AtomVecLine::data_vel_hybrid(int m, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Velocities section
+------------------------------------------------------------------------- */
+
+int AtomVecLine::data_vel_hybrid(int m, double *values)
+{
+  omega[m][0] = values[0];
+  omega[m][1] = values[1];
+  omega[m][2] = values[2];
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -999,6 +999,52 @@ void AtomVecSphere::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecSphere::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  type[nlocal] = (int) ubuf(values[1]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  radius[nlocal] = 0.5 * values[2];
+  if (radius[nlocal] < 0.0)
+    error->one(FLERR,"Invalid radius in Atoms section of data file");
+
+  double density = values[3];
+  if (density <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  if (radius[nlocal] == 0.0) rmass[nlocal] = density;
+  else
+    rmass[nlocal] = 4.0*MY_PI/3.0 *
+      radius[nlocal]*radius[nlocal]*radius[nlocal] * density;
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  omega[nlocal][0] = 0.0;
+  omega[nlocal][1] = 0.0;
+  omega[nlocal][2] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -1022,6 +1068,29 @@ int AtomVecSphere::data_atom_hybrid(int nlocal, char **values)
   return 2;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecSphere::data_atom_hybrid(int nlocal, double *values)
+{
+  radius[nlocal] = 0.5 * values[0];
+  if (radius[nlocal] < 0.0)
+    error->one(FLERR,"Invalid radius in Atoms section of data file");
+
+  double density = values[1];
+  if (density <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  if (radius[nlocal] == 0.0) rmass[nlocal] = density;
+  else
+    rmass[nlocal] = 4.0*MY_PI/3.0 *
+      radius[nlocal]*radius[nlocal]*radius[nlocal] * density;
+
+  return 2;
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -1036,6 +1105,20 @@ void AtomVecSphere::data_vel(int m, char **values)
   omega[m][2] = atof(values[5]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecSphere::data_vel(int m, double *values)
+{
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+  omega[m][0] = values[3];
+  omega[m][1] = values[4];
+  omega[m][2] = values[5];
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -1048,6 +1131,18 @@ int AtomVecSphere::data_vel_hybrid(int m, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Velocities section
+------------------------------------------------------------------------- */
+
+int AtomVecSphere::data_vel_hybrid(int m, double *values)
+{
+  omega[m][0] = values[0];
+  omega[m][1] = values[1];
+  omega[m][2] = values[2];
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -1475,6 +1475,58 @@ void AtomVecTri::data_atom(double *coord, imageint imagetmp, char **values)
   atom->nlocal++;
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Atoms section of data file
+   record values are same as text line, integers stored as int64
+   initialize other atom quantities
+------------------------------------------------------------------------- */
+
+void AtomVecTri::data_atom(double *coord, imageint imagetmp, double *values)
+{
+  int nlocal = atom->nlocal;
+  if (nlocal == nmax) grow(0);
+
+  tag[nlocal] = (tagint) ubuf(values[0]).i;
+  molecule[nlocal] = (tagint) ubuf(values[1]).i;
+  type[nlocal] = (int) ubuf(values[2]).i;
+  if (type[nlocal] <= 0 || type[nlocal] > atom->ntypes)
+    error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  tri[nlocal] = (int) ubuf(values[3]).i;
+  if (tri[nlocal] == 0) tri[nlocal] = -1;
+  else if (tri[nlocal] == 1) tri[nlocal] = 0;
+  else error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  rmass[nlocal] = values[4];
+  if (rmass[nlocal] <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  if (tri[nlocal] < 0) {
+    radius[nlocal] = 0.5;
+    rmass[nlocal] *= 4.0*MY_PI/3.0 *
+      radius[nlocal]*radius[nlocal]*radius[nlocal];
+  } else radius[nlocal] = 0.0;
+
+  x[nlocal][0] = coord[0];
+  x[nlocal][1] = coord[1];
+  x[nlocal][2] = coord[2];
+
+  image[nlocal] = imagetmp;
+
+  mask[nlocal] = 1;
+  v[nlocal][0] = 0.0;
+  v[nlocal][1] = 0.0;
+  v[nlocal][2] = 0.0;
+  omega[nlocal][0] = 0.0;
+  omega[nlocal][1] = 0.0;
+  omega[nlocal][2] = 0.0;
+  angmom[nlocal][0] = 0.0;
+  angmom[nlocal][1] = 0.0;
+  angmom[nlocal][2] = 0.0;
+
+  atom->nlocal++;
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one tri in Atoms section of data file
    initialize other atom quantities for this sub-style
@@ -1502,6 +1554,33 @@ int AtomVecTri::data_atom_hybrid(int nlocal, char **values)
   return 3;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Atoms section
+   initialize other atom quantities for this sub-style
+------------------------------------------------------------------------- */
+
+int AtomVecTri::data_atom_hybrid(int nlocal, double *values)
+{
+  molecule[nlocal] = (tagint) ubuf(values[0]).i;
+
+  tri[nlocal] = (int) ubuf(values[1]).i;
+  if (tri[nlocal] == 0) tri[nlocal] = -1;
+  else if (tri[nlocal] == 1) tri[nlocal] = 0;
+  else error->one(FLERR,"Invalid atom type in Atoms section of data file");
+
+  rmass[nlocal] = values[2];
+  if (rmass[nlocal] <= 0.0)
+    error->one(FLERR,"Invalid density in Atoms section of data file");
+
+  if (tri[nlocal] < 0) {
+    radius[nlocal] = 0.5;
+    rmass[nlocal] *= 4.0*MY_PI/3.0 *
+      radius[nlocal]*radius[nlocal]*radius[nlocal];
+  } else radius[nlocal] = 0.0;
+
+  return 3;
+}
+
 /* ----------------------------------------------------------------------
    unpack one line from Tris section of data file
 ------------------------------------------------------------------------- */
@@ -1652,6 +1731,23 @@ void AtomVecTri::data_vel(int m, char **values)
   angmom[m][2] = atof(values[8]);
 }
 
+/* ----------------------------------------------------------------------
+   unpack one binary record from Velocities section of data file
+------------------------------------------------------------------------- */
+
+void AtomVecTri::data_vel(int m, double *values)
+{
+  v[m][0] = values[0];
+  v[m][1] = values[1];
+  v[m][2] = values[2];
+  omega[m][0] = values[3];
+  omega[m][1] = values[4];
+  omega[m][2] = values[5];
+  angmom[m][0] = values[6];
+  angmom[m][1] = values[7];
+  angmom[m][2] = values[8];
+}
+
 /* ----------------------------------------------------------------------
    unpack hybrid quantities from one line in Velocities section of data file
 ------------------------------------------------------------------------- */
@@ -1667,6 +1763,21 @@ int AtomVecTri::data_vel_hybrid(int m, char **values)
   return 6;
 }
 
+/* ----------------------------------------------------------------------
+   unpack hybrid quantities from one binary record in Velocities section
+------------------------------------------------------------------------- */
+
+int AtomVecTri::data_vel_hybrid(int m, double *values)
+{
+  omega[m][0] = values[0];
+  omega[m][1] = values[1];
+  omega[m][2] = values[2];
+  angmom[m][0] = values[3];
+  angmom[m][1] = values[4];
+  angmom[m][2] = values[5];
+  return 6;
+}
+
 /* ----------------------------------------------------------------------
    pack atom info for data file including 3 image flags
 ------------------------------------------------------------------------- */
@@ -39,6 +39,7 @@
 #include "imbalance_neigh.h"
 #include "imbalance_store.h"
 #include "imbalance_var.h"
+#include "imbalance_model.h"
 #include "timer.h"
 #include "memory.h"
 #include "error.h"
@@ -457,6 +458,8 @@ void Balance::options(int iarg, int narg, char **arg)
   wtflag = 0;
   varflag = 0;
   outflag = 0;
+  compactflag = 0;
+  nodeflag = 0;
   int outarg = 0;
   fp = NULL;
 
@@ -486,11 +489,27 @@ void Balance::options(int iarg, int narg, char **arg)
         imb = new ImbalanceStore(lmp);
         nopt = imb->options(narg-iarg,arg+iarg+2);
         imbalances[nimbalance++] = imb;
+      } else if (strcmp(arg[iarg+1],"model") == 0) {
+        imb = new ImbalanceModel(lmp);
+        nopt = imb->options(narg-iarg,arg+iarg+2);
+        imbalances[nimbalance++] = imb;
       } else {
         error->all(FLERR,"Unknown (fix) balance weight method");
       }
       iarg += 2+nopt;
 
+    } else if (strcmp(arg[iarg],"compact") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal (fix) balance command");
+      if (strcmp(arg[iarg+1],"yes") == 0) compactflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) compactflag = 0;
+      else error->all(FLERR,"Illegal (fix) balance command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"node") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal (fix) balance command");
+      if (strcmp(arg[iarg+1],"yes") == 0) nodeflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) nodeflag = 0;
+      else error->all(FLERR,"Illegal (fix) balance command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"out") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal (fix) balance command");
       outflag = 1;
@@ -594,6 +613,19 @@ double Balance::imbalance_factor(double &maxcost)
   return imbalance;
 }
 
+/* ----------------------------------------------------------------------
+   return time per step a rebalance is estimated to recover
+   largest estimate of any Imbalance class, < 0.0 if none can estimate it
+------------------------------------------------------------------------- */
+
+double Balance::gain()
+{
+  double value = -1.0;
+  for (int n = 0; n < nimbalance; n++)
+    value = MAX(value,imbalances[n]->gain());
+  return value;
+}
+
 /* ----------------------------------------------------------------------
    perform balancing via RCB class
    sortflag = flag for sorting order of received messages by proc ID
@@ -603,6 +635,13 @@ double Balance::imbalance_factor(double &maxcost)
 int *Balance::bisection(int sortflag)
 {
   if (!rcb) rcb = new RCB(lmp);
+  rcb->compact = compactflag;
+
+  // node = cut between nodes first, so each node owns one compact region
+  // Comm stores the setting, since CommTiled walks the same tree of cuts
+
+  if (nodeflag) comm->node_setup();
+  comm->rcbnode = nodeflag;
 
   // NOTE: this logic is specific to orthogonal boxes, not triclinic
 
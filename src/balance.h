@@ -32,6 +32,8 @@ class Balance : protected Pointers {
   int wtflag;                     // 1 if particle weighting is used
   int varflag;                    // 1 if weight style var(iable) is used
   int outflag;                    // 1 for output of balance results to file
+  int compactflag;                // 1 if RCB cuts by extent of particles
+  int nodeflag;                   // 1 if RCB partitions across nodes first
 
   Balance(class LAMMPS *);
   ~Balance();
@@ -41,6 +43,7 @@ class Balance : protected Pointers {
   void init_imbalance(int);
   void set_weights();
   double imbalance_factor(double &);
+  double gain();
   void shift_setup(char *, int, double);
   int shift();
   int *bisection(int sortflag = 0);
@@ -45,6 +45,7 @@ enum{MULTIPLE};                   // same as in ProcMap
 enum{ONELEVEL,TWOLEVEL,NUMA,CUSTOM};
 enum{CART,CARTREORDER,XYZ};
 enum{LAYOUT_UNIFORM,LAYOUT_NONUNIFORM,LAYOUT_TILED};    // several files
+enum{AUTO,P2P,ALLTOALL,NODE};                          // same as in Irregular
 
 /* ---------------------------------------------------------------------- */
 
@@ -68,10 +69,14 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   recv_from_partition = send_to_partition = -1;
   otherflag = 0;
   maxexchange_atom = maxexchange_fix = 0;
+  msgcount = msgbytes = 0;
+  irregstyle = AUTO;
 
   grid2proc = NULL;
   xsplit = ysplit = zsplit = NULL;
   rcbnew = 0;
+  rcbnode = 0;
+  procnode = NULL;
 
   // use of OpenMP threads
   // query OpenMP for number of threads/process set by user at run-time
@@ -117,6 +122,7 @@ Comm::~Comm()
   memory->destroy(ysplit);
   memory->destroy(zsplit);
   memory->destroy(cutusermulti);
+  memory->destroy(procnode);
   delete [] customfile;
   delete [] outfile;
 }
@@ -146,7 +152,13 @@ void Comm::copy_arrays(Comm *oldcomm)
 
   if (oldcomm->cutusermulti) {
     memory->create(cutusermulti,atom->ntypes+1,"comm:cutusermulti");
-    memcpy(cutusermulti,oldcomm->cutusermulti,atom->ntypes+1);
+    memcpy(cutusermulti,oldcomm->cutusermulti,
+           (atom->ntypes+1)*sizeof(double));
+  }
+
+  if (oldcomm->procnode) {
+    memory->create(procnode,nprocs,"comm:procnode");
+    memcpy(procnode,oldcomm->procnode,nprocs*sizeof(int));
   }
 
   if (customfile) {
@@ -301,6 +313,14 @@ void Comm::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) ghost_velocity = 0;
       else error->all(FLERR,"Illegal comm_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"irregular") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"auto") == 0) irregstyle = AUTO;
+      else if (strcmp(arg[iarg+1],"p2p") == 0) irregstyle = P2P;
+      else if (strcmp(arg[iarg+1],"alltoall") == 0) irregstyle = ALLTOALL;
+      else if (strcmp(arg[iarg+1],"node") == 0) irregstyle = NODE;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal comm_modify command");
   }
 }
@@ -639,6 +659,71 @@ int Comm::coord2proc(double *x, int &igx, int &igy, int &igz)
   return grid2proc[igx][igy][igz];
 }
 
+/* ----------------------------------------------------------------------
+   determine which procs share a node, via their processor names
+   procnode[i] = lowest proc ID on same node as proc i
+   names are hashed to split procs into small groups,
+     then compared in full within each group
+------------------------------------------------------------------------- */
+
+void Comm::node_setup()
+{
+  if (procnode) return;
+
+  char name[MPI_MAX_PROCESSOR_NAME];
+  int n;
+  MPI_Get_processor_name(name,&n);
+  name[n] = '\0';
+
+  unsigned int hash = 0;
+  for (int i = 0; i < n; i++) hash = 31*hash + (unsigned char) name[i];
+
+  MPI_Comm hashcomm;
+  MPI_Comm_split(world,hash & 0x7fffffff,me,&hashcomm);
+  int nhash;
+  MPI_Comm_size(hashcomm,&nhash);
+
+  char *names = new char[nhash*MPI_MAX_PROCESSOR_NAME];
+  int *procs = new int[nhash];
+  MPI_Allgather(name,MPI_MAX_PROCESSOR_NAME,MPI_CHAR,
+                names,MPI_MAX_PROCESSOR_NAME,MPI_CHAR,hashcomm);
+  MPI_Allgather(&me,1,MPI_INT,procs,1,MPI_INT,hashcomm);
+
+  int first = me;
+  for (int i = 0; i < nhash; i++)
+    if (procs[i] < first &&
+        strcmp(&names[i*MPI_MAX_PROCESSOR_NAME],name) == 0) first = procs[i];
+
+  delete [] names;
+  delete [] procs;
+  MPI_Comm_free(&hashcomm);
+
+  memory->create(procnode,nprocs,"comm:procnode");
+  MPI_Allgather(&first,1,MPI_INT,procnode,1,MPI_INT,world);
+}
+
+/* ----------------------------------------------------------------------
+   return 1st proc in upper half when RCB splits procs proclower to procupper
+   by default the lower half gets the extra proc if # of procs is odd
+   if rcbnode is set and the procs span more than one node,
+     cut at the node boundary closest to the middle instead,
+     so that all procs of a node end up on the same side
+   used by RCB and by CommTiled to walk the tree of RCB cuts
+------------------------------------------------------------------------- */
+
+int Comm::rcb_procmid(int proclower, int procupper)
+{
+  int procmid = proclower + (procupper - proclower) / 2 + 1;
+  if (!rcbnode || procnode[proclower] == procnode[procupper]) return procmid;
+
+  int best = -1;
+  for (int i = proclower+1; i <= procupper; i++) {
+    if (procnode[i] == procnode[i-1]) continue;
+    if (best < 0 || abs(i-procmid) < abs(best-procmid)) best = i;
+  }
+  return best;
+}
+
 /* ----------------------------------------------------------------------
    binary search for value in N-length ascending vec
    value may be outside range of vec limits
@@ -39,6 +39,11 @@ class Comm : protected Pointers {
   int maxexchange_atom;             // max contribution to exchange from AtomVec
   int maxexchange_fix;              // max contribution to exchange from Fixes
   int nthreads;                     // OpenMP threads per MPI process
+  bigint msgcount;                  // # of msgs sent by forward/reverse comm,
+                                    //   exchange, borders since creation
+  bigint msgbytes;                  // # of bytes in those msgs
+  int irregstyle;                   // route of irregular comm
+                                    //   AUTO,P2P,ALLTOALL,NODE
 
   // public settings specific to layout = UNIFORM, NONUNIFORM
 
@@ -55,6 +60,11 @@ class Comm : protected Pointers {
   double mysplit[3][2];             // fractional (0-1) bounds of my sub-domain
   double rcbcutfrac;                // fractional RCB cut by this proc
   int rcbcutdim;                    // dimension of RCB cut
+  int rcbnode;                      // 1 if RCB cuts separate nodes first
+
+  // node each proc runs on, NULL until node_setup() is called
+
+  int *procnode;                    // lowest proc ID on node of each proc
 
   // methods
 
@@ -99,6 +109,11 @@ class Comm : protected Pointers {
   virtual void coord2proc_setup() {}
   virtual int coord2proc(double *, int &, int &, int &);
 
+  // node layout of procs and RCB cuts that respect it
+
+  void node_setup();
+  int rcb_procmid(int, int);
+
   // memory usage
 
   virtual bigint memory_usage() = 0;
@@ -482,7 +482,11 @@ void CommBrick::forward_comm(int dummy)
         }
         n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
                             buf_send,pbc_flag[iswap],pbc[iswap]);
-        if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+        if (n) {
+          MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
+        }
         if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
       } else if (ghost_velocity) {
         if (size_forward_recv[iswap])
@@ -490,7 +494,11 @@ void CommBrick::forward_comm(int dummy)
                     recvproc[iswap],0,world,&request);
         n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
                                 buf_send,pbc_flag[iswap],pbc[iswap]);
-        if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+        if (n) {
+          MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
+        }
         if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
         avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],buf_recv);
       } else {
@@ -499,7 +507,11 @@ void CommBrick::forward_comm(int dummy)
                     recvproc[iswap],0,world,&request);
         n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
                             buf_send,pbc_flag[iswap],pbc[iswap]);
-        if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+        if (n) {
+          MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
+        }
         if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
         avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf_recv);
       }
@@ -550,6 +562,8 @@ void CommBrick::reverse_comm()
           else buf = NULL;
           MPI_Send(buf,size_reverse_send[iswap],MPI_DOUBLE,
                    recvproc[iswap],0,world);
+          msgcount++;
+          msgbytes += size_reverse_send[iswap]*sizeof(double);
         }
         if (size_reverse_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
       } else {
@@ -557,7 +571,11 @@ void CommBrick::reverse_comm()
           MPI_Irecv(buf_recv,size_reverse_recv[iswap],MPI_DOUBLE,
                     sendproc[iswap],0,world,&request);
         n = avec->pack_reverse(recvnum[iswap],firstrecv[iswap],buf_send);
-        if (n) MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
+        if (n) {
+          MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
+        }
         if (size_reverse_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
       }
       avec->unpack_reverse(sendnum[iswap],sendlist[iswap],buf_recv);
@@ -674,12 +692,16 @@ void CommBrick::exchange()
       MPI_Irecv(buf_recv,nrecv1,MPI_DOUBLE,procneigh[dim][1],0,
                 world,&request);
       MPI_Send(buf_send,nsend,MPI_DOUBLE,procneigh[dim][0],0,world);
+      msgcount++;
+      msgbytes += nsend*sizeof(double);
       MPI_Wait(&request,MPI_STATUS_IGNORE);
 
       if (procgrid[dim] > 2) {
         MPI_Irecv(&buf_recv[nrecv1],nrecv2,MPI_DOUBLE,procneigh[dim][0],0,
                   world,&request);
         MPI_Send(buf_send,nsend,MPI_DOUBLE,procneigh[dim][1],0,world);
+        msgcount++;
+        msgbytes += nsend*sizeof(double);
         MPI_Wait(&request,MPI_STATUS_IGNORE);
       }
     }
@@ -838,7 +860,11 @@ void CommBrick::borders()
         if (nrecv*size_border > maxrecv) grow_recv(nrecv*size_border);
         if (nrecv) MPI_Irecv(buf_recv,nrecv*size_border,MPI_DOUBLE,
                              recvproc[iswap],0,world,&request);
-        if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+        if (n) {
+          MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
+        }
         if (nrecv) MPI_Wait(&request,MPI_STATUS_IGNORE);
         buf = buf_recv;
       } else {
@@ -48,6 +48,7 @@ CommTiled::CommTiled(LAMMPS *lmp) : Comm(lmp)
   style = 1;
   layout = LAYOUT_UNIFORM;
   pbc_flag = NULL;
+  cutghostmulti = NULL;
   init_buffers();
 }
 
@@ -63,6 +64,7 @@ CommTiled::CommTiled(LAMMPS *lmp, Comm *oldcomm) : Comm(*oldcomm)
   style = 1;
   layout = oldcomm->layout;
   Comm::copy_arrays(oldcomm);
+  cutghostmulti = NULL;
   init_buffers();
 }
 
@@ -74,6 +76,7 @@ CommTiled::~CommTiled()
   memory->destroy(buf_recv);
   memory->destroy(overlap);
   deallocate_swap(nswap);
+  memory->destroy(cutghostmulti);
   memory->sfree(rcbinfo);
 }
 
@@ -115,8 +118,22 @@ void CommTiled::init()
 
   if (triclinic)
     error->all(FLERR,"Cannot yet use comm_style tiled with triclinic box");
-  if (mode == MULTI)
-    error->all(FLERR,"Cannot yet use comm_style tiled with multi-mode comm");
+
+  // memory for multi-style communication
+
+  if (mode == MULTI && cutghostmulti == NULL) {
+    memory->create(cutghostmulti,atom->ntypes+1,3,"comm:cutghostmulti");
+    for (int i = 0; i < nswap; i++)
+      memory->create(sendbox_multi[i],nprocmax[i],atom->ntypes+1,6,
+                     "comm:sendbox_multi");
+  }
+  if (mode == SINGLE && cutghostmulti) {
+    memory->destroy(cutghostmulti);
+    for (int i = 0; i < nswap; i++) {
+      memory->destroy(sendbox_multi[i]);
+      sendbox_multi[i] = NULL;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -160,9 +177,25 @@ void CommTiled::setup()
   // set cutoff for comm forward and comm reverse
   // check that cutoff < any periodic box length
 
+  // for multi:
+  //   cutghostmulti = same as cutghost, only for each atom type
+  //   cut is max of them, so that procs to send to are the same
+
+  int ntypes = atom->ntypes;
   double cut = MAX(neighbor->cutneighmax,cutghostuser);
   cutghost[0] = cutghost[1] = cutghost[2] = cut;
 
+  if (mode == MULTI) {
+    double *cuttype = neighbor->cuttype;
+    for (i = 1; i <= ntypes; i++) {
+      double cutone = 0.0;
+      if (cutusermulti) cutone = cutusermulti[i];
+      cutghostmulti[i][0] = MAX(cutone,cuttype[i]);
+      cutghostmulti[i][1] = MAX(cutone,cuttype[i]);
+      cutghostmulti[i][2] = MAX(cutone,cuttype[i]);
+    }
+  }
+
   if ((periodicity[0] && cut > prd[0]) ||
       (periodicity[1] && cut > prd[1]) ||
       (dimension == 3 && periodicity[2] && cut > prd[2]))
@@ -295,6 +328,7 @@ void CommTiled::setup()
       //      = obox in other 2 dims
       // if sbox touches other proc's sub-box boundaries in lower dims,
       //   extend sbox in those lower dims to include ghost atoms
+      // for multi, also a sbox for each type, using cutoff of that type
 
       double oboxlo[3],oboxhi[3],sbox[6];
 
@@ -324,25 +358,15 @@ void CommTiled::setup()
           sbox[5] = MIN(oboxhi[2],hi2[2]);
         }
 
-        if (idir == 0) {
-          sbox[idim] = sublo[idim];
-          if (i < noverlap1) sbox[3+idim] = MIN(sbox[3+idim]+cut,subhi[idim]);
-          else sbox[3+idim] = MIN(sbox[3+idim]-prd[idim]+cut,subhi[idim]);
-        } else {
-          if (i < noverlap1) sbox[idim] = MAX(sbox[idim]-cut,sublo[idim]);
-          else sbox[idim] = MAX(sbox[idim]+prd[idim]-cut,sublo[idim]);
-          sbox[3+idim] = subhi[idim];
-        }
-
-        if (idim >= 1) {
-          if (sbox[0] == oboxlo[0]) sbox[0] -= cut;
-          if (sbox[3] == oboxhi[0]) sbox[3] += cut;
-        }
-        if (idim == 2) {
-          if (sbox[1] == oboxlo[1]) sbox[1] -= cut;
-          if (sbox[4] == oboxhi[1]) sbox[4] += cut;
+        if (mode == MULTI) {
+          for (j = 1; j <= ntypes; j++) {
+            memcpy(sendbox_multi[iswap][i][j],sbox,6*sizeof(double));
+            sendbox_cut(idim,idir,i >= noverlap1,oboxlo,oboxhi,
+                        cutghostmulti[j][idim],sendbox_multi[iswap][i][j]);
+          }
         }
 
+        sendbox_cut(idim,idir,i >= noverlap1,oboxlo,oboxhi,cut,sbox);
         memcpy(sendbox[iswap][i],sbox,6*sizeof(double));
       }
 
@@ -436,6 +460,36 @@ void CommTiled::setup()
   }
 }
 
+/* ----------------------------------------------------------------------
+   extend sbox in dim idim to all my atoms within cut of other proc's
+     sub-domain obox in direction idir, wrap = 1 if across periodic boundary
+   extend sbox in lower dims by cut if it touches boundaries of obox
+------------------------------------------------------------------------- */
+
+void CommTiled::sendbox_cut(int idim, int idir, int wrap,
+                            double *oboxlo, double *oboxhi, double cut,
+                            double *sbox)
+{
+  if (idir == 0) {
+    sbox[idim] = sublo[idim];
+    if (!wrap) sbox[3+idim] = MIN(sbox[3+idim]+cut,subhi[idim]);
+    else sbox[3+idim] = MIN(sbox[3+idim]-prd[idim]+cut,subhi[idim]);
+  } else {
+    if (!wrap) sbox[idim] = MAX(sbox[idim]-cut,sublo[idim]);
+    else sbox[idim] = MAX(sbox[idim]+prd[idim]-cut,sublo[idim]);
+    sbox[3+idim] = subhi[idim];
+  }
+
+  if (idim >= 1) {
+    if (sbox[0] == oboxlo[0]) sbox[0] -= cut;
+    if (sbox[3] == oboxhi[0]) sbox[3] += cut;
+  }
+  if (idim == 2) {
+    if (sbox[1] == oboxlo[1]) sbox[1] -= cut;
+    if (sbox[4] == oboxhi[1]) sbox[4] += cut;
+  }
+}
+
 /* ----------------------------------------------------------------------
    forward communication of atom coords every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -469,6 +523,8 @@ void CommTiled::forward_comm(int dummy)
           n = avec->pack_comm(sendnum[iswap][i],sendlist[iswap][i],
                               buf_send,pbc_flag[iswap][i],pbc[iswap][i]);
           MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][i],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
         }
       }
       if (sendself[iswap]) {
@@ -490,6 +546,8 @@ void CommTiled::forward_comm(int dummy)
           n = avec->pack_comm_vel(sendnum[iswap][i],sendlist[iswap][i],
                                   buf_send,pbc_flag[iswap][i],pbc[iswap][i]);
           MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][i],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
         }
       }
       if (sendself[iswap]) {
@@ -519,6 +577,8 @@ void CommTiled::forward_comm(int dummy)
           n = avec->pack_comm(sendnum[iswap][i],sendlist[iswap][i],
                               buf_send,pbc_flag[iswap][i],pbc[iswap][i]);
           MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][i],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
         }
       }
       if (sendself[iswap]) {
@@ -570,9 +630,12 @@ void CommTiled::reverse_comm()
         }
       }
       if (recvother[iswap]) {
-        for (i = 0; i < nrecv; i++)
+        for (i = 0; i < nrecv; i++) {
           MPI_Send(f[firstrecv[iswap][i]],size_reverse_send[iswap][i],
                    MPI_DOUBLE,recvproc[iswap][i],0,world);
+          msgcount++;
+          msgbytes += size_reverse_send[iswap][i]*sizeof(double);
+        }
       }
       if (sendself[iswap]) {
         avec->unpack_reverse(sendnum[iswap][nsend],sendlist[iswap][nsend],
@@ -599,6 +662,8 @@ void CommTiled::reverse_comm()
           n = avec->pack_reverse(recvnum[iswap][i],firstrecv[iswap][i],
                                  buf_send);
           MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap][i],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
         }
       }
       if (sendself[iswap]) {
@@ -728,6 +793,8 @@ void CommTiled::exchange()
     }
     for (m = 0; m < nexch; m++)
       MPI_Send(buf_send,nsend,MPI_DOUBLE,exchproc[dim][m],0,world);
+    msgcount += nexch;
+    msgbytes += (bigint) nexch*nsend*sizeof(double);
     MPI_Waitall(nexch,requests,MPI_STATUS_IGNORE);
 
     // check incoming atoms to see if I own it and they are in my box
@@ -786,7 +853,7 @@ void CommTiled::borders()
     // for x-dim swaps, check owned atoms
     // for yz-dim swaps, check owned and ghost atoms
     // store sent atom indices in sendlist for use in future timesteps
-    // NOTE: assume SINGLE mode, add logic for MULTI mode later
+    // for multi, test each atom against sendbox of its type
 
     x = atom->x;
     if (iswap % 2 == 0) nlast = atom->nlocal + atom->nghost;
@@ -799,7 +866,22 @@ void CommTiled::borders()
 
       ncount = 0;
 
-      if (!bordergroup) {
+      if (mode == MULTI) {
+        int *type = atom->type;
+        double **sbox_multi = sendbox_multi[iswap][m];
+
+        for (i = 0; i < nlast; i++) {
+          if (bordergroup && i >= atom->nfirst && i < atom->nlocal) continue;
+          bbox = sbox_multi[type[i]];
+          if (x[i][0] >= bbox[0] && x[i][0] < bbox[3] &&
+              x[i][1] >= bbox[1] && x[i][1] < bbox[4] &&
+              x[i][2] >= bbox[2] && x[i][2] < bbox[5]) {
+            if (ncount == maxsendlist[iswap][m]) grow_list(iswap,m,ncount);
+            sendlist[iswap][m][ncount++] = i;
+          }
+        }
+
+      } else if (!bordergroup) {
         for (i = 0; i < nlast; i++) {
           if (x[i][0] >= xlo && x[i][0] < xhi &&
               x[i][1] >= ylo && x[i][1] < yhi &&
@@ -899,6 +981,8 @@ void CommTiled::borders()
           n = avec->pack_border_vel(sendnum[iswap][m],sendlist[iswap][m],
                                     buf_send,pbc_flag[iswap][m],pbc[iswap][m]);
           MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][m],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
         }
       }
       if (sendself[iswap]) {
@@ -928,6 +1012,8 @@ void CommTiled::borders()
           n = avec->pack_border(sendnum[iswap][m],sendlist[iswap][m],
                                 buf_send,pbc_flag[iswap][m],pbc[iswap][m]);
           MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][m],0,world);
+          msgcount++;
+          msgbytes += n*sizeof(double);
         }
       }
       if (sendself[iswap]) {
@@ -1542,7 +1628,7 @@ void CommTiled::box_drop_tiled_recurse(double *lo, double *hi,
   // dim = 0,1,2 dimension of cut
   // cut = position of cut
 
-  int procmid = proclower + (procupper - proclower) / 2 + 1;
+  int procmid = rcb_procmid(proclower,procupper);
   int idim = rcbinfo[procmid].dim;
   double cut = boxlo[idim] + prd[idim]*rcbinfo[procmid].cutfrac;
 
@@ -1749,7 +1835,7 @@ int CommTiled::point_drop_tiled_recurse(double *x,
   // dim = 0,1,2 dimension of cut
   // cut = position of cut
 
-  int procmid = proclower + (procupper - proclower) / 2 + 1;
+  int procmid = rcb_procmid(proclower,procupper);
   int idim = rcbinfo[procmid].dim;
   double cut = boxlo[idim] + prd[idim]*rcbinfo[procmid].cutfrac;
 
@@ -1877,6 +1963,7 @@ void CommTiled::allocate_swap(int n)
   pbc_flag = new int*[n];
   pbc = new int**[n];
   sendbox = new double**[n];
+  sendbox_multi = new double***[n];
   maxsendlist = new int*[n];
   sendlist = new int**[n];
 
@@ -1890,6 +1977,7 @@ void CommTiled::allocate_swap(int n)
     pbc_flag[i] = NULL;
     pbc[i] = NULL;
     sendbox[i] = NULL;
+    sendbox_multi[i] = NULL;
     maxsendlist[i] = NULL;
     sendlist[i] = NULL;
   }
@@ -1938,6 +2026,10 @@ void CommTiled::grow_swap_send(int i, int n, int nold)
   memory->create(pbc[i],n,6,"comm:pbc_flag");
   memory->destroy(sendbox[i]);
   memory->create(sendbox[i],n,6,"comm:sendbox");
+  if (cutghostmulti) {
+    memory->destroy(sendbox_multi[i]);
+    memory->create(sendbox_multi[i],n,atom->ntypes+1,6,"comm:sendbox_multi");
+  }
 
   delete [] maxsendlist[i];
   maxsendlist[i] = new int[n];
@@ -1996,6 +2088,7 @@ void CommTiled::deallocate_swap(int n)
     delete [] pbc_flag[i];
     memory->destroy(pbc[i]);
     memory->destroy(sendbox[i]);
+    memory->destroy(sendbox_multi[i]);
     delete [] maxsendlist[i];
 
     for (int j = 0; j < nprocmax[i]; j++) memory->destroy(sendlist[i][j]);
@@ -2016,6 +2109,7 @@ void CommTiled::deallocate_swap(int n)
   delete [] pbc_flag;
   delete [] pbc;
   delete [] sendbox;
+  delete [] sendbox_multi;
   delete [] maxsendlist;
   delete [] sendlist;
 
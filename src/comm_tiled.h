@@ -77,6 +77,12 @@ class CommTiled : public Comm {
 
   double ***sendbox;            // bounding box of atoms to send per swap/proc
 
+  // extra comm info for mode = MULTI, NULL for mode = SINGLE
+
+  double **cutghostmulti;       // cutghost on a per-type basis
+  double ****sendbox_multi;     // bounding box of atoms of each type
+                                //   to send per swap/proc
+
   // exchange comm info, proc lists do not include self
 
   int *nexchproc;               // # of procs to send/recv to/from in each dim
@@ -115,6 +121,8 @@ class CommTiled : public Comm {
   // NOTE: init_buffers is called from a constructor and must not be made virtual
   void init_buffers();
 
+  void sendbox_cut(int, int, int, double *, double *, double, double *);
+
   // box drop and other functions
 
   typedef void (CommTiled::*BoxDropPtr)(int, double *, double *, int &);
@@ -163,10 +171,6 @@ E: Cannot yet use comm_style tiled with triclinic box
 
 Self-explanatory.
 
-E: Cannot yet use comm_style tiled with multi-mode comm
-
-Self-explanatory.
-
 E: Communication cutoff for comm_style tiled cannot exceed periodic box length
 
 Self-explanatory.
@@ -24,6 +24,7 @@
 #include "modify.h"
 #include "fix.h"
 #include "atom_masks.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 
@@ -69,6 +70,8 @@ Compute::Compute(LAMMPS *lmp, int narg, char **arg) :
   style = new char[n];
   strcpy(style,arg[2]);
 
+  itimer = -1;
+
   // set child class defaults
 
   scalar_flag = vector_flag = array_flag = 0;
@@ -173,6 +176,55 @@ void Compute::reset_extra_compute_fix(const char *)
              "Compute does not allow an extra compute or fix to be reset");
 }
 
+/* ----------------------------------------------------------------------
+   invoke compute_scalar() etc and accumulate the time spent in them
+     on this compute's detail timer, used by all callers of a compute
+------------------------------------------------------------------------- */
+
+double Compute::invoke_scalar()
+{
+  timer->detail_start(itimer);
+  double value = compute_scalar();
+  timer->detail_stop(itimer);
+  return value;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::invoke_vector()
+{
+  timer->detail_start(itimer);
+  compute_vector();
+  timer->detail_stop(itimer);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::invoke_array()
+{
+  timer->detail_start(itimer);
+  compute_array();
+  timer->detail_stop(itimer);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::invoke_peratom()
+{
+  timer->detail_start(itimer);
+  compute_peratom();
+  timer->detail_stop(itimer);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Compute::invoke_local()
+{
+  timer->detail_start(itimer);
+  compute_local();
+  timer->detail_stop(itimer);
+}
+
 /* ----------------------------------------------------------------------
    add ntimestep to list of timesteps the compute will be called on
    do not add if already in list
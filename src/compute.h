@@ -24,6 +24,7 @@ class Compute : protected Pointers {
 
   char *id,*style;
   int igroup,groupbit;
+  int itimer;               // index of per-compute timer in Timer
 
   double scalar;            // computed global scalar
   double *vector;           // computed global vector
@@ -106,6 +107,14 @@ class Compute : protected Pointers {
   virtual void compute_local() {}
   virtual void set_arrays(int) {}
 
+  // wrappers on compute_scalar() etc that time the call for timer detail
+
+  double invoke_scalar();
+  void invoke_vector();
+  void invoke_array();
+  void invoke_peratom();
+  void invoke_local();
+
   virtual int pack_forward_comm(int, int *, double *, int, int *) {return 0;}
   virtual void unpack_forward_comm(int, int, double *) {}
   virtual int pack_reverse_comm(int, int, double *) {return 0;}
@@ -953,7 +953,7 @@ void ComputeChunkAtom::assign_chunk_ids()
 
   } else if (which == COMPUTE) {
     if (!(cchunk->invoked_flag & INVOKED_PERATOM)) {
-      cchunk->compute_peratom();
+      cchunk->invoke_peratom();
       cchunk->invoked_flag |= INVOKED_PERATOM;
     }
 
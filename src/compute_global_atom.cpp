@@ -344,7 +344,7 @@ void ComputeGlobalAtom::compute_peratom()
     Compute *compute = modify->compute[ref2index];
     
     if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-      compute->compute_peratom();
+      compute->invoke_peratom();
       compute->invoked_flag |= INVOKED_PERATOM;
     }
 
@@ -407,7 +407,7 @@ void ComputeGlobalAtom::compute_peratom()
         Compute *compute = modify->compute[value2index[m]];
 
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         
@@ -465,7 +465,7 @@ void ComputeGlobalAtom::compute_peratom()
         Compute *compute = modify->compute[value2index[m]];
 
         if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-          compute->compute_array();
+          compute->invoke_array();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
           
@@ -186,7 +186,7 @@ double ComputePressure::compute_scalar()
   double t;
   if (keflag) {
     if (temperature->invoked_scalar != update->ntimestep)
-      t = temperature->compute_scalar();
+      t = temperature->invoke_scalar();
     else t = temperature->scalar;
   }
 
@@ -231,7 +231,7 @@ void ComputePressure::compute_vector()
   double *ke_tensor;
   if (keflag) {
     if (temperature->invoked_vector != update->ntimestep)
-      temperature->compute_vector();
+      temperature->invoke_vector();
     ke_tensor = temperature->vector;
   }
 
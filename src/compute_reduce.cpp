@@ -502,7 +502,7 @@ double ComputeReduce::compute_one(int m, int flag)
 
     if (flavor[m] == PERATOM) {
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-        compute->compute_peratom();
+        compute->invoke_peratom();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
 
@@ -525,7 +525,7 @@ double ComputeReduce::compute_one(int m, int flag)
 
     } else if (flavor[m] == LOCAL) {
       if (!(compute->invoked_flag & INVOKED_LOCAL)) {
-        compute->compute_local();
+        compute->invoke_local();
         compute->invoked_flag |= INVOKED_LOCAL;
       }
 
@@ -104,7 +104,7 @@ double ComputeReduceRegion::compute_one(int m, int flag)
 
     if (flavor[m] == PERATOM) {
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-        compute->compute_peratom();
+        compute->invoke_peratom();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
 
@@ -129,7 +129,7 @@ double ComputeReduceRegion::compute_one(int m, int flag)
 
     } else if (flavor[m] == LOCAL) {
       if (!(compute->invoked_flag & INVOKED_LOCAL)) {
-        compute->compute_local();
+        compute->invoke_local();
         compute->invoked_flag |= INVOKED_LOCAL;
       }
 
@@ -291,7 +291,7 @@ void ComputeSlice::extract_one(int m, double *vec, int stride)
 
     if (argindex[m] == 0) {
       if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-        compute->compute_vector();
+        compute->invoke_vector();
         compute->invoked_flag |= INVOKED_VECTOR;
       }
       double *cvector = compute->vector;
@@ -303,7 +303,7 @@ void ComputeSlice::extract_one(int m, double *vec, int stride)
 
     } else {
       if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-        compute->compute_array();
+        compute->invoke_array();
         compute->invoked_flag |= INVOKED_ARRAY;
       }
       double **carray = compute->array;
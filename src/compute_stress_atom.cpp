@@ -293,7 +293,7 @@ void ComputeStressAtom::compute_peratom()
       // this insures bias factor is pre-computed
 
       if (keflag && temperature->invoked_scalar != update->ntimestep)
-	temperature->compute_scalar();
+	temperature->invoke_scalar();
 
       if (rmass) {
 	for (i = 0; i < nlocal; i++)
@@ -206,7 +206,7 @@ double ComputeTempChunk::compute_scalar()
   // remove velocity bias
 
   if (biasflag) {
-    if (tbias->invoked_scalar != update->ntimestep) tbias->compute_scalar();
+    if (tbias->invoked_scalar != update->ntimestep) tbias->invoke_scalar();
     tbias->remove_bias_all();
   }
 
@@ -318,7 +318,7 @@ void ComputeTempChunk::compute_vector()
   // remove velocity bias
 
   if (biasflag) {
-    if (tbias->invoked_scalar != update->ntimestep) tbias->compute_scalar();
+    if (tbias->invoked_scalar != update->ntimestep) tbias->invoke_scalar();
     tbias->remove_bias_all();
   }
 
@@ -402,7 +402,7 @@ void ComputeTempChunk::compute_array()
   // remove velocity bias
 
   if (biasflag) {
-    if (tbias->invoked_scalar != update->ntimestep) tbias->compute_scalar();
+    if (tbias->invoked_scalar != update->ntimestep) tbias->invoke_scalar();
     tbias->remove_bias_all();
   }
 
@@ -12,6 +12,7 @@
 ------------------------------------------------------------------------- */
 
 #include <mpi.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -21,6 +22,7 @@
 #include "update.h"
 #include "domain.h"
 #include "group.h"
+#include "comm.h"
 #include "output.h"
 #include "memory.h"
 #include "error.h"
@@ -39,6 +41,27 @@ Dump *Dump::dumpptr;
 
 enum{ASCEND,DESCEND};
 
+#define FASTINTWIDTH 24      // max chars of a fast int value plus separator
+#define FASTFLOATWIDTH 16    // max chars of a fast float value plus separator
+#define FASTCHUNK 65536      // lines converted at once by write_lines_fast()
+
+// exact powers of 10 representable as doubles
+
+static const double fast_pow10[23] =
+  {1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9,
+   1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18,
+   1.0e19, 1.0e20, 1.0e21, 1.0e22};
+
+#if defined(LAMMPS_ASYNC_DUMP)
+// entry point of I/O thread
+
+static void *dump_async_worker(void *ptr)
+{
+  ((Dump *) ptr)->async_loop();
+  return NULL;
+}
+#endif
+
 /* ---------------------------------------------------------------------- */
 
 Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
@@ -52,6 +75,7 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
 
   igroup = group->find(arg[1]);
   groupbit = group->bitmask[igroup];
+  itimer = -1;
 
   n = strlen(arg[2]) + 1;
   style = new char[n];
@@ -65,6 +89,7 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
 
   first_flag = 0;
   flush_flag = 1;
+  index_flag = 0;
 
   format = NULL;
   format_default = NULL;
@@ -80,6 +105,11 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   append_flag = 0;
   buffer_allow = 0;
   buffer_flag = 0;
+  async_allow = 0;
+  async_flag = 0;
+  fastflag = 0;
+  fasttrail = 0;
+  fastcol = NULL;
   padflag = 0;
   pbcflag = 0;
   
@@ -96,6 +126,12 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   xpbc = vpbc = NULL;
   imagepbc = NULL;
 
+  async_active = 0;
+  nstage = maxstage = maxchunk = 0;
+  stage = NULL;
+  stagecount = NULL;
+  stagebytes = NULL;
+
   // parse filename for special syntax
   // if contains '%', write one file per proc and replace % with proc-ID
   // if contains '*', write one file per timestep and replace * with timestep
@@ -105,6 +141,7 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   //   else ASCII text file
 
   fp = NULL;
+  fpindex = NULL;
   singlefile_opened = 0;
   compressed = 0;
   binary = 0;
@@ -145,6 +182,26 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
 
 Dump::~Dump()
 {
+  // I/O thread is idle, since Output flushes dumps before deleting them
+  // tell it to exit
+
+#if defined(LAMMPS_ASYNC_DUMP)
+  if (async_active) {
+    pthread_mutex_lock(&async_mutex);
+    async_quit = 1;
+    pthread_cond_broadcast(&async_cond);
+    pthread_mutex_unlock(&async_mutex);
+    pthread_join(iothread,NULL);
+    pthread_mutex_destroy(&async_mutex);
+    pthread_cond_destroy(&async_cond);
+  }
+#endif
+
+  memory->destroy(stage);
+  memory->destroy(stagecount);
+  memory->destroy(stagebytes);
+  memory->destroy(fastcol);
+
   delete [] id;
   delete [] style;
   delete [] filename;
@@ -177,6 +234,8 @@ Dump::~Dump()
   
   if (multiproc) MPI_Comm_free(&clustercomm);
 
+  if (fpindex) fclose(fpindex);
+
   // XTC style sets fp to NULL since it closes file in its destructor
 
   if (multifile == 0 && fp != NULL) {
@@ -195,6 +254,16 @@ void Dump::init()
 {
   init_style();
 
+  // async output only for dumps in Output's list
+  // a dump created by write_dump is deleted right after its one snapshot
+
+  if (async_flag) {
+    int idump;
+    for (idump = 0; idump < output->ndump; idump++)
+      if (output->dump[idump] == this) break;
+    if (idump == output->ndump) async_flag = 0;
+  }
+
   if (!sort_flag) {
     memory->destroy(bufsort);
     memory->destroy(ids);
@@ -301,6 +370,11 @@ void Dump::write()
   imageint *imagehold;
   double **xhold,**vhold;
 
+  // previous snapshot must be written before file is used again
+
+  if (async_active) async_flush();
+  nstage = 0;
+
   // if file per timestep, open new file
 
   if (multifile) openfile();
@@ -348,7 +422,10 @@ void Dump::write()
   if (multiproc)
     MPI_Allreduce(&bnme,&nheader,1,MPI_LMP_BIGINT,MPI_SUM,clustercomm);
 
-  if (filewriter) write_header(nheader);
+  if (filewriter) {
+    if (index_flag) write_index(nheader);
+    write_header(nheader);
+  }
 
   // insure buf is sized for packing and communicating
   // use nmax to insure filewriter proc can receive info from others
@@ -436,9 +513,11 @@ void Dump::write()
           nlines /= size_one;
         } else nlines = nme;
 
-        write_data(nlines,buf);
+        if (async_flag) stage_chunk(nlines,(bigint) nlines*size_one*sizeof(double),buf);
+        else write_data(nlines,buf);
       }
-      if (flush_flag && fp) fflush(fp);
+      if (async_flag) async_start();
+      else if (flush_flag && fp) fflush(fp);
 
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
@@ -457,9 +536,11 @@ void Dump::write()
           MPI_Get_count(&status,MPI_CHAR,&nchars);
         } else nchars = nsme;
 
-        write_data(nchars,(double *) sbuf);
+        if (async_flag) stage_chunk(nchars,nchars,sbuf);
+        else write_data(nchars,(double *) sbuf);
       }
-      if (flush_flag && fp) fflush(fp);
+      if (async_flag) async_start();
+      else if (flush_flag && fp) fflush(fp);
 
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
@@ -476,8 +557,9 @@ void Dump::write()
   }
 
   // if file per timestep, close file if I am filewriter
+  // I/O thread closes it after writing the snapshot
 
-  if (multifile) {
+  if (multifile && !(async_flag && filewriter)) {
     if (compressed) {
       if (filewriter && fp != NULL) pclose(fp);
     } else {
@@ -487,6 +569,367 @@ void Dump::write()
   }
 }
 
+/* ----------------------------------------------------------------------
+   write integer into str, same as "%d" or BIGINT_FORMAT
+   return # of chars written, str is not NULL terminated
+------------------------------------------------------------------------- */
+
+static inline int fast_int(char *str, bigint value)
+{
+  char digits[24];
+  int n = 0;
+  int m = 0;
+
+  if (value < 0) str[m++] = '-';
+  do {
+    bigint q = value / 10;
+    int r = static_cast<int> (value - q*10);
+    digits[n++] = '0' + (r < 0 ? -r : r);
+    value = q;
+  } while (value);
+
+  while (n) str[m++] = digits[--n];
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   return current byte offset in dump file, -1 if not seekable
+   derived classes that write to a different stream override this
+------------------------------------------------------------------------- */
+
+bigint Dump::file_offset()
+{
+  if (fp == NULL || compressed) return -1;
+  return ftell(fp);
+}
+
+/* ----------------------------------------------------------------------
+   append entry for snapshot about to be written to frame index file
+   entry = timestep, byte offset of snapshot header in dump file,
+     # of atoms, box bounds and tilt factors
+   index file = dump file name with ".idx" appended
+------------------------------------------------------------------------- */
+
+void Dump::write_index(bigint ndump)
+{
+  bigint offset = file_offset();
+  if (offset < 0) error->one(FLERR,"Cannot write index for this dump file");
+
+  if (fpindex == NULL) {
+    char *filecurrent = filename;
+    if (multiproc) filecurrent = multiname;
+    char *indexname = new char[strlen(filecurrent) + 8];
+    sprintf(indexname,"%s.idx",filecurrent);
+    if (append_flag) fpindex = fopen(indexname,"a");
+    else fpindex = fopen(indexname,"w");
+    if (fpindex == NULL) {
+      char str[128];
+      sprintf(str,"Cannot open dump index file %s",indexname);
+      error->one(FLERR,str);
+    }
+    delete [] indexname;
+  }
+
+  double xy = 0.0, xz = 0.0, yz = 0.0;
+  if (domain->triclinic) {
+    xy = boxxy;
+    xz = boxxz;
+    yz = boxyz;
+  }
+
+  fprintf(fpindex,BIGINT_FORMAT " " BIGINT_FORMAT " " BIGINT_FORMAT
+          " %-1.16g %-1.16g %-1.16g %-1.16g %-1.16g %-1.16g"
+          " %-1.16g %-1.16g %-1.16g\n",
+          update->ntimestep,offset,ndump,boxxlo,boxxhi,boxylo,boxyhi,
+          boxzlo,boxzhi,xy,xz,yz);
+  if (flush_flag) fflush(fpindex);
+}
+
+/* ----------------------------------------------------------------------
+   write double into str via sprintf() with "%g"
+------------------------------------------------------------------------- */
+
+static int slow_float(char *str, double value)
+{
+  char buf[32];
+  int n = sprintf(buf,"%g",value);
+  memcpy(str,buf,n);
+  return n;
+}
+
+/* ----------------------------------------------------------------------
+   write double into str, same as "%g"
+   6 significant digits are found by scaling with an exact power of 10,
+     which is correctly rounded unless the scaled value is within
+     round-off of a tie, in that case and for special values use sprintf()
+   return # of chars written, str is not NULL terminated
+------------------------------------------------------------------------- */
+
+static inline int fast_float(char *str, double value)
+{
+  double a = fabs(value);
+  if (!(a >= 1.0e-300 && a <= 1.0e300)) return slow_float(str,value);
+
+  // x = decimal exponent, scaled = a / 10^(x-5) in [1e5,1e6)
+
+  int x = static_cast<int> (floor(log10(a)));
+  int k = 5 - x;
+  double scaled = 0.0;
+  if (k >= -22 && k <= 22) {
+    scaled = (k >= 0) ? a*fast_pow10[k] : a/fast_pow10[-k];
+    if (scaled < 1.0e5) k++;
+    else if (scaled >= 1.0e6) k--;
+    if (k >= -22 && k <= 22)
+      scaled = (k >= 0) ? a*fast_pow10[k] : a/fast_pow10[-k];
+    x = 5 - k;
+  }
+
+  if (k < -22 || k > 22) return slow_float(str,value);
+
+  double whole = floor(scaled);
+  double frac = scaled - whole;
+  if (fabs(frac-0.5) < 1.0e-8) return slow_float(str,value);
+
+  int digits = static_cast<int> (whole);
+  if (frac > 0.5) digits++;
+  if (digits >= 1000000) {
+    digits /= 10;
+    x++;
+  }
+  if (digits < 100000) return slow_float(str,value);
+
+  char d[6];
+  for (int i = 5; i >= 0; i--) {
+    d[i] = '0' + digits % 10;
+    digits /= 10;
+  }
+  int nd = 6;
+  while (nd > 1 && d[nd-1] == '0') nd--;
+
+  int m = 0;
+  if (value < 0.0) str[m++] = '-';
+
+  if (x < -4 || x >= 6) {
+    str[m++] = d[0];
+    if (nd > 1) {
+      str[m++] = '.';
+      for (int i = 1; i < nd; i++) str[m++] = d[i];
+    }
+    str[m++] = 'e';
+    str[m++] = (x < 0) ? '-' : '+';
+    if (x < 0) x = -x;
+    if (x >= 100) str[m++] = '0' + x/100;
+    str[m++] = '0' + (x/10) % 10;
+    str[m++] = '0' + x % 10;
+  } else if (x >= 0) {
+    for (int i = 0; i <= x; i++) str[m++] = d[i];
+    if (nd > x+1) {
+      str[m++] = '.';
+      for (int i = x+1; i < nd; i++) str[m++] = d[i];
+    }
+  } else {
+    str[m++] = '0';
+    str[m++] = '.';
+    for (int i = 0; i < -x-1; i++) str[m++] = '0';
+    for (int i = 0; i < nd; i++) str[m++] = d[i];
+  }
+
+  return m;
+}
+
+/* ----------------------------------------------------------------------
+   convert N lines of mybuf into sbuf via fast routines for each column
+   sbuf is sized for longest possible lines, so it is grown only once
+   with OpenMP, each thread converts a contiguous range of lines
+     into its part of sbuf, then the parts are compacted in order
+   return # of chars in sbuf, -1 if sbuf would be too large
+------------------------------------------------------------------------- */
+
+int Dump::convert_fast(int n, double *mybuf)
+{
+  int linemax = 1;
+  for (int j = 0; j < size_one; j++)
+    linemax += (fastcol[j] == FASTINT) ? FASTINTWIDTH : FASTFLOATWIDTH;
+
+  bigint nbytes = (bigint) n * linemax + 1;
+  if (nbytes > MAXSMALLINT) return -1;
+  if (nbytes > maxsbuf) {
+    maxsbuf = nbytes;
+    memory->grow(sbuf,maxsbuf,"dump:sbuf");
+  }
+
+  int nthreads = comm->nthreads;
+  if (n < nthreads*FASTCHUNK/16) nthreads = 1;
+  int *nchars = new int[nthreads];
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(nthreads) schedule(static,1)
+#endif
+  for (int t = 0; t < nthreads; t++) {
+    int ifrom = static_cast<int> ((bigint) n * t / nthreads);
+    int ito = static_cast<int> ((bigint) n * (t+1) / nthreads);
+    char *start = &sbuf[(bigint) ifrom * linemax];
+    char *ptr = start;
+    double *values = &mybuf[(bigint) ifrom * size_one];
+
+    for (int i = ifrom; i < ito; i++) {
+      for (int j = 0; j < size_one; j++) {
+        if (fastcol[j] == FASTINT)
+          ptr += fast_int(ptr,static_cast<bigint> (values[j]));
+        else ptr += fast_float(ptr,values[j]);
+        if (j < size_one-1 || fasttrail) *ptr++ = ' ';
+      }
+      *ptr++ = '\n';
+      values += size_one;
+    }
+    nchars[t] = ptr - start;
+  }
+
+  int offset = nchars[0];
+  for (int t = 1; t < nthreads; t++) {
+    int ifrom = static_cast<int> ((bigint) n * t / nthreads);
+    memmove(&sbuf[offset],&sbuf[(bigint) ifrom * linemax],nchars[t]);
+    offset += nchars[t];
+  }
+  sbuf[offset] = '\0';
+
+  delete [] nchars;
+  return offset;
+}
+
+/* ----------------------------------------------------------------------
+   write N lines of mybuf to file via fast routines, in chunks of lines
+------------------------------------------------------------------------- */
+
+void Dump::write_lines_fast(int n, double *mybuf)
+{
+  for (int i = 0; i < n; i += FASTCHUNK) {
+    int nlines = MIN(FASTCHUNK,n-i);
+    int nchars = convert_fast(nlines,&mybuf[(bigint) i * size_one]);
+    fwrite(sbuf,sizeof(char),nchars,fp);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   append a chunk of N lines (or chars) of nbytes to stage
+   called by filewriter for each proc in its cluster
+------------------------------------------------------------------------- */
+
+void Dump::stage_chunk(int n, bigint nbytes, void *ptr)
+{
+  bigint offset = 0;
+  for (int i = 0; i < nstage; i++) offset += stagebytes[i];
+
+  // limit stage to int since memory->grow() takes an int size
+
+  if (offset + nbytes > maxstage) {
+    maxstage = offset + nbytes;
+    if (maxstage > MAXSMALLINT)
+      error->one(FLERR,"Too much staged info for dump");
+    memory->grow(stage,maxstage,"dump:stage");
+  }
+  if (nstage == maxchunk) {
+    maxchunk += nclusterprocs;
+    memory->grow(stagecount,maxchunk,"dump:stagecount");
+    memory->grow(stagebytes,maxchunk,"dump:stagebytes");
+  }
+
+  if (nbytes) memcpy(&stage[offset],ptr,nbytes);
+  stagecount[nstage] = n;
+  stagebytes[nstage] = nbytes;
+  nstage++;
+}
+
+/* ----------------------------------------------------------------------
+   write staged chunks to file, invoked by I/O thread
+   closes file if one file per timestep
+------------------------------------------------------------------------- */
+
+void Dump::write_stage()
+{
+  bigint offset = 0;
+  for (int i = 0; i < nstage; i++) {
+    write_data(stagecount[i],(double *) &stage[offset]);
+    offset += stagebytes[i];
+  }
+  if (flush_flag && fp) fflush(fp);
+
+  if (multifile && fp != NULL) {
+    if (compressed) pclose(fp);
+    else fclose(fp);
+    fp = NULL;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   hand staged snapshot to I/O thread, create thread on first use
+   filewriter returns immediately, file must not be touched until
+     async_flush() returns
+------------------------------------------------------------------------- */
+
+void Dump::async_start()
+{
+#if defined(LAMMPS_ASYNC_DUMP)
+  if (!async_active) {
+    async_pending = async_quit = 0;
+    pthread_mutex_init(&async_mutex,NULL);
+    pthread_cond_init(&async_cond,NULL);
+    pthread_create(&iothread,NULL,&dump_async_worker,this);
+    async_active = 1;
+  }
+
+  pthread_mutex_lock(&async_mutex);
+  async_pending = 1;
+  pthread_cond_broadcast(&async_cond);
+  pthread_mutex_unlock(&async_mutex);
+#else
+  write_stage();
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   wait until I/O thread has written pending snapshot
+   called before next snapshot, at end of run, before dump is changed
+     or deleted by Output
+------------------------------------------------------------------------- */
+
+void Dump::async_flush()
+{
+#if defined(LAMMPS_ASYNC_DUMP)
+  if (!async_active) return;
+  pthread_mutex_lock(&async_mutex);
+  while (async_pending) pthread_cond_wait(&async_cond,&async_mutex);
+  pthread_mutex_unlock(&async_mutex);
+#endif
+}
+
+#if defined(LAMMPS_ASYNC_DUMP)
+
+/* ----------------------------------------------------------------------
+   I/O thread waits for a staged snapshot, writes it, signals completion
+   exits when told to and no snapshot is pending
+------------------------------------------------------------------------- */
+
+void Dump::async_loop()
+{
+  pthread_mutex_lock(&async_mutex);
+  while (1) {
+    while (!async_pending && !async_quit)
+      pthread_cond_wait(&async_cond,&async_mutex);
+    if (!async_pending) break;
+
+    pthread_mutex_unlock(&async_mutex);
+    write_stage();
+    pthread_mutex_lock(&async_mutex);
+
+    async_pending = 0;
+    pthread_cond_broadcast(&async_cond);
+  }
+  pthread_mutex_unlock(&async_mutex);
+}
+
+#endif
+
 /* ----------------------------------------------------------------------
    generic opening of a dump file
    ASCII or binary or gzipped
@@ -651,7 +1094,7 @@ void Dump::sort()
     // exchange datums, destroy plan
     // if sorting on atom IDs, exchange IDs also
 
-    nme = irregular->create_data(nme,proclist);
+    nme = irregular->create_data(nme,proclist,0,size_one*sizeof(double));
 
     if (nme > maxsort) {
       maxsort = nme;
@@ -794,6 +1237,20 @@ void Dump::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal dump_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) async_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) async_flag = 0;
+      else error->all(FLERR,"Illegal dump_modify command");
+      if (async_flag && async_allow == 0)
+        error->all(FLERR,"Dump_modify async yes not allowed for this style");
+#if !defined(LAMMPS_ASYNC_DUMP)
+      if (async_flag)
+        error->all(FLERR,"Dump_modify async yes requires LAMMPS be built "
+                   "with -DLAMMPS_ASYNC_DUMP");
+#endif
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"buffer") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) buffer_flag = 1;
@@ -864,6 +1321,15 @@ void Dump::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal dump_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"index") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) index_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) index_flag = 0;
+      else error->all(FLERR,"Illegal dump_modify command");
+      if (index_flag && multifile)
+        error->all(FLERR,"Dump_modify index not allowed with * in filename");
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"format") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
 
@@ -994,6 +1460,7 @@ bigint Dump::memory_usage()
 {
   bigint bytes = memory->usage(buf,size_one*maxbuf);
   bytes += memory->usage(sbuf,maxsbuf);
+  bytes += memory->usage(stage,maxstage);
   if (sort_flag) {
     if (sortcol == 0) bytes += memory->usage(ids,maxids);
     bytes += memory->usage(bufsort,size_one*maxsort);
@@ -18,6 +18,10 @@
 #include <stdio.h>
 #include "pointers.h"
 
+#if defined(LAMMPS_ASYNC_DUMP)
+#include <pthread.h>
+#endif
+
 namespace LAMMPS_NS {
 
 class Dump : protected Pointers {
@@ -26,6 +30,7 @@ class Dump : protected Pointers {
   char *style;               // style of Dump
   char *filename;            // user-specified file
   int igroup,groupbit;       // group that Dump is performed on
+  int itimer;                // index of per-dump timer in Timer
 
   int first_flag;            // 0 if no initial dump, 1 if yes initial dump
   int clearstep;             // 1 if dump invokes computes, 0 if not
@@ -50,6 +55,11 @@ class Dump : protected Pointers {
   void modify_params(int, char **);
   virtual bigint memory_usage();
 
+  void async_flush();        // wait until I/O thread has written snapshot
+#if defined(LAMMPS_ASYNC_DUMP)
+  void async_loop();         // main loop of I/O thread
+#endif
+
  protected:
   int me,nprocs;             // proc info
 
@@ -66,10 +76,18 @@ class Dump : protected Pointers {
 
   int header_flag;           // 0 = item, 2 = xyz
   int flush_flag;            // 0 if no flush, 1 if flush every dump
+  int index_flag;            // 1 if frame index file is written, 0 if not
   int sort_flag;             // 1 if sorted output
   int append_flag;           // 1 if open file in append mode, 0 if not
   int buffer_allow;          // 1 if style allows for buffer_flag, 0 if not
   int buffer_flag;           // 1 if buffer output as one big string, 0 if not
+  int async_allow;           // 1 if style allows for async_flag, 0 if not
+  int async_flag;            // 1 if I/O thread writes snapshots, 0 if not
+
+  enum{FASTINT,FASTFLOAT};   // kinds of fast text conversion
+  int fastflag;              // 1 if lines are converted by fast routines
+  int fasttrail;             // 1 if a space follows last value of a line
+  int *fastcol;              // FASTINT or FASTFLOAT for each column
   int padflag;               // timestep padding in filename
   int pbcflag;               // 1 if remap dumped atoms via PBC, 0 if not
   int singlefile_opened;     // 1 = one big file, already opened, else 0
@@ -89,6 +107,7 @@ class Dump : protected Pointers {
   char **format_column_user;
 
   FILE *fp;                  // file to write dump to
+  FILE *fpindex;             // file to write frame index to
   int size_one;              // # of quantities for one atom
   int nme;                   // # of atoms in this dump from me
   int nsme;                  // # of chars in string output from me
@@ -123,6 +142,25 @@ class Dump : protected Pointers {
 
   class Irregular *irregular;
 
+  // snapshot staged for I/O thread, only used by filewriter procs
+  // stage holds copies of the chunks received from procs in my cluster
+
+  int async_active;          // 1 if I/O thread has been created
+  int nstage;                // # of chunks in stage
+  bigint maxstage;           // size of stage in bytes
+  int maxchunk;              // size of stagecount, stagebytes
+  char *stage;
+  int *stagecount;           // lines or chars in each chunk
+  bigint *stagebytes;        // bytes in each chunk
+
+#if defined(LAMMPS_ASYNC_DUMP)
+  int async_pending;         // 1 if I/O thread has a snapshot to write
+  int async_quit;            // 1 if I/O thread should exit
+  pthread_t iothread;
+  pthread_mutex_t async_mutex;
+  pthread_cond_t async_cond;
+#endif
+
   virtual void init_style() = 0;
   virtual void openfile();
   virtual int modify_param(int, char **) {return 0;}
@@ -131,7 +169,14 @@ class Dump : protected Pointers {
   virtual void pack(tagint *) = 0;
   virtual int convert_string(int, double *) {return 0;}
   virtual void write_data(int, double *) = 0;
+  virtual bigint file_offset();
+  void write_index(bigint);
   void pbc_allocate();
+  int convert_fast(int, double *);
+  void write_lines_fast(int, double *);
+  void stage_chunk(int, bigint, void *);
+  void write_stage();
+  void async_start();
     
   void sort();
   static int idcompare(const void *, const void *);
@@ -167,11 +212,27 @@ E: Too many atoms to dump sort
 
 Cannot sort when running with more than 2^31 atoms.
 
+E: Dump_modify async yes not allowed for this style
+
+This dump style does not support writing snapshots with a
+background I/O thread.
+
+E: Dump_modify async yes requires LAMMPS be built with -DLAMMPS_ASYNC_DUMP
+
+The background I/O thread uses pthreads, which must be enabled when
+LAMMPS is compiled.
+
 E: Too much per-proc info for dump
 
 Number of local atoms times number of columns must fit in a 32-bit
 integer for dump.
 
+E: Too much staged info for dump
+
+The snapshot a filewriter proc stages for its I/O thread must fit in
+a 32-bit integer number of bytes.  Use more filewriter procs via the
+dump_modify nfile or fileper keywords.
+
 E: Too much buffered per-proc info for dump
 
 The size of the buffered string must fit in a 32-bit integer for a
@@ -35,6 +35,7 @@ DumpAtom::DumpAtom(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, arg)
   image_flag = 0;
   buffer_allow = 1;
   buffer_flag = 1;
+  async_allow = 1;
   format_default = NULL;
 }
 
@@ -64,6 +65,18 @@ void DumpAtom::init_style()
     strcat(format,"\n");
   }
 
+  // use fast text conversion with default format
+
+  memory->destroy(fastcol);
+  fastflag = 0;
+  if (!format_line_user) {
+    memory->create(fastcol,size_one,"dump:fastcol");
+    for (int i = 0; i < size_one; i++) fastcol[i] = FASTINT;
+    fastcol[2] = fastcol[3] = fastcol[4] = FASTFLOAT;
+    fastflag = 1;
+    fasttrail = 0;
+  }
+
   // setup boundary string
 
   domain->boundary_string(boundstr);
@@ -155,6 +168,7 @@ void DumpAtom::pack(tagint *ids)
 
 int DumpAtom::convert_string(int n, double *mybuf)
 {
+  if (fastflag) return convert_fast(n,mybuf);
   return (this->*convert_choice)(n,mybuf);
 }
 
@@ -478,6 +492,11 @@ void DumpAtom::write_string(int n, double *mybuf)
 
 void DumpAtom::write_lines_image(int n, double *mybuf)
 {
+  if (fastflag) {
+    write_lines_fast(n,mybuf);
+    return;
+  }
+
   int m = 0;
   for (int i = 0; i < n; i++) {
     fprintf(fp,format,
@@ -492,6 +511,11 @@ void DumpAtom::write_lines_image(int n, double *mybuf)
 
 void DumpAtom::write_lines_noimage(int n, double *mybuf)
 {
+  if (fastflag) {
+    write_lines_fast(n,mybuf);
+    return;
+  }
+
   int m = 0;
   for (int i = 0; i < n; i++) {
     fprintf(fp,format,
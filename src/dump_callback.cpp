@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <string.h>
+#include "dump_callback.h"
+#include "atom.h"
+#include "domain.h"
+#include "update.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+DumpCallback::DumpCallback(LAMMPS *lmp, int narg, char **arg) :
+  DumpCustom(lmp, narg, arg)
+{
+  if (strcmp(filename,"NULL") != 0)
+    error->all(FLERR,"Dump callback file name must be NULL");
+
+  // no file is written, so no buffering of strings or I/O thread
+
+  buffer_allow = buffer_flag = 0;
+  async_allow = 0;
+
+  callback = NULL;
+  ptr_caller = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpCallback::init_style()
+{
+  if (callback == NULL) error->all(FLERR,"Dump callback function not set");
+  DumpCustom::init_style();
+}
+
+/* ----------------------------------------------------------------------
+   pack selected atoms into buf and pass it to callback on every proc
+   no gather to a file writer, each proc's buf is passed in place,
+     with one row of size_one values per atom in order of dump columns
+   buf is owned by dump and only valid for duration of callback
+------------------------------------------------------------------------- */
+
+void DumpCallback::write()
+{
+  imageint *imagehold;
+  double **xhold,**vhold;
+
+  // nme = # of atoms this proc passes to callback
+
+  nme = count();
+
+  if (nme > maxbuf) {
+    if ((bigint) nme * size_one > MAXSMALLINT)
+      error->one(FLERR,"Too much per-proc info for dump");
+    maxbuf = nme;
+    memory->destroy(buf);
+    memory->create(buf,maxbuf*size_one,"dump:buf");
+  }
+
+  // ntotal is needed by sort() to check if it can reorder
+
+  if (sort_flag) {
+    bigint bnme = nme;
+    MPI_Allreduce(&bnme,&ntotal,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  }
+
+  if (sort_flag && sortcol == 0 && nme > maxids) {
+    maxids = nme;
+    memory->destroy(ids);
+    memory->create(ids,maxids,"dump:ids");
+  }
+
+  // apply PBC on copy of x,v,image if requested
+
+  if (pbcflag) {
+    int nlocal = atom->nlocal;
+    if (nlocal > maxpbc) pbc_allocate();
+    if (nlocal) {
+      memcpy(&xpbc[0][0],&atom->x[0][0],3*nlocal*sizeof(double));
+      memcpy(&vpbc[0][0],&atom->v[0][0],3*nlocal*sizeof(double));
+      memcpy(imagepbc,atom->image,nlocal*sizeof(imageint));
+    }
+    xhold = atom->x;
+    vhold = atom->v;
+    imagehold = atom->image;
+    atom->x = xpbc;
+    atom->v = vpbc;
+    atom->image = imagepbc;
+    domain->pbc();
+  }
+
+  // pack my data into buf, sort across procs if requested
+
+  if (sort_flag && sortcol == 0) pack(ids);
+  else pack(NULL);
+  if (sort_flag) sort();
+
+  if (pbcflag) {
+    atom->x = xhold;
+    atom->v = vhold;
+    atom->image = imagehold;
+  }
+
+  callback(ptr_caller,update->ntimestep,nme,size_one,buf);
+}
+
+/* ----------------------------------------------------------------------
+   set function invoked on every proc when dump is written
+   caller_ptr is passed back to it as first argument
+------------------------------------------------------------------------- */
+
+void DumpCallback::set_callback(FnPtr caller_callback, void *caller_ptr)
+{
+  callback = caller_callback;
+  ptr_caller = caller_ptr;
+}
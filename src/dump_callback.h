@@ -0,0 +1,72 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(callback,DumpCallback)
+
+#else
+
+#ifndef LMP_DUMP_CALLBACK_H
+#define LMP_DUMP_CALLBACK_H
+
+#include "dump_custom.h"
+
+namespace LAMMPS_NS {
+
+class DumpCallback : public DumpCustom {
+ public:
+  DumpCallback(class LAMMPS *, int, char **);
+  virtual ~DumpCallback() {}
+  virtual void write();
+
+  typedef void (*FnPtr)(void *, bigint, int, int, double *);
+  void set_callback(FnPtr, void *);
+
+ protected:
+  FnPtr callback;
+  void *ptr_caller;
+
+  virtual void init_style();
+  virtual void openfile() {}
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Dump callback file name must be NULL
+
+Dump callback does not write a file, so the file name argument of
+the dump command must be specified as NULL.
+
+E: Dump callback function not set
+
+The callback function must be set via the library interface or by
+the calling program before a run or minimization is performed.
+
+E: Too much per-proc info for dump
+
+Number of local atoms times number of columns must fit in a 32-bit
+integer for dump.
+
+*/
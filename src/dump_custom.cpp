@@ -87,6 +87,7 @@ DumpCustom::DumpCustom(LAMMPS *lmp, int narg, char **arg) :
 
   buffer_allow = 1;
   buffer_flag = 1;
+  async_allow = 1;
   iregion = -1;
   idregion = NULL;
 
@@ -300,6 +301,21 @@ void DumpCustom::init_style()
     vformat[i] = strcat(vformat[i]," ");
   }
 
+  // use fast text conversion if every column has its default format
+
+  memory->destroy(fastcol);
+  memory->create(fastcol,size_one,"dump:fastcol");
+  fastflag = 1;
+  fasttrail = 1;
+  for (int i = 0; i < size_one; i++) {
+    if ((vtype[i] == INT && strcmp(vformat[i],"%d ") == 0) ||
+        (vtype[i] == BIGINT && strcmp(vformat[i],BIGINT_FORMAT " ") == 0))
+      fastcol[i] = FASTINT;
+    else if (vtype[i] == DOUBLE && strcmp(vformat[i],"%g ") == 0)
+      fastcol[i] = FASTFLOAT;
+    else fastflag = 0;
+  }
+
   // setup boundary string
 
   domain->boundary_string(boundstr);
@@ -483,7 +499,7 @@ int DumpCustom::count()
     } else {
       for (i = 0; i < ncompute; i++) {
         if (!(compute[i]->invoked_flag & INVOKED_PERATOM)) {
-          compute[i]->compute_peratom();
+          compute[i]->invoke_peratom();
           compute[i]->invoked_flag |= INVOKED_PERATOM;
         }
       }
@@ -1071,6 +1087,8 @@ void DumpCustom::pack(tagint *ids)
 
 int DumpCustom::convert_string(int n, double *mybuf)
 {
+  if (fastflag) return convert_fast(n,mybuf);
+
   int i,j;
 
   int offset = 0;
@@ -1127,6 +1145,11 @@ void DumpCustom::write_string(int n, double *mybuf)
 
 void DumpCustom::write_lines(int n, double *mybuf)
 {
+  if (fastflag) {
+    write_lines_fast(n,mybuf);
+    return;
+  }
+
   int i,j;
 
   int m = 0;
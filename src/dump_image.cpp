@@ -57,6 +57,7 @@ DumpImage::DumpImage(LAMMPS *lmp, int narg, char **arg) :
   chooseghost(NULL), bufcopy(NULL)
 {
   if (binary || multiproc) error->all(FLERR,"Invalid dump image filename");
+  async_allow = 0;
 
   // force binary flag on to avoid corrupted output on Windows
 
@@ -66,6 +66,7 @@ DumpLocal::DumpLocal(LAMMPS *lmp, int narg, char **arg) :
 
   buffer_allow = 1;
   buffer_flag = 1;
+  async_allow = 1;
 
   // computes & fixes which the dump accesses
 
@@ -292,7 +293,7 @@ int DumpLocal::count()
     } else {
       for (i = 0; i < ncompute; i++) {
         if (!(compute[i]->invoked_flag & INVOKED_LOCAL)) {
-          compute[i]->compute_local();
+          compute[i]->invoke_local();
           compute[i]->invoked_flag |= INVOKED_LOCAL;
         }
       }
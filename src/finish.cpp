@@ -49,6 +49,9 @@ using namespace LAMMPS_NS;
 static void mpi_timings(const char *label, Timer *t, enum Timer::ttype tt,
                         MPI_Comm world, const int nprocs, const int nthreads,
                         const int me, double time_loop, FILE *scr, FILE *log);
+static void detail_timings(Timer *t, MPI_Comm world, const int nprocs,
+                           const int me, double time_loop,
+                           FILE *scr, FILE *log);
 
 #ifdef LMP_USER_OMP
 static void omp_times(FixOMP *fix, const char *label, enum Timer::ttype which,
@@ -523,6 +526,11 @@ void Finish::end(int flag)
     }
   }
 
+  // per-object breakdown with detail timer style
+
+  if (timeflag && timer->has_detail())
+    detail_timings(timer,world,nprocs,me,time_loop,screen,logfile);
+
 #ifdef LMP_USER_OMP
   const char thr_hdr_fmt[] =
     "\nThread timing breakdown (MPI rank %d):\nTotal threaded time %.4g / %.1f%%\n";
@@ -934,6 +942,57 @@ void mpi_timings(const char *label, Timer *t, enum Timer::ttype tt,
   }
 }
 
+/* ----------------------------------------------------------------------
+   min/avg/max across procs of each per-object timer
+   times are inclusive, e.g. a compute invoked by a fix counts for both
+   objects that were never invoked during the run are skipped
+------------------------------------------------------------------------- */
+
+void detail_timings(Timer *t, MPI_Comm world, const int nprocs,
+                    const int me, double time_loop, FILE *scr, FILE *log)
+{
+  const char hdr[] = "\nPer-object timing breakdown (inclusive):\n"
+    "Object                   | Style       |  min time  |  avg time  "
+    "|  max time  |%varavg| %total\n"
+    "-----------------------------------------------------------------"
+    "--------------------------------\n";
+  const char fmt[] =
+    "%-25s| %-12s|%- 12.5g|%- 12.5g|%- 12.5g|%6.1f |%6.2f\n";
+
+  if (me == 0) {
+    if (scr) fputs(hdr,scr);
+    if (log) fputs(hdr,log);
+  }
+
+  double time,tmp,time_min,time_max,time_sq;
+  const int n = t->get_ndetail();
+
+  for (int i = 0; i < n; i++) {
+    time = t->get_detail_wall(i);
+    MPI_Allreduce(&time,&time_max,1,MPI_DOUBLE,MPI_MAX,world);
+    if (time_max == 0.0) continue;
+    MPI_Allreduce(&time,&time_min,1,MPI_DOUBLE,MPI_MIN,world);
+    time_sq = time*time;
+    MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+    time = tmp/nprocs;
+    MPI_Allreduce(&time_sq,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+    time_sq = tmp/nprocs;
+
+    if ((time > 0.001) && ((time_sq/time - time) > 1.0e-10))
+      time_sq = sqrt(time_sq/time - time)*100.0;
+    else
+      time_sq = 0.0;
+
+    if (me == 0) {
+      tmp = time/time_loop*100.0;
+      if (scr) fprintf(scr,fmt,t->get_detail_name(i),t->get_detail_style(i),
+                       time_min,time,time_max,time_sq,tmp);
+      if (log) fprintf(log,fmt,t->get_detail_name(i),t->get_detail_style(i),
+                       time_min,time,time_max,time_sq,tmp);
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 #ifdef LMP_USER_OMP
@@ -57,6 +57,7 @@ Fix::Fix(LAMMPS *lmp, int narg, char **arg) :
   style = new char[n];
   strcpy(style,arg[2]);
 
+  itimer = -1;
   restart_global = restart_peratom = restart_file = 0;
   force_reneighbor = 0;
   box_change_size = box_change_shape = box_change_domain = 0;
@@ -24,6 +24,7 @@ class Fix : protected Pointers {
 
   char *id,*style;
   int igroup,groupbit;
+  int itimer;                    // index of per-fix timer in Timer
 
   int restart_global;            // 1 if Fix saves global state, 0 if not
   int restart_peratom;           // 1 if Fix saves peratom state, 0 if not
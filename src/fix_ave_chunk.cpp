@@ -694,7 +694,7 @@ void FixAveChunk::end_of_step()
     } else if (which[m] == TEMPERATURE) {
 
       if (biasflag) {
-        if (tbias->invoked_scalar != ntimestep) tbias->compute_scalar();
+        if (tbias->invoked_scalar != ntimestep) tbias->invoke_scalar();
         tbias->remove_bias_all();
       }
 
@@ -728,7 +728,7 @@ void FixAveChunk::end_of_step()
     } else if (which[m] == COMPUTE) {
       Compute *compute = modify->compute[n];
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-        compute->compute_peratom();
+        compute->invoke_peratom();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
       double *vector = compute->vector_atom;
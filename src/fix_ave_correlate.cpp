@@ -445,13 +445,13 @@ void FixAveCorrelate::end_of_step()
 
       if (argindex[i] == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-          compute->compute_scalar();
+          compute->invoke_scalar();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         scalar = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         scalar = compute->vector[argindex[i]-1];
@@ -609,13 +609,13 @@ void FixAveHisto::end_of_step()
       if (kind == GLOBAL && mode == SCALAR) {
         if (j == 0) {
           if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-            compute->compute_scalar();
+            compute->invoke_scalar();
             compute->invoked_flag |= INVOKED_SCALAR;
           }
           bin_one(compute->scalar);
         } else {
           if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
+            compute->invoke_vector();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
           bin_one(compute->vector[j-1]);
@@ -623,13 +623,13 @@ void FixAveHisto::end_of_step()
       } else if (kind == GLOBAL && mode == VECTOR) {
         if (j == 0) {
           if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
+            compute->invoke_vector();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
           bin_vector(compute->size_vector,compute->vector,1);
         } else {
           if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-            compute->compute_array();
+            compute->invoke_array();
             compute->invoked_flag |= INVOKED_ARRAY;
           }
           if (compute->array)
@@ -639,7 +639,7 @@ void FixAveHisto::end_of_step()
 
       } else if (kind == PERATOM) {
         if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-          compute->compute_peratom();
+          compute->invoke_peratom();
           compute->invoked_flag |= INVOKED_PERATOM;
         }
         if (j == 0)
@@ -649,7 +649,7 @@ void FixAveHisto::end_of_step()
 
       } else if (kind == LOCAL) {
         if (!(compute->invoked_flag & INVOKED_LOCAL)) {
-          compute->compute_local();
+          compute->invoke_local();
           compute->invoked_flag |= INVOKED_LOCAL;
         }
         if (j == 0)
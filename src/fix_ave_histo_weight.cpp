@@ -159,13 +159,13 @@ void FixAveHistoWeight::end_of_step()
     if (kind == GLOBAL && mode == SCALAR) {
       if (j == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-          compute->compute_scalar();
+          compute->invoke_scalar();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         weight = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         weight = compute->vector[j-1];
@@ -173,14 +173,14 @@ void FixAveHistoWeight::end_of_step()
     } else if (kind == GLOBAL && mode == VECTOR) {
       if (j == 0) {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         weights = compute->vector;
         stride = 1;
       } else {
         if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-          compute->compute_array();
+          compute->invoke_array();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         if (compute->array) weights = &compute->array[0][j-1];
@@ -188,7 +188,7 @@ void FixAveHistoWeight::end_of_step()
       }
     } else if (kind == PERATOM) {
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-        compute->compute_peratom();
+        compute->invoke_peratom();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
       if (j == 0) {
@@ -200,7 +200,7 @@ void FixAveHistoWeight::end_of_step()
       }
     } else if (kind == LOCAL) {
       if (!(compute->invoked_flag & INVOKED_LOCAL)) {
-        compute->compute_local();
+        compute->invoke_local();
         compute->invoked_flag |= INVOKED_LOCAL;
       }
       if (j == 0) {
@@ -287,13 +287,13 @@ void FixAveHistoWeight::end_of_step()
     if (kind == GLOBAL && mode == SCALAR) {
       if (j == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-          compute->compute_scalar();
+          compute->invoke_scalar();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         bin_one_weights(compute->scalar,weight);
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         bin_one_weights(compute->vector[j-1],weight);
@@ -301,14 +301,14 @@ void FixAveHistoWeight::end_of_step()
     } else if (kind == GLOBAL && mode == VECTOR) {
       if (j == 0) {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         bin_vector_weights(compute->size_vector,compute->vector,1,
                            weights,stride);
       } else {
         if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-          compute->compute_array();
+          compute->invoke_array();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         if (compute->array)
@@ -318,7 +318,7 @@ void FixAveHistoWeight::end_of_step()
 
     } else if (kind == PERATOM) {
       if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-        compute->compute_peratom();
+        compute->invoke_peratom();
         compute->invoked_flag |= INVOKED_PERATOM;
       }
       if (j == 0)
@@ -329,7 +329,7 @@ void FixAveHistoWeight::end_of_step()
 
     } else if (kind == LOCAL) {
       if (!(compute->invoked_flag & INVOKED_LOCAL)) {
-        compute->compute_local();
+        compute->invoke_local();
         compute->invoked_flag |= INVOKED_LOCAL;
       }
       if (j == 0)
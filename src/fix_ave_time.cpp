@@ -588,13 +588,13 @@ void FixAveTime::invoke_scalar(bigint ntimestep)
 
       if (argindex[i] == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-          compute->compute_scalar();
+          compute->invoke_scalar();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         scalar = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         if (varlen[i] && compute->size_vector < argindex[i]) scalar = 0.0;
@@ -771,7 +771,7 @@ void FixAveTime::invoke_vector(bigint ntimestep)
 
       if (argindex[j] == 0) {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         double *cvector = compute->vector;
@@ -780,7 +780,7 @@ void FixAveTime::invoke_vector(bigint ntimestep)
 
       } else {
         if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-          compute->compute_array();
+          compute->invoke_array();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         double **carray = compute->array;
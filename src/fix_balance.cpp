@@ -115,6 +115,7 @@ FixBalance::FixBalance(LAMMPS *lmp, int narg, char **arg) :
 
   if (nevery) force_reneighbor = 1;
   lastbalance = -1;
+  lastcost = 0.0;
   
   // compute initial outputs
 
@@ -214,6 +215,7 @@ void FixBalance::pre_exchange()
   // even if wanted to, can mess up elapsed time in ImbalanceTime
 
   if (update->ntimestep == lastbalance) return;
+  bigint nsteps = update->ntimestep - lastbalance;
   lastbalance = update->ntimestep;
 
   // insure atoms are in current box & update box via shrink-wrap
@@ -232,7 +234,16 @@ void FixBalance::pre_exchange()
   if (balance->varflag) modify->addstep_compute(update->ntimestep + nevery);
 
   imbnow = balance->imbalance_factor(maxloadperproc);
-  if (imbnow > thresh) rebalance();
+
+  // if a weight method can estimate time recovered by rebalancing,
+  //   skip rebalance if recovered time until next attempt is less
+  //   than time the last rebalance took
+
+  if (imbnow > thresh) {
+    double gain = balance->gain();
+    if (nevery) nsteps = nevery;
+    if (gain < 0.0 || lastcost == 0.0 || gain*nsteps > lastcost) rebalance();
+  }
 
   // next timestep to rebalance
 
@@ -258,6 +269,7 @@ void FixBalance::pre_neighbor()
 void FixBalance::rebalance()
 {
   imbprev = imbnow;
+  double time = MPI_Wtime();
 
   // invoke balancer and reset comm->uniform flag
 
@@ -297,6 +309,11 @@ void FixBalance::rebalance()
 
   if (kspace_flag) force->kspace->setup_grid();
 
+  // wall time of this rebalance, same on all procs
+
+  time = MPI_Wtime() - time;
+  MPI_Allreduce(&time,&lastcost,1,MPI_DOUBLE,MPI_MAX,world);
+
   // pending triggers pre_neighbor() to compute final imbalance factor
   // can only be done after atoms migrate in comm->exchange()
 
@@ -54,6 +54,7 @@ class FixBalance : public Fix {
   int kspace_flag;              // 1 if KSpace solver defined
   int pending;
   bigint lastbalance;           // last timestep balancing was attempted
+  double lastcost;              // wall time of last rebalance, 0.0 if none
 
   class Balance *balance;
   class Irregular *irregular;
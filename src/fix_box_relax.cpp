@@ -440,11 +440,11 @@ double FixBoxRelax::min_energy(double *fextra)
 {
   double eng,scale,scalex,scaley,scalez,scalevol;
 
-  temperature->compute_scalar();
-  if (pstyle == ISO) pressure->compute_scalar();
+  temperature->invoke_scalar();
+  if (pstyle == ISO) pressure->invoke_scalar();
   else {
-    temperature->compute_vector();
-    pressure->compute_vector();
+    temperature->invoke_vector();
+    pressure->invoke_vector();
   }
   couple();
 
@@ -201,13 +201,13 @@ void FixController::end_of_step()
   if (pvwhich == COMPUTE) {
     if (pvindex == 0) {
       if (!(pcompute->invoked_flag & INVOKED_SCALAR)) {
-        pcompute->compute_scalar();
+        pcompute->invoke_scalar();
         pcompute->invoked_flag |= INVOKED_SCALAR;
       }
       current = pcompute->scalar;
     } else {
       if (!(pcompute->invoked_flag & INVOKED_VECTOR)) {
-        pcompute->compute_vector();
+        pcompute->invoke_vector();
         pcompute->invoked_flag |= INVOKED_VECTOR;
       }
       current = pcompute->vector[pvindex-1];
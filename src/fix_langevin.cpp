@@ -519,7 +519,7 @@ void FixLangevin::post_force_untemplated
     flangevin_allocated = 1;
   }
 
-  if (Tp_BIAS) temperature->compute_scalar();
+  if (Tp_BIAS) temperature->invoke_scalar();
 
   for (int i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
@@ -730,7 +730,7 @@ void FixNH::setup(int vflag)
 {
   // tdof needed by compute_temp_target()
 
-  t_current = temperature->compute_scalar();
+  t_current = temperature->invoke_scalar();
   tdof = temperature->dof;
 
   // t_target is needed by NVT and NPT in compute_scalar()
@@ -748,7 +748,7 @@ void FixNH::setup(int vflag)
     // if it was read in from a restart file, leave it be
 
     if (t0 == 0.0) {
-      t0 = temperature->compute_scalar();
+      t0 = temperature->invoke_scalar();
       if (t0 == 0.0) {
         if (strcmp(update->unit_style,"lj") == 0) t0 = 1.0;
         else t0 = 300.0;
@@ -760,8 +760,8 @@ void FixNH::setup(int vflag)
   if (pstat_flag) compute_press_target();
 
   if (pstat_flag) {
-    if (pstyle == ISO) pressure->compute_scalar();
-    else pressure->compute_vector();
+    if (pstyle == ISO) pressure->invoke_scalar();
+    else pressure->invoke_vector();
     couple();
     pressure->addstep(update->ntimestep+1);
   }
@@ -831,11 +831,11 @@ void FixNH::initial_integrate(int vflag)
 
   if (pstat_flag) {
     if (pstyle == ISO) {
-      temperature->compute_scalar();
-      pressure->compute_scalar();
+      temperature->invoke_scalar();
+      pressure->invoke_scalar();
     } else {
-      temperature->compute_vector();
-      pressure->compute_vector();
+      temperature->invoke_vector();
+      pressure->invoke_vector();
     }
     couple();
     pressure->addstep(update->ntimestep+1);
@@ -879,19 +879,19 @@ void FixNH::final_integrate()
   //     since temp->compute() in initial_integrate()
 
   if (which == BIAS && neighbor->ago == 0)
-    t_current = temperature->compute_scalar();
+    t_current = temperature->invoke_scalar();
 
   if (pstat_flag) nh_v_press();
 
   // compute new T,P after velocities rescaled by nh_v_press()
   // compute appropriately coupled elements of mvv_current
 
-  t_current = temperature->compute_scalar();
+  t_current = temperature->invoke_scalar();
   tdof = temperature->dof;
 
   if (pstat_flag) {
-    if (pstyle == ISO) pressure->compute_scalar();
-    else pressure->compute_vector();
+    if (pstyle == ISO) pressure->invoke_scalar();
+    else pressure->invoke_vector();
     couple();
     pressure->addstep(update->ntimestep+1);
   }
@@ -938,11 +938,11 @@ void FixNH::initial_integrate_respa(int vflag, int ilevel, int iloop)
 
     if (pstat_flag) {
       if (pstyle == ISO) {
-        temperature->compute_scalar();
-        pressure->compute_scalar();
+        temperature->invoke_scalar();
+        pressure->invoke_scalar();
       } else {
-        temperature->compute_vector();
-        pressure->compute_vector();
+        temperature->invoke_vector();
+        pressure->invoke_vector();
       }
       couple();
       pressure->addstep(update->ntimestep+1);
@@ -348,11 +348,11 @@ void FixPressBerendsen::end_of_step()
   // compute new T,P
 
   if (pstyle == ISO) {
-    temperature->compute_scalar();
-    pressure->compute_scalar();
+    temperature->invoke_scalar();
+    pressure->invoke_scalar();
   } else {
-    temperature->compute_vector();
-    pressure->compute_vector();
+    temperature->invoke_vector();
+    pressure->invoke_vector();
   }
   couple();
 
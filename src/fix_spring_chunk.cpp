@@ -159,7 +159,7 @@ void FixSpringChunk::post_force(int vflag)
   // calculate current centers of mass for each chunk
   // extract pointers from idchunk and idcom
 
-  ccom->compute_array();
+  ccom->invoke_array();
 
   nchunk = cchunk->nchunk;
   int *ichunk = cchunk->ichunk;
@@ -495,7 +495,7 @@ void FixStoreState::end_of_step()
       if (which[m] == COMPUTE) {
         Compute *compute = modify->compute[n];
         if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-          compute->compute_peratom();
+          compute->invoke_peratom();
           compute->invoked_flag |= INVOKED_PERATOM;
         }
 
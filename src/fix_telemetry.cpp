@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <string.h>
+#include "fix_telemetry.h"
+#include "atom.h"
+#include "update.h"
+#include "comm.h"
+#include "neighbor.h"
+#include "timer.h"
+#include "force.h"
+#include "error.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+// Timer sections reported in each record, in order of lasttimer
+
+static const int NSECTION = FixTelemetry::NSECTION;
+static const Timer::ttype section[NSECTION] =
+  {Timer::PAIR,Timer::BOND,Timer::KSPACE,Timer::NEIGH,Timer::COMM,
+   Timer::MODIFY,Timer::OUTPUT,Timer::SYNC};
+static const char *section_name[NSECTION] =
+  {"pair","bond","kspace","neigh","comm","modify","output","sync"};
+
+// per-proc values reduced across procs for each record
+
+enum{WALL=NSECTION,MSG,BYTES,NLOCAL,NEGNLOCAL,RSS,NVALUE};
+
+/* ---------------------------------------------------------------------- */
+
+FixTelemetry::FixTelemetry(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg),
+  fp(NULL)
+{
+  if (narg < 5) error->all(FLERR,"Illegal fix telemetry command");
+  nevery = force->inumeric(FLERR,arg[3]);
+  if (nevery <= 0) error->all(FLERR,"Illegal fix telemetry command");
+
+  MPI_Comm_rank(world,&me);
+  MPI_Comm_size(world,&nprocs);
+
+  int appendflag = 0;
+
+  int iarg = 5;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"append") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal fix telemetry command");
+      if (strcmp(arg[iarg+1],"yes") == 0) appendflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) appendflag = 0;
+      else error->all(FLERR,"Illegal fix telemetry command");
+      iarg += 2;
+    } else error->all(FLERR,"Illegal fix telemetry command");
+  }
+
+  if (me == 0) {
+    if (appendflag) fp = fopen(arg[4],"a");
+    else fp = fopen(arg[4],"w");
+    if (fp == NULL) {
+      char str[128];
+      sprintf(str,"Cannot open fix telemetry file %s",arg[4]);
+      error->one(FLERR,str);
+    }
+  }
+
+  laststep = update->ntimestep;
+  lastwall = MPI_Wtime();
+  for (int i = 0; i < NSECTION; i++) lasttimer[i] = 0.0;
+  lastmsg = lastbytes = 0;
+  lastbuild = lastdanger = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixTelemetry::~FixTelemetry()
+{
+  if (fp && me == 0) fclose(fp);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixTelemetry::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ----------------------------------------------------------------------
+   reset reference values at start of each run
+   Timer is zeroed after setup, so previous section times are 0.0
+   Comm and Neighbor counters persist across runs
+------------------------------------------------------------------------- */
+
+void FixTelemetry::setup(int vflag)
+{
+  laststep = update->ntimestep;
+  lastwall = MPI_Wtime();
+  for (int i = 0; i < NSECTION; i++) lasttimer[i] = 0.0;
+  lastmsg = comm->msgcount;
+  lastbytes = comm->msgbytes;
+  lastbuild = neighbor->ncalls;
+  lastdanger = neighbor->ndanger;
+}
+
+/* ----------------------------------------------------------------------
+   write one JSON record with changes since previous record
+   per-proc quantities are reduced to avg and max (or min/max/total)
+   a single pair of Allreduce() calls, so cheap enough for production
+------------------------------------------------------------------------- */
+
+void FixTelemetry::end_of_step()
+{
+  double one[NVALUE],sum[NVALUE],max[NVALUE];
+
+  double now = MPI_Wtime();
+  for (int i = 0; i < NSECTION; i++) {
+    double t = timer->get_wall(section[i]);
+    one[i] = t - lasttimer[i];
+    lasttimer[i] = t;
+  }
+  one[WALL] = now - lastwall;
+
+  // comm may have been re-created by comm_style, restarting its counters
+
+  if (comm->msgcount < lastmsg) lastmsg = lastbytes = 0;
+  one[MSG] = comm->msgcount - lastmsg;
+  one[BYTES] = comm->msgbytes - lastbytes;
+  one[NLOCAL] = atom->nlocal;
+  one[NEGNLOCAL] = -atom->nlocal;
+  one[RSS] = rss();
+
+  MPI_Allreduce(one,sum,NVALUE,MPI_DOUBLE,MPI_SUM,world);
+  MPI_Allreduce(one,max,NVALUE,MPI_DOUBLE,MPI_MAX,world);
+
+  bigint nstep = update->ntimestep - laststep;
+  bigint nbuild = neighbor->ncalls - lastbuild;
+  bigint ndanger = neighbor->ndanger - lastdanger;
+
+  if (me == 0) {
+    fprintf(fp,"{\"step\": " BIGINT_FORMAT ", \"nsteps\": " BIGINT_FORMAT
+            ", \"wall\": %g, \"tps\": %g, \"timer\": {",
+            update->ntimestep,nstep,max[WALL],
+            max[WALL] > 0.0 ? nstep/max[WALL] : 0.0);
+    for (int i = 0; i < NSECTION; i++)
+      fprintf(fp,"%s\"%s\": [%g, %g]",i ? ", " : "",section_name[i],
+              sum[i]/nprocs,max[i]);
+    fprintf(fp,"}, \"comm\": {\"msgs\": %.0f, \"bytes\": %.0f, "
+            "\"msgs_max\": %.0f, \"bytes_max\": %.0f}",
+            sum[MSG],sum[BYTES],max[MSG],max[BYTES]);
+    fprintf(fp,", \"neigh\": {\"builds\": " BIGINT_FORMAT
+            ", \"dangerous\": " BIGINT_FORMAT "}",nbuild,ndanger);
+    fprintf(fp,", \"atoms\": {\"min\": %.0f, \"max\": %.0f, \"total\": %.0f}",
+            -max[NEGNLOCAL],max[NLOCAL],sum[NLOCAL]);
+    fprintf(fp,", \"memory\": {\"rss_max\": %g, \"rss_total\": %g}}\n",
+            max[RSS],sum[RSS]);
+    fflush(fp);
+  }
+
+  laststep = update->ntimestep;
+  lastwall = now;
+  lastmsg = comm->msgcount;
+  lastbytes = comm->msgbytes;
+  lastbuild = neighbor->ncalls;
+  lastdanger = neighbor->ndanger;
+}
+
+/* ----------------------------------------------------------------------
+   high-water mark of resident memory of this proc in Mbytes
+------------------------------------------------------------------------- */
+
+double FixTelemetry::rss()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (GetProcessMemoryInfo(GetCurrentProcess(),&pmc,sizeof(pmc)))
+    return (double) pmc.PeakWorkingSetSize/1048576.0;
+#else
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF,&ru) == 0) {
+#if defined(__APPLE__)
+    return (double) ru.ru_maxrss/1048576.0;
+#else
+    return (double) ru.ru_maxrss/1024.0;
+#endif
+  }
+#endif
+  return 0.0;
+}
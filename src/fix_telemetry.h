@@ -0,0 +1,69 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(telemetry,FixTelemetry)
+
+#else
+
+#ifndef LMP_FIX_TELEMETRY_H
+#define LMP_FIX_TELEMETRY_H
+
+#include <stdio.h>
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixTelemetry : public Fix {
+ public:
+  static const int NSECTION = 8;    // # of Timer sections in each record
+
+  FixTelemetry(class LAMMPS *, int, char **);
+  ~FixTelemetry();
+  int setmask();
+  void setup(int);
+  void end_of_step();
+
+ private:
+  int me,nprocs;
+  FILE *fp;
+
+  bigint laststep;                  // timestep of previous record
+  double lastwall;                  // wall time of previous record
+  double lasttimer[NSECTION];       // Timer values at previous record
+  bigint lastmsg,lastbytes;         // Comm counters at previous record
+  bigint lastbuild,lastdanger;      // Neighbor counters at previous record
+
+  double rss();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Cannot open fix telemetry file %s
+
+The output file generated by the fix telemetry command cannot be
+opened.
+
+*/
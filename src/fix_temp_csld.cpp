@@ -181,7 +181,7 @@ void FixTempCSLD::end_of_step()
     modify->addstep_compute(update->ntimestep + nevery);
   }
 
-  double t_current = temperature->compute_scalar();
+  double t_current = temperature->invoke_scalar();
   double ekin_old = t_current * 0.5 * temperature->dof * force->boltz;
 
   // there is nothing to do, if there are no degrees of freedom
@@ -226,7 +226,7 @@ void FixTempCSLD::end_of_step()
 
   // mixing factors
   const double c1 = exp(-update->dt/t_period);
-  const double c2 = sqrt((1.0-c1*c1)*t_target/temperature->compute_scalar());
+  const double c2 = sqrt((1.0-c1*c1)*t_target/temperature->invoke_scalar());
 
   if (which == NOBIAS) {
     for (int i = 0; i < nlocal; i++) {
@@ -250,7 +250,7 @@ void FixTempCSLD::end_of_step()
 
   // tally the kinetic energy transferred between heat bath and system
 
-  t_current = temperature->compute_scalar();
+  t_current = temperature->invoke_scalar();
   energy +=  ekin_old - t_current * 0.5 * temperature->dof * force->boltz;
 }
 
@@ -245,7 +245,7 @@ void FixTempCSVR::end_of_step()
     modify->addstep_compute(update->ntimestep + nevery);
   }
 
-  const double t_current = temperature->compute_scalar();
+  const double t_current = temperature->invoke_scalar();
   const double efactor = 0.5 * temperature->dof * force->boltz;
   const double ekin_old = t_current * efactor;
   const double ekin_new = t_target * efactor;
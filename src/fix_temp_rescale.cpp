@@ -133,7 +133,7 @@ void FixTempRescale::init()
 
 void FixTempRescale::end_of_step()
 {
-  double t_current = temperature->compute_scalar();
+  double t_current = temperature->invoke_scalar();
 
   // there is nothing to do, if there are no degrees of freedom
 
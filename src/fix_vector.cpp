@@ -273,13 +273,13 @@ void FixVector::end_of_step()
 
       if (argindex[i] == 0) {
         if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-          compute->compute_scalar();
+          compute->invoke_scalar();
           compute->invoked_flag |= INVOKED_SCALAR;
         }
         result[i] = compute->scalar;
       } else {
         if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         result[i] = compute->vector[argindex[i]-1];
@@ -32,6 +32,9 @@ class Imbalance : protected Pointers {
   virtual void compute(double *) = 0;
   // print information about the state of this imbalance compute (required)
   virtual void info(FILE *) = 0;
+  // estimated time per step recovered by rebalancing (optional)
+  // return < 0.0 if the imbalance compute cannot estimate it
+  virtual double gain() { return -1.0; };
 
   // disallow default and copy constructor, assignment operator
   // private:
@@ -0,0 +1,349 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <math.h>
+#include <string.h>
+#include "imbalance_model.h"
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "group.h"
+#include "modify.h"
+#include "fix.h"
+#include "neighbor.h"
+#include "neigh_request.h"
+#include "neigh_list.h"
+#include "update.h"
+#include "timer.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+#define RIDGE 1.0e-3     // relative regularization of normal equations
+#define FLOOR 0.01       // min atom weight as fraction of average weight
+
+/* -------------------------------------------------------------------- */
+
+ImbalanceModel::ImbalanceModel(LAMMPS *lmp) : Imbalance(lmp)
+{
+  ngroup = nfeature = 0;
+  groups = NULL;
+  amat = bvec = coeff = NULL;
+  nsample = 0.0;
+  excess = -1.0;
+  last = 0.0;
+  laststep = 0;
+
+  maxneigh = 0;
+  nneigh = NULL;
+}
+
+/* -------------------------------------------------------------------- */
+
+ImbalanceModel::~ImbalanceModel()
+{
+  delete [] groups;
+  memory->destroy(amat);
+  memory->destroy(bvec);
+  memory->destroy(coeff);
+  memory->destroy(nneigh);
+}
+
+/* -------------------------------------------------------------------- */
+
+int ImbalanceModel::options(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR,"Illegal balance weight command");
+  decay = force->numeric(FLERR,arg[0]);
+  if (decay < 0.0 || decay > 1.0)
+    error->all(FLERR,"Illegal balance weight command");
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   set cost components: one per proc, one per atom type,
+     one per neighbor, one per atom in the group of each fix
+   regression data is kept across runs unless the components change
+------------------------------------------------------------------------- */
+
+void ImbalanceModel::init(int flag)
+{
+  // same logic as ImbalanceTime
+  // flag = 1 if called from FixBalance at start of run, init Timer
+  // flag = 0 if called from Balance, use time and steps from last run
+
+  last = 0.0;
+  if (flag) {
+    timer->init();
+    laststep = update->ntimestep;
+  } else laststep = update->ntimestep - update->nsteps;
+
+  // distinct groups of fixes, except group all
+
+  int *newgroups = new int[modify->nfix];
+  int nnew = 0;
+  for (int i = 0; i < modify->nfix; i++) {
+    int igroup = modify->fix[i]->igroup;
+    if (igroup == 0) continue;
+    int j;
+    for (j = 0; j < nnew; j++)
+      if (newgroups[j] == igroup) break;
+    if (j == nnew) newgroups[nnew++] = igroup;
+  }
+
+  int same = (nnew == ngroup && nfeature == atom->ntypes + 2 + ngroup);
+  for (int j = 0; same && j < nnew; j++)
+    if (newgroups[j] != groups[j]) same = 0;
+
+  if (same) {
+    delete [] newgroups;
+    return;
+  }
+
+  delete [] groups;
+  groups = newgroups;
+  ngroup = nnew;
+  nfeature = atom->ntypes + 2 + ngroup;
+
+  memory->destroy(amat);
+  memory->destroy(bvec);
+  memory->destroy(coeff);
+  memory->create(amat,nfeature*nfeature,"imbalance:amat");
+  memory->create(bvec,nfeature,"imbalance:bvec");
+  memory->create(coeff,nfeature,"imbalance:coeff");
+  for (int i = 0; i < nfeature*nfeature; i++) amat[i] = 0.0;
+  for (int i = 0; i < nfeature; i++) bvec[i] = coeff[i] = 0.0;
+  nsample = 0.0;
+  excess = -1.0;
+}
+
+/* ----------------------------------------------------------------------
+   add cost per step of each proc since last call as a regression sample
+   re-fit component costs and assign each atom its predicted cost
+------------------------------------------------------------------------- */
+
+void ImbalanceModel::compute(double *weight)
+{
+  if (!timer->has_normal()) return;
+
+  int i,j;
+  int nlocal = atom->nlocal;
+  int ntypes = atom->ntypes;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  int *bitmask = group->bitmask;
+
+  // cost = wall time of relevant timers per step since last invocation
+
+  double cost = -last;
+  cost += timer->get_wall(Timer::PAIR);
+  cost += timer->get_wall(Timer::NEIGH);
+  cost += timer->get_wall(Timer::BOND);
+  cost += timer->get_wall(Timer::KSPACE);
+  cost += timer->get_wall(Timer::MODIFY);
+  last += cost;
+
+  bigint nsteps = update->ntimestep - laststep;
+  laststep = update->ntimestep;
+
+  double maxcost;
+  MPI_Allreduce(&cost,&maxcost,1,MPI_DOUBLE,MPI_MAX,world);
+
+  // per-atom neighbor counts, 0 if no suitable list
+
+  if (nlocal > maxneigh) {
+    maxneigh = atom->nmax;
+    memory->destroy(nneigh);
+    memory->create(nneigh,maxneigh,"imbalance:nneigh");
+  }
+  neigh_counts();
+
+  // feature vector of this proc, accumulate normal equations A c = b
+  // older samples are down-weighted by decay
+
+  if (nsteps > 0 && maxcost > 0.0) {
+    int n = nfeature;
+    double *x = new double[n];
+    double *one = new double[n*n+n];
+    double *all = new double[n*n+n];
+
+    for (j = 0; j < n; j++) x[j] = 0.0;
+    x[0] = 1.0;
+    for (i = 0; i < nlocal; i++) {
+      x[type[i]] += 1.0;
+      x[ntypes+1] += nneigh[i];
+      for (j = 0; j < ngroup; j++)
+        if (mask[i] & bitmask[groups[j]]) x[ntypes+2+j] += 1.0;
+    }
+
+    double y = cost/nsteps;
+    for (i = 0; i < n; i++) {
+      for (j = 0; j < n; j++) one[i*n+j] = x[i]*x[j];
+      one[n*n+i] = x[i]*y;
+    }
+    MPI_Allreduce(one,all,n*n+n,MPI_DOUBLE,MPI_SUM,world);
+
+    for (i = 0; i < n*n; i++) amat[i] = decay*amat[i] + all[i];
+    for (i = 0; i < n; i++) bvec[i] = decay*bvec[i] + all[n*n+i];
+    nsample = decay*nsample + comm->nprocs;
+
+    delete [] x;
+    delete [] one;
+    delete [] all;
+
+    solve();
+  }
+
+  if (nsample == 0.0) return;
+
+  // predicted cost per step of each atom
+  // floor insures atoms of components with fitted cost <= 0 keep a weight
+
+  double *wt = new double[nlocal];
+  double wtsum = 0.0;
+  for (i = 0; i < nlocal; i++) {
+    wt[i] = coeff[type[i]] + coeff[ntypes+1]*nneigh[i];
+    for (j = 0; j < ngroup; j++)
+      if (mask[i] & bitmask[groups[j]]) wt[i] += coeff[ntypes+2+j];
+    if (wt[i] > 0.0) wtsum += wt[i];
+  }
+
+  double all;
+  MPI_Allreduce(&wtsum,&all,1,MPI_DOUBLE,MPI_SUM,world);
+  if (all <= 0.0 || atom->natoms == 0) {
+    delete [] wt;
+    return;
+  }
+  double wtmin = FLOOR * all/atom->natoms;
+
+  double mycost = 0.0;
+  for (i = 0; i < nlocal; i++) {
+    if (wt[i] < wtmin) wt[i] = wtmin;
+    weight[i] *= wt[i];
+    mycost += wt[i];
+  }
+  delete [] wt;
+
+  // excess = time per step lost to waiting on the most loaded proc
+
+  double maxpred,sumpred;
+  MPI_Allreduce(&mycost,&maxpred,1,MPI_DOUBLE,MPI_MAX,world);
+  MPI_Allreduce(&mycost,&sumpred,1,MPI_DOUBLE,MPI_SUM,world);
+  excess = maxpred - sumpred/comm->nprocs;
+}
+
+/* -------------------------------------------------------------------- */
+
+void ImbalanceModel::info(FILE *fp)
+{
+  fprintf(fp,"  model weight decay: %g, samples: %g\n",decay,nsample);
+  if (nsample == 0.0) return;
+
+  fprintf(fp,"  model cost per step:");
+  for (int i = 1; i <= atom->ntypes; i++)
+    fprintf(fp," type%d=%g",i,coeff[i]);
+  fprintf(fp," neigh=%g",coeff[atom->ntypes+1]);
+  for (int j = 0; j < ngroup; j++)
+    fprintf(fp," %s=%g",group->names[groups[j]],coeff[atom->ntypes+2+j]);
+  fputs("\n",fp);
+}
+
+/* -------------------------------------------------------------------- */
+
+double ImbalanceModel::gain()
+{
+  return excess;
+}
+
+/* ----------------------------------------------------------------------
+   store neighbor count of each owned atom in nneigh
+   use same kind of list as ImbalanceNeigh
+   return 0 and set counts to 0 if no suitable list
+------------------------------------------------------------------------- */
+
+int ImbalanceModel::neigh_counts()
+{
+  int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++) nneigh[i] = 0;
+
+  int req;
+  for (req = 0; req < neighbor->old_nrequest; ++req) {
+    if (neighbor->old_requests[req]->half &&
+        neighbor->old_requests[req]->skip == 0 &&
+        neighbor->lists[req] && neighbor->lists[req]->numneigh) break;
+  }
+  if (req >= neighbor->old_nrequest || neighbor->ago < 0) return 0;
+
+  NeighList *list = neighbor->lists[req];
+  const int inum = list->inum;
+  const int * const ilist = list->ilist;
+  const int * const numneigh = list->numneigh;
+
+  for (int ii = 0; ii < inum; ii++) {
+    int i = ilist[ii];
+    if (i < nlocal) nneigh[i] = numneigh[i];
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   solve regularized normal equations for coeff
+   Gaussian elimination with partial pivoting on a copy
+   components never present in any sample get a cost of 0.0
+------------------------------------------------------------------------- */
+
+void ImbalanceModel::solve()
+{
+  int i,j,k;
+  int n = nfeature;
+
+  double **m;
+  memory->create(m,n,n+1,"imbalance:m");
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) m[i][j] = amat[i*n+j];
+    m[i][n] = bvec[i];
+    if (m[i][i] > 0.0) m[i][i] *= 1.0 + RIDGE;
+    else {
+      m[i][i] = 1.0;
+      m[i][n] = 0.0;
+    }
+  }
+
+  for (k = 0; k < n; k++) {
+    int ipivot = k;
+    for (i = k+1; i < n; i++)
+      if (fabs(m[i][k]) > fabs(m[ipivot][k])) ipivot = i;
+    if (ipivot != k) {
+      for (j = k; j <= n; j++) {
+        double tmp = m[k][j];
+        m[k][j] = m[ipivot][j];
+        m[ipivot][j] = tmp;
+      }
+    }
+    if (m[k][k] == 0.0) continue;
+    for (i = k+1; i < n; i++) {
+      double f = m[i][k]/m[k][k];
+      for (j = k; j <= n; j++) m[i][j] -= f*m[k][j];
+    }
+  }
+
+  for (i = n-1; i >= 0; i--) {
+    double sum = m[i][n];
+    for (j = i+1; j < n; j++) sum -= m[i][j]*coeff[j];
+    coeff[i] = (m[i][i] != 0.0) ? sum/m[i][i] : 0.0;
+  }
+
+  memory->destroy(m);
+}
@@ -0,0 +1,60 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_IMBALANCE_MODEL_H
+#define LMP_IMBALANCE_MODEL_H
+
+#include "imbalance.h"
+
+namespace LAMMPS_NS {
+
+class ImbalanceModel : public Imbalance {
+ public:
+  ImbalanceModel(class LAMMPS *);
+  virtual ~ImbalanceModel();
+
+ public:
+  // parse options, return number of arguments consumed
+  virtual int options(int, char **);
+  // reinitialize internal data
+  virtual void init(int);
+  // compute and apply weight factors to local atom array
+  virtual void compute(double *);
+  // print information about the state of this imbalance compute
+  virtual void info(FILE *);
+  // estimated time per step recovered by rebalancing
+  virtual double gain();
+
+ private:
+  double decay;                // weight of previous samples in regression
+  double last;                 // combined wall time from last call
+  bigint laststep;             // timestep of last call
+
+  int ngroup;                  // # of distinct fix groups other than all
+  int *groups;                 // their group indices
+  int nfeature;                // # of cost components per proc
+  double *amat,*bvec;          // accumulated normal equations
+  double *coeff;               // fitted cost of each component
+  double nsample;              // accumulated (decayed) # of samples
+  double excess;               // predicted max - ave cost per step
+
+  int maxneigh;
+  int *nneigh;                 // neighbor count of each owned atom
+
+  int neigh_counts();
+  void solve();
+};
+
+}
+
+#endif
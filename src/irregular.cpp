@@ -30,11 +30,15 @@ int *Irregular::proc_recv_copy;
 int compare_standalone(const void *, const void *);
 
 enum{LAYOUT_UNIFORM,LAYOUT_NONUNIFORM,LAYOUT_TILED};    // several files
+enum{AUTO,P2P,ALLTOALL,NODE};                          // same as in Comm
 
 #define BUFFACTOR 1.5
 #define BUFMIN 1000
 #define BUFEXTRA 1000
 
+#define DENSE 0.25         // alltoall if procs send to this fraction of procs
+#define SMALLMSG 8192      // node route only if messages are smaller (bytes)
+
 /* ---------------------------------------------------------------------- */
 
 Irregular::Irregular(LAMMPS *lmp) : Pointers(lmp)
@@ -63,6 +67,22 @@ Irregular::Irregular(LAMMPS *lmp) : Pointers(lmp)
   memory->create(work1,nprocs,"irregular:work1");
   memory->create(work2,nprocs,"irregular:work2");
 
+  // route of each plan is chosen when it is created
+  // node layout is set when first needed
+
+  stageflag = 0;
+  route = P2P;
+  stage1 = stage2 = NULL;
+
+  nnode = 0;
+  node_procs = node_first = node_size = NULL;
+
+  // rendezvous on atom IDs is set when first needed
+
+  rvous_maxtag = 0;
+  nrvous = 0;
+  rvous_owner = NULL;
+
   // initialize buffers for migrate atoms, not used for datum comm
   // these can persist for multiple irregular operations
 
@@ -84,6 +104,10 @@ Irregular::~Irregular()
   memory->destroy(work2);
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
+  memory->destroy(node_procs);
+  memory->destroy(node_first);
+  memory->destroy(node_size);
+  memory->destroy(rvous_owner);
 }
 
 /* ----------------------------------------------------------------------
@@ -187,11 +211,19 @@ void Irregular::migrate_atoms(int sortflag, int preassign, int *procassign)
 
   // create irregular communication plan, perform comm, destroy plan
   // returned nrecv = size of buffer needed for incoming atoms
+  // node route does all of this itself, once for each of its 2 stages
 
-  int nrecv = create_atom(nsendatom,msizes,mproclist,sortflag);
-  if (nrecv > maxrecv) grow_recv(nrecv);
-  exchange_atom(buf_send,msizes,buf_recv);
-  destroy_atom();
+  int nrecv;
+  route = choose_route(nsendatom,msizes,mproclist,sizeof(double));
+
+  if (route == NODE)
+    nrecv = migrate_node(nsendatom,msizes,mproclist,sortflag);
+  else {
+    nrecv = create_atom(nsendatom,msizes,mproclist,sortflag);
+    if (nrecv > maxrecv) grow_recv(nrecv);
+    exchange_atom(buf_send,msizes,buf_recv);
+    destroy_atom();
+  }
 
   // add received atoms to my list
 
@@ -293,6 +325,8 @@ int Irregular::migrate_check()
 
 int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
 {
+  if (route == ALLTOALL) return create_atom_alltoall(n,sizes,proclist);
+
   int i;
 
   // setup for collective comm
@@ -472,6 +506,11 @@ int compare_standalone(const void *iptr, const void *jptr)
 
 void Irregular::exchange_atom(double *sendbuf, int *sizes, double *recvbuf)
 {
+  if (route == ALLTOALL) {
+    exchange_atom_alltoall(sendbuf,sizes,recvbuf);
+    return;
+  }
+
   int i,m,n,offset,count;
 
   // post all receives
@@ -518,6 +557,16 @@ void Irregular::exchange_atom(double *sendbuf, int *sizes, double *recvbuf)
 
 void Irregular::destroy_atom()
 {
+  if (route == ALLTOALL) {
+    delete [] index_send;
+    delete [] offset_send;
+    delete [] sendcounts;
+    delete [] sdispls;
+    delete [] recvcounts;
+    delete [] rdispls;
+    return;
+  }
+
   delete [] proc_send;
   delete [] length_send;
   delete [] num_send;
@@ -534,11 +583,17 @@ void Irregular::destroy_atom()
    n = # of datums to send
    proclist = proc to send each datum to, can include self
    sortflag = flag for sorting order of received messages by proc ID
+   nbytes = size of each datum, as later passed to exchange_data()
+     0 if not known, then node route is only used if explicitly requested
    return total # of datums I will recv, including any to self
 ------------------------------------------------------------------------- */
 
-int Irregular::create_data(int n, int *proclist, int sortflag)
+int Irregular::create_data(int n, int *proclist, int sortflag, int nbytes)
 {
+  route = choose_route(n,NULL,proclist,nbytes);
+  if (route == NODE) return create_data_node(n,proclist,sortflag,nbytes);
+  if (route == ALLTOALL) return create_data_alltoall(n,proclist);
+
   int i,m;
 
   // setup for collective comm
@@ -703,6 +758,24 @@ int Irregular::create_data(int n, int *proclist, int sortflag)
 
 void Irregular::exchange_data(char *sendbuf, int nbytes, char *recvbuf)
 {
+  if (route == ALLTOALL) {
+    exchange_data_alltoall(sendbuf,nbytes,recvbuf);
+    return;
+  }
+
+  // node route: send to gateway procs, which forward to destination procs
+
+  if (route == NODE) {
+    if (nstage*nbytes > maxbuf) {
+      memory->destroy(buf);
+      maxbuf = nstage*nbytes;
+      memory->create(buf,maxbuf,"irregular:buf");
+    }
+    stage1->exchange_data(sendbuf,nbytes,buf);
+    stage2->exchange_data(buf,nbytes,recvbuf);
+    return;
+  }
+
   int i,m,n,offset,count;
 
   // post all receives, starting after self copies
@@ -754,6 +827,25 @@ void Irregular::exchange_data(char *sendbuf, int nbytes, char *recvbuf)
 
 void Irregular::destroy_data()
 {
+  if (route == ALLTOALL) {
+    delete [] index_send;
+    delete [] index_self;
+    delete [] sendcounts;
+    delete [] sdispls;
+    delete [] recvcounts;
+    delete [] rdispls;
+    return;
+  }
+
+  if (route == NODE) {
+    stage1->destroy_data();
+    stage2->destroy_data();
+    delete stage1;
+    delete stage2;
+    stage1 = stage2 = NULL;
+    return;
+  }
+
   delete [] proc_send;
   delete [] num_send;
   delete [] index_send;
@@ -764,6 +856,601 @@ void Irregular::destroy_data()
   delete [] status;
 }
 
+/* ----------------------------------------------------------------------
+   setup rendezvous on atom IDs, used by send_to_owner() and find_owners()
+   atom ID I is assigned to rendezvous proc (I-1) % nprocs
+   store owning proc of each atom ID assigned to me in rvous_owner,
+     at index (I-1) / nprocs, -1 for IDs no atom has
+------------------------------------------------------------------------- */
+
+void Irregular::atom_owners()
+{
+  int i;
+
+  int nlocal = atom->nlocal;
+  tagint *tag = atom->tag;
+
+  tagint maxone = 0;
+  for (i = 0; i < nlocal; i++) maxone = MAX(maxone,tag[i]);
+  MPI_Allreduce(&maxone,&rvous_maxtag,1,MPI_LMP_TAGINT,MPI_MAX,world);
+
+  nrvous = rvous_maxtag/nprocs + 1;
+  memory->destroy(rvous_owner);
+  memory->create(rvous_owner,nrvous,"irregular:rvous_owner");
+  for (i = 0; i < nrvous; i++) rvous_owner[i] = -1;
+
+  // send (ID,me) for each atom I own to its rendezvous proc
+
+  int *proclist;
+  tagint *pairs;
+  memory->create(proclist,nlocal,"irregular:proclist");
+  memory->create(pairs,2*nlocal,"irregular:pairs");
+
+  for (i = 0; i < nlocal; i++) {
+    proclist[i] = (tag[i]-1) % nprocs;
+    pairs[2*i] = tag[i];
+    pairs[2*i+1] = me;
+  }
+
+  int nrecv = create_data(nlocal,proclist,0,2*sizeof(tagint));
+  tagint *recv;
+  memory->create(recv,2*nrecv,"irregular:recv");
+  exchange_data((char *) pairs,2*sizeof(tagint),(char *) recv);
+  destroy_data();
+
+  for (i = 0; i < nrecv; i++)
+    rvous_owner[(recv[2*i]-1) / nprocs] = recv[2*i+1];
+
+  memory->destroy(proclist);
+  memory->destroy(pairs);
+  memory->destroy(recv);
+}
+
+/* ----------------------------------------------------------------------
+   send N pairs of (atom ID, value) to the proc that owns each atom ID
+   1st exchange sends each pair to rendezvous proc of the atom ID,
+     2nd exchange forwards it from there to the owning proc
+   pairs with atom IDs that no atom has are dropped
+   pairs is overwritten
+   return # of pairs received, allocated and stored in recv
+------------------------------------------------------------------------- */
+
+int Irregular::send_to_owner(int n, tagint *pairs, tagint *&recv)
+{
+  int i,m;
+
+  int *proclist;
+  memory->create(proclist,n,"irregular:proclist");
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    if (pairs[2*i] <= 0 || pairs[2*i] > rvous_maxtag) continue;
+    proclist[m] = (pairs[2*i]-1) % nprocs;
+    pairs[2*m] = pairs[2*i];
+    pairs[2*m+1] = pairs[2*i+1];
+    m++;
+  }
+
+  int nrvous_recv = create_data(m,proclist,0,2*sizeof(tagint));
+  tagint *rvous;
+  memory->create(rvous,2*nrvous_recv,"irregular:rvous");
+  exchange_data((char *) pairs,2*sizeof(tagint),(char *) rvous);
+  destroy_data();
+  memory->destroy(proclist);
+
+  memory->create(proclist,nrvous_recv,"irregular:proclist");
+
+  m = 0;
+  for (i = 0; i < nrvous_recv; i++) {
+    int owner = rvous_owner[(rvous[2*i]-1) / nprocs];
+    if (owner < 0) continue;
+    proclist[m] = owner;
+    rvous[2*m] = rvous[2*i];
+    rvous[2*m+1] = rvous[2*i+1];
+    m++;
+  }
+
+  int nrecv = create_data(m,proclist,0,2*sizeof(tagint));
+  memory->create(recv,2*nrecv,"irregular:recv");
+  exchange_data((char *) rvous,2*sizeof(tagint),(char *) recv);
+  destroy_data();
+
+  memory->destroy(proclist);
+  memory->destroy(rvous);
+  return nrecv;
+}
+
+/* ----------------------------------------------------------------------
+   find the proc that owns each of N atom IDs
+   each ID is sent as (ID,me,index) to its rendezvous proc,
+     which returns (index,owner) to the requesting proc
+   owners[i] = owning proc of ids[i], -1 if no atom has that ID
+------------------------------------------------------------------------- */
+
+void Irregular::find_owners(int n, tagint *ids, int *owners)
+{
+  int i,m;
+
+  int *proclist;
+  tagint *triples;
+  memory->create(proclist,n,"irregular:proclist");
+  memory->create(triples,3*n,"irregular:triples");
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    owners[i] = -1;
+    if (ids[i] <= 0 || ids[i] > rvous_maxtag) continue;
+    proclist[m] = (ids[i]-1) % nprocs;
+    triples[3*m] = ids[i];
+    triples[3*m+1] = me;
+    triples[3*m+2] = i;
+    m++;
+  }
+
+  int nrvous_recv = create_data(m,proclist,0,3*sizeof(tagint));
+  tagint *rvous;
+  memory->create(rvous,3*nrvous_recv,"irregular:rvous");
+  exchange_data((char *) triples,3*sizeof(tagint),(char *) rvous);
+  destroy_data();
+  memory->destroy(proclist);
+  memory->destroy(triples);
+
+  // reply to each requesting proc with (index,owner)
+
+  int *replies;
+  memory->create(proclist,nrvous_recv,"irregular:proclist");
+  memory->create(replies,2*nrvous_recv,"irregular:replies");
+
+  for (i = 0; i < nrvous_recv; i++) {
+    proclist[i] = static_cast<int> (rvous[3*i+1]);
+    replies[2*i] = static_cast<int> (rvous[3*i+2]);
+    replies[2*i+1] = rvous_owner[(rvous[3*i]-1) / nprocs];
+  }
+
+  int nrecv = create_data(nrvous_recv,proclist,0,2*sizeof(int));
+  int *recv;
+  memory->create(recv,2*nrecv,"irregular:recv");
+  exchange_data((char *) replies,2*sizeof(int),(char *) recv);
+  destroy_data();
+
+  for (i = 0; i < nrecv; i++) owners[recv[2*i]] = recv[2*i+1];
+
+  memory->destroy(proclist);
+  memory->destroy(rvous);
+  memory->destroy(replies);
+  memory->destroy(recv);
+}
+
+/* ----------------------------------------------------------------------
+   choose route for a plan that sends N atoms/datums to procs in proclist
+   sizes = size of each atom, NULL if each datum is a single unit
+   nbytes = # of bytes in a unit, 0 if not known
+   stages of node route are always P2P
+   if comm_modify irregular style is not AUTO, return it
+   else choose collectively from avg # and size of messages:
+     ALLTOALL if procs send to a large fraction of all procs
+     NODE if procs send many small messages to more procs
+       than the 2 stages of the node route would
+     else P2P
+------------------------------------------------------------------------- */
+
+int Irregular::choose_route(int n, int *sizes, int *proclist, int nbytes)
+{
+  if (stageflag) return P2P;
+  if (comm->irregstyle != AUTO) return comm->irregstyle;
+  if (nprocs == 1) return P2P;
+
+  int i;
+
+  for (i = 0; i < nprocs; i++) work1[i] = 0;
+  for (i = 0; i < n; i++) work1[proclist[i]] = 1;
+  work1[me] = 0;
+
+  // one = # of messages and # of units I send, not including self
+
+  double one[2],all[2];
+  one[0] = one[1] = 0.0;
+  for (i = 0; i < nprocs; i++) one[0] += work1[i];
+  for (i = 0; i < n; i++)
+    if (proclist[i] != me) one[1] += sizes ? sizes[i] : 1;
+  MPI_Allreduce(one,all,2,MPI_DOUBLE,MPI_SUM,world);
+
+  double nmsg = all[0]/nprocs;
+  if (nmsg >= DENSE*nprocs) return ALLTOALL;
+
+  node_setup();
+  if (nnode == 1 || nnode == nprocs) return P2P;
+
+  if (nbytes == 0) return P2P;
+
+  double msgsize = 0.0;
+  if (all[0] > 0.0) msgsize = nbytes*all[1]/all[0];
+  if (nmsg > nnode + nprocs/nnode && msgsize < SMALLMSG) return NODE;
+  return P2P;
+}
+
+/* ----------------------------------------------------------------------
+   setup node layout of procs from Comm
+   node_procs = all procs, ordered by node and by proc ID within a node
+   node_first,node_size = where block of node of each proc starts, its size
+------------------------------------------------------------------------- */
+
+void Irregular::node_setup()
+{
+  if (node_procs) return;
+
+  comm->node_setup();
+  int *procnode = comm->procnode;
+
+  memory->create(node_procs,nprocs,"irregular:node_procs");
+  memory->create(node_first,nprocs,"irregular:node_first");
+  memory->create(node_size,nprocs,"irregular:node_size");
+
+  // count procs of each node and assign blocks, using 1st proc of node
+
+  int i;
+  for (i = 0; i < nprocs; i++) node_size[i] = 0;
+  for (i = 0; i < nprocs; i++) node_size[procnode[i]]++;
+
+  nnode = 0;
+  int offset = 0;
+  for (i = 0; i < nprocs; i++)
+    if (node_size[i]) {
+      node_first[i] = work1[i] = offset;
+      offset += node_size[i];
+      nnode++;
+    }
+
+  // fill blocks, then copy info of 1st proc of node to its other procs
+
+  for (i = 0; i < nprocs; i++) node_procs[work1[procnode[i]]++] = i;
+
+  for (i = 0; i < nprocs; i++) {
+    node_first[i] = node_first[procnode[i]];
+    node_size[i] = node_size[procnode[i]];
+  }
+
+  for (i = node_first[me]; node_procs[i] != me; i++);
+  node_index = i - node_first[me];
+}
+
+/* ----------------------------------------------------------------------
+   return gateway proc for data I send to proc
+   gateway is on node of proc, procs on my node use different gateways
+------------------------------------------------------------------------- */
+
+int Irregular::gateway(int proc)
+{
+  return node_procs[node_first[proc] + node_index % node_size[proc]];
+}
+
+/* ----------------------------------------------------------------------
+   create a communication plan for atoms via MPI_Alltoallv()
+   same args and return as create_atom()
+   received atoms are ordered by proc ID
+------------------------------------------------------------------------- */
+
+int Irregular::create_atom_alltoall(int n, int *sizes, int *proclist)
+{
+  int i;
+
+  sendcounts = new int[nprocs];
+  sdispls = new int[nprocs];
+  recvcounts = new int[nprocs];
+  rdispls = new int[nprocs];
+  index_send = new int[n];
+  offset_send = new int[n];
+  nitem = n;
+
+  // sendcounts = # of doubles I send to each proc
+  // work1 = # of atoms I send to each proc
+  // recvcounts = # of doubles each proc sends me
+
+  for (i = 0; i < nprocs; i++) sendcounts[i] = work1[i] = 0;
+  for (i = 0; i < n; i++) {
+    sendcounts[proclist[i]] += sizes[i];
+    work1[proclist[i]]++;
+  }
+
+  MPI_Alltoall(sendcounts,1,MPI_INT,recvcounts,1,MPI_INT,world);
+
+  sdispls[0] = rdispls[0] = 0;
+  for (i = 1; i < nprocs; i++) {
+    sdispls[i] = sdispls[i-1] + sendcounts[i-1];
+    rdispls[i] = rdispls[i-1] + recvcounts[i-1];
+  }
+
+  // index_send = list of atoms, in order of procs they are sent to
+  // offset_send = where each atom starts in send buffer
+
+  work2[0] = 0;
+  for (i = 1; i < nprocs; i++) work2[i] = work2[i-1] + work1[i-1];
+
+  for (i = 0; i < n; i++) {
+    index_send[work2[proclist[i]]++] = i;
+    if (i) offset_send[i] = offset_send[i-1] + sizes[i-1];
+    else offset_send[i] = 0;
+  }
+
+  // sendmax_proc = # of doubles I send in all messages
+
+  sendmax_proc = sdispls[nprocs-1] + sendcounts[nprocs-1];
+
+  return rdispls[nprocs-1] + recvcounts[nprocs-1];
+}
+
+/* ----------------------------------------------------------------------
+   communicate atoms via MPI_Alltoallv()
+   same args as exchange_atom()
+------------------------------------------------------------------------- */
+
+void Irregular::exchange_atom_alltoall(double *sendbuf, int *sizes,
+                                       double *recvbuf)
+{
+  int i,m,offset;
+
+  if (sendmax_proc > maxdbuf) {
+    memory->destroy(dbuf);
+    maxdbuf = sendmax_proc;
+    memory->create(dbuf,maxdbuf,"irregular:dbuf");
+  }
+
+  offset = 0;
+  for (i = 0; i < nitem; i++) {
+    m = index_send[i];
+    memcpy(&dbuf[offset],&sendbuf[offset_send[m]],sizes[m]*sizeof(double));
+    offset += sizes[m];
+  }
+
+  MPI_Alltoallv(dbuf,sendcounts,sdispls,MPI_DOUBLE,
+                recvbuf,recvcounts,rdispls,MPI_DOUBLE,world);
+}
+
+/* ----------------------------------------------------------------------
+   create a communication plan for datums via MPI_Alltoallv()
+   same args and return as create_data()
+   datums copied to self are first, others are ordered by proc ID
+------------------------------------------------------------------------- */
+
+int Irregular::create_data_alltoall(int n, int *proclist)
+{
+  int i,m;
+
+  // work1 = # of datums I send to each proc, not including self
+
+  for (i = 0; i < nprocs; i++) work1[i] = 0;
+  for (i = 0; i < n; i++) work1[proclist[i]]++;
+  num_self = work1[me];
+  work1[me] = 0;
+  nitem = n - num_self;
+
+  sendcounts = new int[nprocs];
+  sdispls = new int[nprocs];
+  recvcounts = new int[nprocs];
+  rdispls = new int[nprocs];
+  index_send = new int[nitem];
+  index_self = new int[num_self];
+
+  // recvcounts = # of datums each proc sends me
+
+  for (i = 0; i < nprocs; i++) sendcounts[i] = work1[i];
+  MPI_Alltoall(sendcounts,1,MPI_INT,recvcounts,1,MPI_INT,world);
+
+  sdispls[0] = rdispls[0] = 0;
+  for (i = 1; i < nprocs; i++) {
+    sdispls[i] = sdispls[i-1] + sendcounts[i-1];
+    rdispls[i] = rdispls[i-1] + recvcounts[i-1];
+  }
+
+  // index_send = list of datums, in order of procs they are sent to
+  // index_self = list of which datums to copy to self
+
+  for (i = 0; i < nprocs; i++) work2[i] = sdispls[i];
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    if (proclist[i] == me) index_self[m++] = i;
+    else index_send[work2[proclist[i]]++] = i;
+  }
+
+  sendmax_proc = nitem;
+
+  return num_self + rdispls[nprocs-1] + recvcounts[nprocs-1];
+}
+
+/* ----------------------------------------------------------------------
+   communicate datums via MPI_Alltoallv()
+   same args as exchange_data()
+------------------------------------------------------------------------- */
+
+void Irregular::exchange_data_alltoall(char *sendbuf, int nbytes,
+                                       char *recvbuf)
+{
+  int i;
+
+  if (sendmax_proc*nbytes > maxbuf) {
+    memory->destroy(buf);
+    maxbuf = sendmax_proc*nbytes;
+    memory->create(buf,maxbuf,"irregular:buf");
+  }
+
+  for (i = 0; i < nitem; i++)
+    memcpy(&buf[i*nbytes],&sendbuf[index_send[i]*nbytes],nbytes);
+
+  // copy datums to self, put at beginning of recvbuf
+
+  for (i = 0; i < num_self; i++)
+    memcpy(&recvbuf[i*nbytes],&sendbuf[index_self[i]*nbytes],nbytes);
+
+  MPI_Datatype datum;
+  MPI_Type_contiguous(nbytes,MPI_CHAR,&datum);
+  MPI_Type_commit(&datum);
+  MPI_Alltoallv(buf,sendcounts,sdispls,datum,&recvbuf[num_self*nbytes],
+                recvcounts,rdispls,datum,world);
+  MPI_Type_free(&datum);
+}
+
+/* ----------------------------------------------------------------------
+   create a 2-stage communication plan for datums via gateway procs
+   same args and return as create_data()
+   1st stage sends the destination of each datum along with it,
+     so gateway procs can setup the 2nd stage
+------------------------------------------------------------------------- */
+
+int Irregular::create_data_node(int n, int *proclist, int sortflag,
+                                int nbytes)
+{
+  node_setup();
+
+  int *procgate = new int[n];
+  for (int i = 0; i < n; i++) procgate[i] = gateway(proclist[i]);
+
+  stage1 = new Irregular(lmp);
+  stage1->stageflag = 1;
+  nstage = stage1->create_data(n,procgate,sortflag,nbytes);
+
+  int *procdest = new int[nstage];
+  stage1->exchange_data((char *) proclist,sizeof(int),(char *) procdest);
+
+  stage2 = new Irregular(lmp);
+  stage2->stageflag = 1;
+  int nrecv = stage2->create_data(nstage,procdest,sortflag,nbytes);
+
+  delete [] procgate;
+  delete [] procdest;
+
+  return nrecv;
+}
+
+/* ----------------------------------------------------------------------
+   communicate atoms in buf_send in 2 stages via gateway procs
+   same args as create_atom()
+   store received atoms in buf_recv, return # of doubles received
+   1st stage sends each atom with a header of its destination and size,
+     atoms with gateway = me skip it
+   2nd stage forwards them from gateway to destination,
+     atoms with destination = me skip it
+------------------------------------------------------------------------- */
+
+int Irregular::migrate_node(int n, int *sizes, int *proclist, int sortflag)
+{
+  int i,m,offset,size,dest;
+
+  node_setup();
+  route = P2P;
+
+  // 1st stage: atoms to gateway procs
+
+  int n1 = 0;
+  int size1 = 0;
+  for (i = 0; i < n; i++)
+    if (gateway(proclist[i]) != me) {
+      n1++;
+      size1 += sizes[i] + 2;
+    }
+
+  int *proc1 = new int[n1];
+  int *sizes1 = new int[n1];
+  double *buf1;
+  memory->create(buf1,size1,"irregular:buf1");
+
+  m = size1 = offset = 0;
+  for (i = 0; i < n; i++) {
+    if (gateway(proclist[i]) != me) {
+      proc1[m] = gateway(proclist[i]);
+      sizes1[m] = sizes[i] + 2;
+      buf1[size1] = proclist[i];
+      buf1[size1+1] = sizes[i];
+      memcpy(&buf1[size1+2],&buf_send[offset],sizes[i]*sizeof(double));
+      size1 += sizes1[m++];
+    }
+    offset += sizes[i];
+  }
+
+  int nrecv1 = create_atom(n1,sizes1,proc1,sortflag);
+  double *recv1;
+  memory->create(recv1,nrecv1,"irregular:recv1");
+  exchange_atom(buf1,sizes1,recv1);
+  destroy_atom();
+
+  delete [] proc1;
+  delete [] sizes1;
+  memory->destroy(buf1);
+
+  // 2nd stage: atoms from gateway procs to destination procs
+  // my atoms with gateway = me and received atoms not for me
+  // nself = # of doubles in received atoms for me
+
+  int n2 = 0;
+  int size2 = 0;
+  int nself = 0;
+
+  for (i = 0; i < n; i++)
+    if (gateway(proclist[i]) == me) {
+      n2++;
+      size2 += sizes[i];
+    }
+  for (i = 0; i < nrecv1; i += size+2) {
+    size = static_cast<int> (recv1[i+1]);
+    if (static_cast<int> (recv1[i]) == me) nself += size;
+    else {
+      n2++;
+      size2 += size;
+    }
+  }
+
+  int *proc2 = new int[n2];
+  int *sizes2 = new int[n2];
+  double *buf2;
+  memory->create(buf2,size2,"irregular:buf2");
+
+  m = size2 = offset = 0;
+  for (i = 0; i < n; i++) {
+    if (gateway(proclist[i]) == me) {
+      proc2[m] = proclist[i];
+      sizes2[m] = sizes[i];
+      memcpy(&buf2[size2],&buf_send[offset],sizes[i]*sizeof(double));
+      size2 += sizes2[m++];
+    }
+    offset += sizes[i];
+  }
+
+  int nrecv2 = 0;
+  for (i = 0; i < nrecv1; i += size+2) {
+    dest = static_cast<int> (recv1[i]);
+    size = static_cast<int> (recv1[i+1]);
+    if (dest != me) {
+      proc2[m] = dest;
+      sizes2[m] = size;
+      memcpy(&buf2[size2],&recv1[i+2],size*sizeof(double));
+      size2 += sizes2[m++];
+    }
+  }
+
+  nrecv2 = create_atom(n2,sizes2,proc2,sortflag);
+  int nrecv = nself + nrecv2;
+  if (nrecv > maxrecv) grow_recv(nrecv);
+
+  offset = 0;
+  for (i = 0; i < nrecv1; i += size+2) {
+    size = static_cast<int> (recv1[i+1]);
+    if (static_cast<int> (recv1[i]) == me) {
+      memcpy(&buf_recv[offset],&recv1[i+2],size*sizeof(double));
+      offset += size;
+    }
+  }
+
+  exchange_atom(buf2,sizes2,&buf_recv[nself]);
+  destroy_atom();
+
+  delete [] proc2;
+  delete [] sizes2;
+  memory->destroy(buf2);
+  memory->destroy(recv1);
+
+  return nrecv;
+}
+
 /* ----------------------------------------------------------------------
    realloc the size of the send buffer as needed with BUFFACTOR & BUFEXTRA
    if flag = 1, realloc
@@ -805,5 +1492,7 @@ bigint Irregular::memory_usage()
   bytes += maxbuf;                   // buf
   bytes += 2*maxlocal*sizeof(int);   // mproclist,msizes
   bytes += 2*nprocs*sizeof(int);     // work1,work2
+  if (node_procs) bytes += 3*nprocs*sizeof(int);   // node layout
+  bytes += nrvous*sizeof(int);       // rvous_owner
   return bytes;
 }
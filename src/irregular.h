@@ -30,9 +30,12 @@ class Irregular : protected Pointers {
   void migrate_atoms(int sortflag = 0, int preassign = 0,
                      int *procassign = NULL);
   int migrate_check();
-  int create_data(int, int *, int sortflag = 0);
+  int create_data(int, int *, int sortflag = 0, int nbytes = 0);
   void exchange_data(char *, int, char *);
   void destroy_data();
+  void atom_owners();
+  int send_to_owner(int, tagint *, tagint *&);
+  void find_owners(int, tagint *, int *);
   bigint memory_usage();
 
  private:
@@ -52,6 +55,9 @@ class Irregular : protected Pointers {
 
   int *work1,*work2;                // work vectors
 
+  int stageflag;             // 1 if a stage of node route, always P2P
+  int route;                 // route of current plan: P2P,ALLTOALL,NODE
+
   // plan params for irregular communication of atoms or datums
   // no params refer to atoms/data copied to self
 
@@ -79,12 +85,53 @@ class Irregular : protected Pointers {
   int num_self;              // # of datums to copy to self
   int *index_self;           // list of which datums to copy to self
 
+  // extra plan params for route = ALLTOALL, one value per proc
+  // in # of doubles for atoms, in # of datums for datums
+
+  int nitem;                 // # of atoms/datums to send, not including self
+  int *sendcounts,*sdispls;  // size and offset of data sent to each proc
+  int *recvcounts,*rdispls;  // size and offset of data recv from each proc
+
+  // extra plan params for route = NODE
+  // data is sent to a gateway proc on the node of its destination,
+  //   which forwards it to the destination within the node
+
+  class Irregular *stage1;   // plan from me to gateway procs
+  class Irregular *stage2;   // plan from gateway procs to destination procs
+  int nstage;                // # of datums I recv as gateway proc
+
+  // node layout of procs, set by node_setup()
+
+  int nnode;                 // # of nodes
+  int node_index;            // my index among procs on my node
+  int *node_procs;           // all procs, ordered by node
+  int *node_first;           // where node of each proc starts in node_procs
+  int *node_size;            // # of procs on node of each proc
+
+  // rendezvous on atom IDs, atom ID I is assigned to proc (I-1) % nprocs
+  // set by atom_owners()
+
+  tagint rvous_maxtag;       // largest atom ID
+  int nrvous;                // # of atom IDs assigned to me
+  int *rvous_owner;          // proc that owns each atom ID assigned to me
+
   // private methods
 
   int create_atom(int, int *, int *, int);
   void exchange_atom(double *, int *, double *);
   void destroy_atom();
 
+  int create_atom_alltoall(int, int *, int *);
+  void exchange_atom_alltoall(double *, int *, double *);
+  int create_data_alltoall(int, int *);
+  void exchange_data_alltoall(char *, int, char *);
+  int create_data_node(int, int *, int, int);
+  int migrate_node(int, int *, int *, int);
+
+  int choose_route(int, int *, int *, int);
+  void node_setup();
+  int gateway(int);
+
   int binary(double, int, double *);
 
   void grow_send(int,int);          // reallocate send buffer
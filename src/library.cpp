@@ -32,6 +32,7 @@
 #include "modify.h"
 #include "output.h"
 #include "thermo.h"
+#include "dump_callback.h"
 #include "compute.h"
 #include "fix.h"
 #include "comm.h"
@@ -465,19 +466,19 @@ void *lammps_extract_compute(void *ptr, char *id, int style, int type)
       if (type == 0) {
         if (!compute->scalar_flag) return NULL;
         if (compute->invoked_scalar != lmp->update->ntimestep)
-          compute->compute_scalar();
+          compute->invoke_scalar();
         return (void *) &compute->scalar;
       }
       if (type == 1) {
         if (!compute->vector_flag) return NULL;
         if (compute->invoked_vector != lmp->update->ntimestep)
-          compute->compute_vector();
+          compute->invoke_vector();
         return (void *) compute->vector;
       }
       if (type == 2) {
         if (!compute->array_flag) return NULL;
         if (compute->invoked_array != lmp->update->ntimestep)
-          compute->compute_array();
+          compute->invoke_array();
         return (void *) compute->array;
       }
     }
@@ -486,12 +487,12 @@ void *lammps_extract_compute(void *ptr, char *id, int style, int type)
       if (!compute->peratom_flag) return NULL;
       if (type == 1) {
         if (compute->invoked_peratom != lmp->update->ntimestep)
-          compute->compute_peratom();
+          compute->invoke_peratom();
         return (void *) compute->vector_atom;
       }
       if (type == 2) {
         if (compute->invoked_peratom != lmp->update->ntimestep)
-          compute->compute_peratom();
+          compute->invoke_peratom();
         return (void *) compute->array_atom;
       }
     }
@@ -500,12 +501,12 @@ void *lammps_extract_compute(void *ptr, char *id, int style, int type)
       if (!compute->local_flag) return NULL;
       if (type == 1) {
         if (compute->invoked_local != lmp->update->ntimestep)
-          compute->compute_local();
+          compute->invoke_local();
         return (void *) compute->vector_local;
       }
       if (type == 2) {
         if (compute->invoked_local != lmp->update->ntimestep)
-          compute->compute_local();
+          compute->invoke_local();
         return (void *) compute->array_local;
       }
     }
@@ -713,6 +714,39 @@ double lammps_get_thermo(void *ptr, char *name)
   return dval;
 }
 
+/* ----------------------------------------------------------------------
+   set the function invoked by a dump callback style dump
+   id = ID of dump
+   callback is invoked on every proc each time the dump is written as
+     callback(caller_ptr,timestep,n,ncol,buf)
+     with n rows of ncol values for the atoms of that proc in buf
+   buf is owned by LAMMPS, caller must copy what it keeps
+   return -1 if dump doesn't exist or is not a callback style dump
+   return 0 for success
+------------------------------------------------------------------------- */
+
+int lammps_set_dump_callback(void *ptr, char *id,
+                             LAMMPS_DumpCallback callback, void *caller_ptr)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+  int err = -1;
+
+  BEGIN_CAPTURE
+  {
+    Output *output = lmp->output;
+    for (int idump = 0; idump < output->ndump; idump++) {
+      if (strcmp(id,output->dump[idump]->id) != 0) continue;
+      if (strcmp(output->dump[idump]->style,"callback") != 0) break;
+      DumpCallback *dump = (DumpCallback *) output->dump[idump];
+      dump->set_callback((DumpCallback::FnPtr) callback,caller_ptr);
+      err = 0;
+    }
+  }
+  END_CAPTURE
+
+  return err;
+}
+
 /* ----------------------------------------------------------------------
    return the total number of atoms in the system
    useful before call to lammps_get_atoms() so can pre-allocate vector
@@ -17,6 +17,7 @@
 */
 
 #include <mpi.h>
+#include <stdint.h>
 
 /* ifdefs allow this file to be included in a C program */
 
@@ -47,6 +48,17 @@ void lammps_reset_box(void *, double *, double *, double, double, double);
 int lammps_set_variable(void *, char *, char *);
 double lammps_get_thermo(void *, char *);
 
+// lammps_set_dump_callback() passes the timestep as a bigint
+// ifdef insures it is compatible with rest of LAMMPS
+// caller must match to how LAMMPS library is built
+
+#ifdef LAMMPS_SMALLSMALL
+typedef void (*LAMMPS_DumpCallback)(void *, int, int, int, double *);
+#else
+typedef void (*LAMMPS_DumpCallback)(void *, int64_t, int, int, double *);
+#endif
+int lammps_set_dump_callback(void *, char *, LAMMPS_DumpCallback, void *);
+
 int lammps_get_natoms(void *);
 void lammps_gather_atoms(void *, char *, int, int, void *);
 void lammps_scatter_atoms(void *, char *, int, int, void *);
@@ -16,6 +16,7 @@
 #include "domain.h"
 #include "update.h"
 #include "min.h"
+#include "output.h"
 #include "finish.h"
 #include "timer.h"
 #include "error.h"
@@ -63,6 +64,7 @@ void Minimize::command(int narg, char **arg)
   timer->init();
   timer->barrier_start();
   update->minimize->run(update->nsteps);
+  output->flush_dumps();
   timer->barrier_stop();
 
   update->minimize->cleanup();
@@ -25,6 +25,7 @@
 #include "domain.h"
 #include "input.h"
 #include "variable.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 
@@ -202,6 +203,11 @@ void Modify::init()
 
   for (i = 0; i < nfix; i++) fix[i]->init();
 
+  // register per-fix timers
+
+  for (i = 0; i < nfix; i++)
+    fix[i]->itimer = timer->add_detail("fix",fix[i]->id,fix[i]->style);
+
   // set global flag if any fix has its restart_pbc flag set
 
   restart_pbc_any = 0;
@@ -226,6 +232,8 @@ void Modify::init()
     compute[i]->invoked_array = -1;
     compute[i]->invoked_peratom = -1;
     compute[i]->invoked_local = -1;
+    compute[i]->itimer =
+      timer->add_detail("compute",compute[i]->id,compute[i]->style);
   }
   addstep_compute_all(update->ntimestep);
 
@@ -364,8 +372,11 @@ void Modify::setup_pre_reverse(int eflag, int vflag)
 
 void Modify::initial_integrate(int vflag)
 {
-  for (int i = 0; i < n_initial_integrate; i++)
+  for (int i = 0; i < n_initial_integrate; i++) {
+    timer->detail_start(fix[list_initial_integrate[i]]->itimer);
     fix[list_initial_integrate[i]]->initial_integrate(vflag);
+    timer->detail_stop(fix[list_initial_integrate[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -374,8 +385,11 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
-  for (int i = 0; i < n_post_integrate; i++)
+  for (int i = 0; i < n_post_integrate; i++) {
+    timer->detail_start(fix[list_post_integrate[i]]->itimer);
     fix[list_post_integrate[i]]->post_integrate();
+    timer->detail_stop(fix[list_post_integrate[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -384,8 +398,11 @@ void Modify::post_integrate()
 
 void Modify::pre_exchange()
 {
-  for (int i = 0; i < n_pre_exchange; i++)
+  for (int i = 0; i < n_pre_exchange; i++) {
+    timer->detail_start(fix[list_pre_exchange[i]]->itimer);
     fix[list_pre_exchange[i]]->pre_exchange();
+    timer->detail_stop(fix[list_pre_exchange[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -394,8 +411,11 @@ void Modify::pre_exchange()
 
 void Modify::pre_neighbor()
 {
-  for (int i = 0; i < n_pre_neighbor; i++)
+  for (int i = 0; i < n_pre_neighbor; i++) {
+    timer->detail_start(fix[list_pre_neighbor[i]]->itimer);
     fix[list_pre_neighbor[i]]->pre_neighbor();
+    timer->detail_stop(fix[list_pre_neighbor[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -404,8 +424,11 @@ void Modify::pre_neighbor()
 
 void Modify::pre_force(int vflag)
 {
-  for (int i = 0; i < n_pre_force; i++)
+  for (int i = 0; i < n_pre_force; i++) {
+    timer->detail_start(fix[list_pre_force[i]]->itimer);
     fix[list_pre_force[i]]->pre_force(vflag);
+    timer->detail_stop(fix[list_pre_force[i]]->itimer);
+  }
 }
 /* ----------------------------------------------------------------------
    pre_reverse call, only for relevant fixes
@@ -413,8 +436,11 @@ void Modify::pre_force(int vflag)
 
 void Modify::pre_reverse(int eflag, int vflag)
 {
-  for (int i = 0; i < n_pre_reverse; i++)
+  for (int i = 0; i < n_pre_reverse; i++) {
+    timer->detail_start(fix[list_pre_reverse[i]]->itimer);
     fix[list_pre_reverse[i]]->pre_reverse(eflag,vflag);
+    timer->detail_stop(fix[list_pre_reverse[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -423,8 +449,11 @@ void Modify::pre_reverse(int eflag, int vflag)
 
 void Modify::post_force(int vflag)
 {
-  for (int i = 0; i < n_post_force; i++)
+  for (int i = 0; i < n_post_force; i++) {
+    timer->detail_start(fix[list_post_force[i]]->itimer);
     fix[list_post_force[i]]->post_force(vflag);
+    timer->detail_stop(fix[list_post_force[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -433,8 +462,11 @@ void Modify::post_force(int vflag)
 
 void Modify::final_integrate()
 {
-  for (int i = 0; i < n_final_integrate; i++)
+  for (int i = 0; i < n_final_integrate; i++) {
+    timer->detail_start(fix[list_final_integrate[i]]->itimer);
     fix[list_final_integrate[i]]->final_integrate();
+    timer->detail_stop(fix[list_final_integrate[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -445,8 +477,11 @@ void Modify::final_integrate()
 void Modify::end_of_step()
 {
   for (int i = 0; i < n_end_of_step; i++)
-    if (update->ntimestep % end_of_step_every[i] == 0)
+    if (update->ntimestep % end_of_step_every[i] == 0) {
+      timer->detail_start(fix[list_end_of_step[i]]->itimer);
       fix[list_end_of_step[i]]->end_of_step();
+      timer->detail_stop(fix[list_end_of_step[i]]->itimer);
+    }
 }
 
 /* ----------------------------------------------------------------------
@@ -523,9 +558,12 @@ void Modify::setup_pre_force_respa(int vflag, int ilevel)
 
 void Modify::initial_integrate_respa(int vflag, int ilevel, int iloop)
 {
-  for (int i = 0; i < n_initial_integrate_respa; i++)
+  for (int i = 0; i < n_initial_integrate_respa; i++) {
+    timer->detail_start(fix[list_initial_integrate_respa[i]]->itimer);
     fix[list_initial_integrate_respa[i]]->
       initial_integrate_respa(vflag,ilevel,iloop);
+    timer->detail_stop(fix[list_initial_integrate_respa[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -534,8 +572,11 @@ void Modify::initial_integrate_respa(int vflag, int ilevel, int iloop)
 
 void Modify::post_integrate_respa(int ilevel, int iloop)
 {
-  for (int i = 0; i < n_post_integrate_respa; i++)
+  for (int i = 0; i < n_post_integrate_respa; i++) {
+    timer->detail_start(fix[list_post_integrate_respa[i]]->itimer);
     fix[list_post_integrate_respa[i]]->post_integrate_respa(ilevel,iloop);
+    timer->detail_stop(fix[list_post_integrate_respa[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -544,8 +585,11 @@ void Modify::post_integrate_respa(int ilevel, int iloop)
 
 void Modify::pre_force_respa(int vflag, int ilevel, int iloop)
 {
-  for (int i = 0; i < n_pre_force_respa; i++)
+  for (int i = 0; i < n_pre_force_respa; i++) {
+    timer->detail_start(fix[list_pre_force_respa[i]]->itimer);
     fix[list_pre_force_respa[i]]->pre_force_respa(vflag,ilevel,iloop);
+    timer->detail_stop(fix[list_pre_force_respa[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -554,8 +598,11 @@ void Modify::pre_force_respa(int vflag, int ilevel, int iloop)
 
 void Modify::post_force_respa(int vflag, int ilevel, int iloop)
 {
-  for (int i = 0; i < n_post_force_respa; i++)
+  for (int i = 0; i < n_post_force_respa; i++) {
+    timer->detail_start(fix[list_post_force_respa[i]]->itimer);
     fix[list_post_force_respa[i]]->post_force_respa(vflag,ilevel,iloop);
+    timer->detail_stop(fix[list_post_force_respa[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -564,8 +611,11 @@ void Modify::post_force_respa(int vflag, int ilevel, int iloop)
 
 void Modify::final_integrate_respa(int ilevel, int iloop)
 {
-  for (int i = 0; i < n_final_integrate_respa; i++)
+  for (int i = 0; i < n_final_integrate_respa; i++) {
+    timer->detail_start(fix[list_final_integrate_respa[i]]->itimer);
     fix[list_final_integrate_respa[i]]->final_integrate_respa(ilevel,iloop);
+    timer->detail_stop(fix[list_final_integrate_respa[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -574,8 +624,11 @@ void Modify::final_integrate_respa(int ilevel, int iloop)
 
 void Modify::min_pre_exchange()
 {
-  for (int i = 0; i < n_min_pre_exchange; i++)
+  for (int i = 0; i < n_min_pre_exchange; i++) {
+    timer->detail_start(fix[list_min_pre_exchange[i]]->itimer);
     fix[list_min_pre_exchange[i]]->min_pre_exchange();
+    timer->detail_stop(fix[list_min_pre_exchange[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -584,8 +637,11 @@ void Modify::min_pre_exchange()
 
 void Modify::min_pre_neighbor()
 {
-  for (int i = 0; i < n_min_pre_neighbor; i++)
+  for (int i = 0; i < n_min_pre_neighbor; i++) {
+    timer->detail_start(fix[list_min_pre_neighbor[i]]->itimer);
     fix[list_min_pre_neighbor[i]]->min_pre_neighbor();
+    timer->detail_stop(fix[list_min_pre_neighbor[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -594,8 +650,11 @@ void Modify::min_pre_neighbor()
 
 void Modify::min_pre_force(int vflag)
 {
-  for (int i = 0; i < n_min_pre_force; i++)
+  for (int i = 0; i < n_min_pre_force; i++) {
+    timer->detail_start(fix[list_min_pre_force[i]]->itimer);
     fix[list_min_pre_force[i]]->min_pre_force(vflag);
+    timer->detail_stop(fix[list_min_pre_force[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -604,8 +663,11 @@ void Modify::min_pre_force(int vflag)
 
 void Modify::min_pre_reverse(int eflag, int vflag)
 {
-  for (int i = 0; i < n_min_pre_reverse; i++)
+  for (int i = 0; i < n_min_pre_reverse; i++) {
+    timer->detail_start(fix[list_min_pre_reverse[i]]->itimer);
     fix[list_min_pre_reverse[i]]->min_pre_reverse(eflag,vflag);
+    timer->detail_stop(fix[list_min_pre_reverse[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -614,8 +676,11 @@ void Modify::min_pre_reverse(int eflag, int vflag)
 
 void Modify::min_post_force(int vflag)
 {
-  for (int i = 0; i < n_min_post_force; i++)
+  for (int i = 0; i < n_min_post_force; i++) {
+    timer->detail_start(fix[list_min_post_force[i]]->itimer);
     fix[list_min_post_force[i]]->min_post_force(vflag);
+    timer->detail_stop(fix[list_min_post_force[i]]->itimer);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -0,0 +1,166 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+MyHash = hash table of key/value pairs with key = tagint >= 0, value = int
+  open addressing with linear probing in a single power-of-2 array,
+    so a lookup usually touches only one cache line
+  table grows as needed to stay at most half full
+  memory is kept when cleared, so can reuse w/out reallocs
+usage:
+  reserve() for # of entries to be set, set() them, find() them, clear()
+methods:
+   int find(key) = return value for key, -1 if key is not in table
+   int set(key,value) = add key/value or overwrite value of existing key
+     return previous value for key, -1 if key was not in table
+   void erase(key) = remove key from table, if it is in table
+   void clear() = remove all keys from table
+   void reserve(N) = grow table so it can hold N entries w/out growing
+   int size() = return # of entries in table
+   int capacity() = return # of slots in table
+   bigint memory_usage() = return size of table in bytes
+------------------------------------------------------------------------- */
+
+#ifndef LAMMPS_MY_HASH_H
+#define LAMMPS_MY_HASH_H
+
+#include <stdlib.h>
+#include "lmptype.h"
+
+namespace LAMMPS_NS {
+
+class MyHash {
+ public:
+  MyHash() {
+    nused = nslot = 0;
+    mask = -1;
+    shift = 64;
+    slots = NULL;
+  }
+
+  ~MyHash() {
+    delete [] slots;
+  }
+
+  inline int find(tagint key) const {
+    if (nused == 0) return -1;
+    int i = home(key);
+    while (slots[i].key != EMPTY) {
+      if (slots[i].key == key) return slots[i].value;
+      i = (i+1) & mask;
+    }
+    return -1;
+  }
+
+  int set(tagint key, int value) {
+    if (2*(nused+1) > nslot) reserve(nused+1);
+    int i = home(key);
+    while (slots[i].key != EMPTY) {
+      if (slots[i].key == key) {
+        int old = slots[i].value;
+        slots[i].value = value;
+        return old;
+      }
+      i = (i+1) & mask;
+    }
+    slots[i].key = key;
+    slots[i].value = value;
+    nused++;
+    return -1;
+  }
+
+  // shift later entries of the probe sequence back into the hole,
+  //   unless their home slot is cyclically between the hole and them
+
+  void erase(tagint key) {
+    if (nused == 0) return;
+    int i = home(key);
+    while (slots[i].key != key) {
+      if (slots[i].key == EMPTY) return;
+      i = (i+1) & mask;
+    }
+
+    int j = i;
+    while (1) {
+      j = (j+1) & mask;
+      if (slots[j].key == EMPTY) break;
+      int k = home(slots[j].key);
+      if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) continue;
+      slots[i] = slots[j];
+      i = j;
+    }
+    slots[i].key = EMPTY;
+    nused--;
+  }
+
+  void clear() {
+    for (int i = 0; i < nslot; i++) slots[i].key = EMPTY;
+    nused = 0;
+  }
+
+  // nslot = smallest power of 2 >= 2N, at least MINSLOT
+  // re-insert current entries if table is reallocated
+
+  void reserve(int n) {
+    int nnew = MINSLOT;
+    while (nnew < 2*n) nnew *= 2;
+    if (nnew <= nslot) return;
+
+    Slot *old = slots;
+    int nold = nslot;
+
+    nslot = nnew;
+    mask = nslot-1;
+    shift = 64;
+    for (int m = nslot; m > 1; m /= 2) shift--;
+    slots = new Slot[nslot];
+    nused = 0;
+    for (int i = 0; i < nslot; i++) slots[i].key = EMPTY;
+
+    for (int i = 0; i < nold; i++)
+      if (old[i].key != EMPTY) set(old[i].key,old[i].value);
+    delete [] old;
+  }
+
+  int size() const {return nused;}
+  int capacity() const {return nslot;}
+
+  bigint memory_usage() const {return (bigint) nslot * sizeof(Slot);}
+
+ private:
+  static const tagint EMPTY = -1;
+  static const int MINSLOT = 64;
+
+  struct Slot {
+    tagint key;
+    int value;
+  };
+
+  int nused;              // # of entries in table
+  int nslot;              // # of slots in table, a power of 2
+  int mask;               // nslot-1, to wrap around end of table
+  int shift;              // 64 - log2(nslot), for hash function
+  Slot *slots;            // table of key/value pairs
+
+  // Fibonacci hashing: top bits of key * 2^64 / golden ratio
+  // spreads consecutive atom IDs evenly across the table
+
+  inline int home(tagint key) const {
+    return static_cast<int> (((uint64_t) key * 0x9E3779B97F4A7C15ULL) >>
+                             shift);
+  }
+};
+
+}
+
+#endif
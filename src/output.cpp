@@ -30,6 +30,7 @@
 #include "force.h"
 #include "dump.h"
 #include "write_restart.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 
@@ -115,6 +116,7 @@ Output::~Output()
   for (int i = 0; i < ndump; i++) delete [] var_dump[i];
   memory->sfree(var_dump);
   memory->destroy(ivar_dump);
+  flush_dumps();
   for (int i = 0; i < ndump; i++) delete dump[i];
   memory->sfree(dump);
 
@@ -132,6 +134,11 @@ Output::~Output()
 
 void Output::init()
 {
+  // register dump timers first, thermo may output them
+
+  for (int i = 0; i < ndump; i++)
+    dump[i]->itimer = timer->add_detail("dump",dump[i]->id,dump[i]->style);
+
   thermo->init();
   if (var_thermo) {
     ivar_thermo = input->variable->find(var_thermo);
@@ -307,7 +314,9 @@ void Output::write(bigint ntimestep)
         if (dump[idump]->clearstep || every_dump[idump] == 0)
           modify->clearstep_compute();
         if (last_dump[idump] != ntimestep) {
+          timer->detail_start(dump[idump]->itimer);
           dump[idump]->write();
+          timer->detail_stop(dump[idump]->itimer);
           last_dump[idump] = ntimestep;
         }
         if (every_dump[idump]) next_dump[idump] += every_dump[idump];
@@ -337,7 +346,7 @@ void Output::write(bigint ntimestep)
       *ptr = '\0';
       sprintf(file,"%s" BIGINT_FORMAT "%s",restart1,ntimestep,ptr+1);
       *ptr = '*';
-      if (last_restart != ntimestep) restart->write(file);
+      if (last_restart != ntimestep) restart->write(file,1);
       delete [] file;
       if (restart_every_single) next_restart_single += restart_every_single;
       else {
@@ -412,6 +421,18 @@ void Output::write_dump(bigint ntimestep)
   }
 }
 
+/* ----------------------------------------------------------------------
+   wait for snapshots still being written by dump I/O threads
+   and for staged restart files still being moved
+   called at end of a run and before dumps are deleted
+------------------------------------------------------------------------- */
+
+void Output::flush_dumps()
+{
+  for (int idump = 0; idump < ndump; idump++) dump[idump]->async_flush();
+  if (restart) restart->drain_flush();
+}
+
 /* ----------------------------------------------------------------------
    force restart file(s) to be written
    called from PRD and TAD
@@ -620,6 +641,7 @@ void Output::modify_dump(int narg, char **arg)
     if (strcmp(arg[0],dump[idump]->id) == 0) break;
   if (idump == ndump) error->all(FLERR,"Cound not find dump_modify ID");
 
+  dump[idump]->async_flush();
   dump[idump]->modify_params(narg-1,&arg[1]);
 }
 
@@ -636,6 +658,7 @@ void Output::delete_dump(char *id)
     if (strcmp(id,dump[idump]->id) == 0) break;
   if (idump == ndump) error->all(FLERR,"Could not find undump ID");
 
+  dump[idump]->async_flush();
   delete dump[idump];
   delete [] var_dump[idump];
 
@@ -806,6 +829,8 @@ void Output::create_restart(int narg, char **arg)
   restart = new WriteRestart(lmp);
   int iarg = nfile+1;
   restart->multiproc_options(multiproc,mpiioflag,narg-iarg,&arg[iarg]);
+  if (nfile == 2 && restart->delta > 1)
+    error->all(FLERR,"Restart delta keyword requires a single restart file");
 }
 
 /* ----------------------------------------------------------------------
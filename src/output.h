@@ -70,6 +70,7 @@ class Output : protected Pointers {
   void setup(int memflag = 1);       // initial output before run/min
   void write(bigint);                // output for current timestep
   void write_dump(bigint);           // force output of dump snapshots
+  void flush_dumps();                // finish async output of dump snapshots
   void write_restart(bigint);        // force output of a restart file
   void reset_timestep(bigint);       // reset next timestep for all output
 
@@ -184,4 +185,9 @@ E: Both restart files must use MPI-IO or neither
 
 Self-explanatory.
 
+E: Restart delta keyword requires a single restart file
+
+Delta restart files cannot be written with two toggled restart files,
+since the base file they refer to would be overwritten.
+
 */
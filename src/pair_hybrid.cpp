@@ -26,13 +26,14 @@
 #include "memory.h"
 #include "error.h"
 #include "respa.h"
+#include "timer.h"
 
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
 
 PairHybrid::PairHybrid(LAMMPS *lmp) : Pair(lmp),
-  styles(NULL), keywords(NULL), multiple(NULL), nmap(NULL),
+  styles(NULL), keywords(NULL), multiple(NULL), itimer(NULL), nmap(NULL),
   map(NULL), special_lj(NULL), special_coul(NULL)
 {
   nstyles = 0;
@@ -59,6 +60,7 @@ PairHybrid::~PairHybrid()
   delete [] styles;
   delete [] keywords;
   delete [] multiple;
+  delete [] itimer;
 
   delete [] special_lj;
   delete [] special_coul;
@@ -130,9 +132,11 @@ void PairHybrid::compute(int eflag, int vflag)
       // outerflag is set and sub-style has a compute_outer() method
 
       if (styles[m]->compute_flag == 0) continue;
+      timer->detail_start(itimer[m]);
       if (outerflag && styles[m]->respa_enable)
         styles[m]->compute_outer(eflag,vflag_substyle);
       else styles[m]->compute(eflag,vflag_substyle);
+      timer->detail_stop(itimer[m]);
     }
 
     restore_special(saved_special);
@@ -488,6 +492,19 @@ void PairHybrid::init_style()
 
   for (istyle = 0; istyle < nstyles; istyle++) styles[istyle]->init_style();
 
+  // register per-style timers, Mth instance of a style is named style:M
+
+  delete [] itimer;
+  itimer = new int[nstyles];
+  for (istyle = 0; istyle < nstyles; istyle++) {
+    char *name = new char[strlen(keywords[istyle]) + 16];
+    if (multiple[istyle])
+      sprintf(name,"%s:%d",keywords[istyle],multiple[istyle]);
+    else strcpy(name,keywords[istyle]);
+    itimer[istyle] = timer->add_detail("pair",name,keywords[istyle]);
+    delete [] name;
+  }
+
   // create skip lists inside each pair neigh request
   // any kind of list can have its skip flag set in this loop
 
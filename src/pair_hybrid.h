@@ -60,6 +60,7 @@ class PairHybrid : public Pair {
   Pair **styles;                // list of Pair style classes
   char **keywords;              // style name of each Pair style
   int *multiple;                // 0 if style used once, else Mth instance
+  int *itimer;                  // index of per-style timer in Timer
 
   int outerflag;                // toggle compute() when invoked by outer()
   int respaflag;                // 1 if different substyles are assigned to
@@ -15,6 +15,7 @@
 #include <string.h>
 #include "rcb.h"
 #include "irregular.h"
+#include "comm.h"
 #include "memory.h"
 #include "error.h"
 
@@ -64,6 +65,7 @@ RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
   MPI_Op_create(median_merge,1,&med_op);
 
   reuse = 0;
+  compact = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -105,7 +107,7 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
                   double *bboxlo, double *bboxhi)
 {
   int i,j,k;
-  int keep,outgoing,incoming,incoming2;
+  int keep,outgoing,incoming;
   int dim,markactive;
   int indexlo,indexhi;
   int first_iteration,breakflag;
@@ -114,7 +116,6 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
   double valuemin,valuemax,valuehalf;
   double tolerance;
   MPI_Comm comm,comm_half;
-  MPI_Request request,request2;
   Median med,medme;
 
   // create list of my Dots
@@ -174,7 +175,13 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
   // proclower,procupper = lower,upper procs in partition
   // procmid = 1st proc in upper half of partition
 
-  int procpartner,procpartner2;
+  // readfrom = procs in other half that send dots to me
+  // incomings = # of dots each of them sends
+
+  int procpartner;
+  int *readfrom = new int[nprocs];
+  int *incomings = new int[nprocs];
+  MPI_Request *requests = new MPI_Request[nprocs];
 
   int procmid;
   int proclower = 0;
@@ -183,26 +190,32 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
   while (proclower != procupper) {
 
     // if odd # of procs, lower partition gets extra one
+    // Comm may instead put the cut between nodes, so halves can be unequal
+    // local MPI communicator is named comm, so access Comm via lmp
 
-    procmid = proclower + (procupper - proclower) / 2 + 1;
+    procmid = lmp->comm->rcb_procmid(proclower,procupper);
 
     // determine communication partner(s)
+    // proc with index I in its half sends to index I % Nother in other half
     // readnumber = # of proc partners to read from
 
-    if (me < procmid)
-      procpartner = me + (procmid - proclower);
-    else
-      procpartner = me - (procmid - proclower);
-
-    int readnumber = 1;
-    if (procpartner > procupper) {
-      readnumber = 0;
-      procpartner--;
-    }
-    if (me == procupper && procpartner != procmid - 1) {
-      readnumber = 2;
-      procpartner2 = procpartner + 1;
+    int myindex,nmine,nother,otherlower;
+    if (me < procmid) {
+      myindex = me - proclower;
+      nmine = procmid - proclower;
+      nother = procupper + 1 - procmid;
+      otherlower = procmid;
+    } else {
+      myindex = me - procmid;
+      nmine = procupper + 1 - procmid;
+      nother = procmid - proclower;
+      otherlower = proclower;
     }
+    procpartner = otherlower + myindex % nother;
+
+    int readnumber = 0;
+    for (i = myindex; i < nother; i += nmine)
+      readfrom[readnumber++] = otherlower + i;
 
     // wttot = summed weight of entire partition
     // search tolerance = largest single weight (plus epsilon)
@@ -229,14 +242,40 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
     targetlo = wttot * (procmid - proclower) / (procupper + 1 - proclower);
     targethi = wttot - targetlo;
 
+    // span = range of partition to choose cut dim and search for cut in
+    // if compact, clip it to bounding box of dots in partition,
+    //   so empty regions do not produce thin slabs of dots
+
+    double spanlo[3],spanhi[3];
+    for (j = 0; j < 3; j++) {
+      spanlo[j] = lo[j];
+      spanhi[j] = hi[j];
+    }
+
+    if (compact) {
+      double range[6],rangeall[6];
+      for (j = 0; j < 6; j++) range[j] = -MYHUGE;
+      for (i = 0; i < ndot; i++)
+        for (j = 0; j < 3; j++) {
+          if (-dots[i].x[j] > range[j]) range[j] = -dots[i].x[j];
+          if (dots[i].x[j] > range[3+j]) range[3+j] = dots[i].x[j];
+        }
+      MPI_Allreduce(range,rangeall,6,MPI_DOUBLE,MPI_MAX,comm);
+      for (j = 0; j < 3; j++) {
+        if (rangeall[3+j] <= -rangeall[j]) continue;
+        if (-rangeall[j] > spanlo[j]) spanlo[j] = -rangeall[j];
+        if (rangeall[3+j] < spanhi[j]) spanhi[j] = rangeall[3+j];
+      }
+    }
+
     // dim = dimension to bisect on
     // do not allow choice of z dimension for 2d system
 
     dim = 0;
-    if (hi[1]-lo[1] > hi[0]-lo[0]) dim = 1;
+    if (spanhi[1]-spanlo[1] > spanhi[0]-spanlo[0]) dim = 1;
     if (dimension == 3) {
-      if (dim == 0 && hi[2]-lo[2] > hi[0]-lo[0]) dim = 2;
-      if (dim == 1 && hi[2]-lo[2] > hi[1]-lo[1]) dim = 2;
+      if (dim == 0 && spanhi[2]-spanlo[2] > spanhi[0]-spanlo[0]) dim = 2;
+      if (dim == 1 && spanhi[2]-spanlo[2] > spanhi[1]-spanlo[1]) dim = 2;
     }
 
     // create active list and mark array for dots
@@ -267,8 +306,8 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
     // indexlo,indexhi = indices of dot closest to median
 
     wtlo = wthi = 0.0;
-    valuemin = lo[dim];
-    valuemax = hi[dim];
+    valuemin = spanlo[dim];
+    valuemax = spanhi[dim];
     first_iteration = 1;
     indexlo = indexhi = 0;
 
@@ -458,7 +497,7 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
     // outgoing = number of dots to ship to partner
     // nkeep = number of dots that have never migrated
 
-    markactive = (me < procpartner);
+    markactive = (me < procmid);
     for (i = 0, keep = 0, outgoing = 0; i < ndot; i++)
       if (dotmark[i] == markactive) outgoing++;
       else if (i < nkeep) keep++;
@@ -468,12 +507,9 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
 
     MPI_Send(&outgoing,1,MPI_INT,procpartner,0,world);
     incoming = 0;
-    if (readnumber) {
-      MPI_Recv(&incoming,1,MPI_INT,procpartner,0,world,MPI_STATUS_IGNORE);
-      if (readnumber == 2) {
-	MPI_Recv(&incoming2,1,MPI_INT,procpartner2,0,world,MPI_STATUS_IGNORE);
-	incoming += incoming2;
-      }
+    for (k = 0; k < readnumber; k++) {
+      MPI_Recv(&incomings[k],1,MPI_INT,readfrom[k],0,world,MPI_STATUS_IGNORE);
+      incoming += incomings[k];
     }
 
     // check if need to alloc more space
@@ -511,22 +547,16 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
 
     // post receives for dots
 
-    if (readnumber > 0) {
-      MPI_Irecv(&dots[keep],incoming*sizeof(Dot),MPI_CHAR,
-                procpartner,1,world,&request);
-      if (readnumber == 2) {
-	keep += incoming - incoming2;
-	MPI_Irecv(&dots[keep],incoming2*sizeof(Dot),MPI_CHAR,
-                  procpartner2,1,world,&request2);
-      }
+    for (k = 0; k < readnumber; k++) {
+      MPI_Irecv(&dots[keep],incomings[k]*sizeof(Dot),MPI_CHAR,
+                readfrom[k],1,world,&requests[k]);
+      keep += incomings[k];
     }
 
     // handshake before sending dots to insure recvs have been posted
 
-    if (readnumber > 0) {
-      MPI_Send(NULL,0,MPI_INT,procpartner,0,world);
-      if (readnumber == 2) MPI_Send(NULL,0,MPI_INT,procpartner2,0,world);
-    }
+    for (k = 0; k < readnumber; k++)
+      MPI_Send(NULL,0,MPI_INT,readfrom[k],0,world);
     MPI_Recv(NULL,0,MPI_INT,procpartner,0,world,MPI_STATUS_IGNORE);
 
     // send dots to partner
@@ -535,10 +565,8 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
 
     // wait until all dots are received
 
-    if (readnumber > 0) {
-      MPI_Wait(&request,MPI_STATUS_IGNORE);
-      if (readnumber == 2) MPI_Wait(&request2,MPI_STATUS_IGNORE);
-    }
+    for (k = 0; k < readnumber; k++)
+      MPI_Wait(&requests[k],MPI_STATUS_IGNORE);
 
     ndot = ndotnew;
 
@@ -561,6 +589,9 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
   // clean up
 
   MPI_Comm_free(&comm);
+  delete [] readfrom;
+  delete [] incomings;
+  delete [] requests;
 
   // set public variables with results of rebalance
 
@@ -683,7 +714,8 @@ void RCB::invert(int sortflag)
   // perform inversion via irregular comm
   // nrecv = # of my dots to send to other procs
 
-  int nrecv = irregular->create_data(nsend,proclist,sortflag);
+  int nrecv = irregular->create_data(nsend,proclist,sortflag,
+                                        sizeof(Invert));
   Invert *rinvert =
     (Invert *) memory->smalloc(nrecv*sizeof(Invert),"RCB:rinvert");
   irregular->exchange_data((char *) sinvert,sizeof(Invert),(char *) rinvert);
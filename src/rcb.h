@@ -34,6 +34,11 @@ class RCB : protected Pointers {
   double cut;                 // single cut (in Tree) owned by this proc
   int cutdim;                 // dimension (0,1,2) of the cut
 
+  // set by caller before compute()
+
+  int compact;                // 1 = choose cut dim by extent of dots
+                              // 0 = by extent of partition (default)
+
   // set by invert()
 
   int *sendproc;              // proc to send each of my noriginal dots to
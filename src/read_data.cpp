@@ -46,6 +46,10 @@
 #include "error.h"
 #include "memory.h"
 
+#ifdef LMP_COMPRESS
+#include "gz_frame.h"
+#endif
+
 using namespace LAMMPS_NS;
 
 #define MAXLINE 256
@@ -55,9 +59,17 @@ using namespace LAMMPS_NS;
 #define MAXBODY 32         // max # of lines in one body
 
                            // customize for new sections
-#define NSECTIONS 25       // change when add to header::section_keywords
+#define NSECTIONS 31       // change when add to header::section_keywords
+
+#define BINARY_MAGIC 0x4C4D5044   // "LMPD", same as write_data.cpp
 
 enum{NONE,APPEND,VALUE,MERGE};
+enum{BINARY_PACKED,BINARY_INT64};   // same as write_data.cpp
+enum{BONDS,ANGLES,DIHEDRALS,IMPROPERS};
+
+// prototype for non-class function
+
+static int compare_records(const void *, const void *);
 
 // pair style suffixes to ignore
 // when matching Pair Coeffs comment to currently-defined pair style
@@ -72,6 +84,7 @@ const char *suffixes[] = {"/cuda","/gpu","/opt","/omp","/kk",
 ReadData::ReadData(LAMMPS *lmp) : Pointers(lmp)
 {
   MPI_Comm_rank(world,&me);
+  MPI_Comm_size(world,&nprocs);
   line = new char[MAXLINE];
   copy = new char[MAXLINE];
   keyword = new char[MAXLINE];
@@ -119,11 +132,13 @@ ReadData::~ReadData()
 void ReadData::command(int narg, char **arg)
 {
   if (narg < 1) error->all(FLERR,"Illegal read_data command");
+  file = arg[0];
 
   // optional args
 
   addflag = NONE;
   coeffflag = 1;
+  scatterflag = 1;
   id_offset = 0;
   offsetflag = shiftflag = 0;
   toffset = boffset = aoffset = doffset = ioffset = 0;
@@ -176,6 +191,12 @@ void ReadData::command(int narg, char **arg)
     } else if (strcmp(arg[iarg],"nocoeff") == 0) {
       coeffflag = 0;
       iarg ++;
+    } else if (strcmp(arg[iarg],"scatter") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal read_data command");
+      if (strcmp(arg[iarg+1],"yes") == 0) scatterflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) scatterflag = 0;
+      else error->all(FLERR,"Illegal read_data command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"extra/atom/types") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal read_data command");
       extra_atom_types = force->inumeric(FLERR,arg[iarg+1]);
@@ -454,38 +475,76 @@ void ReadData::command(int narg, char **arg)
           if (me == 0 && !style_match(style,atom->atom_style))
             error->warning(FLERR,"Atom style in data file differs "
                            "from currently defined atom style");
-          atoms();
+          atoms(0);
         } else skip_lines(natoms);
       } else if (strcmp(keyword,"Velocities") == 0) {
         if (atomflag == 0)
           error->all(FLERR,"Must read Atoms before Velocities");
-        if (firstpass) velocities();
+        if (firstpass) velocities(0);
         else skip_lines(natoms);
 
+      } else if (strcmp(keyword,"Binary Atoms") == 0) {
+        atomflag = 1;
+        if (firstpass) {
+          if (me == 0 && !style_match(style,atom->atom_style))
+            error->warning(FLERR,"Atom style in data file differs "
+                           "from currently defined atom style");
+          atoms(1);
+        } else binary_skip(BINARY_PACKED,natoms);
+      } else if (strcmp(keyword,"Binary Velocities") == 0) {
+        if (atomflag == 0)
+          error->all(FLERR,"Must read Atoms before Velocities");
+        if (firstpass) velocities(1);
+        else binary_skip(BINARY_PACKED,natoms);
+
       } else if (strcmp(keyword,"Bonds") == 0) {
         topoflag = bondflag = 1;
         if (nbonds == 0)
           error->all(FLERR,"Invalid data file section: Bonds");
         if (atomflag == 0) error->all(FLERR,"Must read Atoms before Bonds");
-        bonds(firstpass);
+        bonds(firstpass,0);
+      } else if (strcmp(keyword,"Binary Bonds") == 0) {
+        topoflag = bondflag = 1;
+        if (nbonds == 0)
+          error->all(FLERR,"Invalid data file section: Binary Bonds");
+        if (atomflag == 0) error->all(FLERR,"Must read Atoms before Bonds");
+        bonds(firstpass,1);
       } else if (strcmp(keyword,"Angles") == 0) {
         topoflag = angleflag = 1;
         if (nangles == 0)
           error->all(FLERR,"Invalid data file section: Angles");
         if (atomflag == 0) error->all(FLERR,"Must read Atoms before Angles");
-        angles(firstpass);
+        angles(firstpass,0);
+      } else if (strcmp(keyword,"Binary Angles") == 0) {
+        topoflag = angleflag = 1;
+        if (nangles == 0)
+          error->all(FLERR,"Invalid data file section: Binary Angles");
+        if (atomflag == 0) error->all(FLERR,"Must read Atoms before Angles");
+        angles(firstpass,1);
       } else if (strcmp(keyword,"Dihedrals") == 0) {
         topoflag = dihedralflag = 1;
         if (ndihedrals == 0)
           error->all(FLERR,"Invalid data file section: Dihedrals");
         if (atomflag == 0) error->all(FLERR,"Must read Atoms before Dihedrals");
-        dihedrals(firstpass);
+        dihedrals(firstpass,0);
+      } else if (strcmp(keyword,"Binary Dihedrals") == 0) {
+        topoflag = dihedralflag = 1;
+        if (ndihedrals == 0)
+          error->all(FLERR,"Invalid data file section: Binary Dihedrals");
+        if (atomflag == 0) error->all(FLERR,"Must read Atoms before Dihedrals");
+        dihedrals(firstpass,1);
       } else if (strcmp(keyword,"Impropers") == 0) {
         topoflag = improperflag = 1;
         if (nimpropers == 0)
           error->all(FLERR,"Invalid data file section: Impropers");
         if (atomflag == 0) error->all(FLERR,"Must read Atoms before Impropers");
-        impropers(firstpass);
+        impropers(firstpass,0);
+      } else if (strcmp(keyword,"Binary Impropers") == 0) {
+        topoflag = improperflag = 1;
+        if (nimpropers == 0)
+          error->all(FLERR,"Invalid data file section: Binary Impropers");
+        if (atomflag == 0) error->all(FLERR,"Must read Atoms before Impropers");
+        impropers(firstpass,1);
 
       } else if (strcmp(keyword,"Ellipsoids") == 0) {
         ellipsoidflag = 1;
@@ -669,7 +728,7 @@ void ReadData::command(int narg, char **arg)
     // close file
 
     if (me == 0) {
-      if (compressed) pclose(fp);
+      if (compressed == 1) pclose(fp);
       else fclose(fp);
       fp = NULL;
     }
@@ -875,6 +934,8 @@ void ReadData::header(int firstpass)
   const char *section_keywords[NSECTIONS] =
     {"Atoms","Velocities","Ellipsoids","Lines","Triangles","Bodies",
      "Bonds","Angles","Dihedrals","Impropers",
+     "Binary Atoms","Binary Velocities","Binary Bonds","Binary Angles",
+     "Binary Dihedrals","Binary Impropers",
      "Masses","Pair Coeffs","PairIJ Coeffs","Bond Coeffs","Angle Coeffs",
      "Dihedral Coeffs","Improper Coeffs",
      "BondBond Coeffs","BondAngle Coeffs","MiddleBondTorsion Coeffs",
@@ -1072,9 +1133,10 @@ void ReadData::header(int firstpass)
 
 /* ----------------------------------------------------------------------
    read all atoms
+   binflag = 1 for a Binary Atoms section
 ------------------------------------------------------------------------- */
 
-void ReadData::atoms()
+void ReadData::atoms(int binflag)
 {
   int nchunk,eof;
 
@@ -1084,13 +1146,42 @@ void ReadData::atoms()
   }
 
   bigint nread = 0;
+  int nlocal_previous = atom->nlocal;
+
+  // on one proc, or if requested, every proc parses every chunk
+  //   and keeps the atoms in its sub-domain
+  // else proc 0 sends each chunk to a single proc in round-robin fashion
+  //   which keeps all its atoms, then all atoms migrate to their owners
+
+  if (binflag) {
+    if (atoms_binary()) migrate(nlocal_previous);
+
+  } else if (nprocs == 1 || !scatterflag) {
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      atom->data_atoms(nchunk,buffer,id_offset,toffset,shiftflag,shift,0);
+      nread += nchunk;
+    }
 
-  while (nread < natoms) {
-    nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_atoms(nchunk,buffer,id_offset,toffset,shiftflag,shift);
-    nread += nchunk;
+  } else {
+    int iproc;
+    bigint ichunk = 0;
+
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      iproc = ichunk % nprocs;
+      send_lines(nchunk,iproc);
+
+      if (me == iproc)
+        atom->data_atoms(nchunk,buffer,id_offset,toffset,shiftflag,shift,1);
+
+      nread += nchunk;
+      ichunk++;
+    }
+
+    migrate(nlocal_previous);
   }
 
   // check that all atoms were assigned correctly
@@ -1120,12 +1211,391 @@ void ReadData::atoms()
   }
 }
 
+/* ----------------------------------------------------------------------
+   read all atoms of a Binary Atoms section
+   if file is compressed, proc 0 reads and bcasts each chunk
+     and every proc keeps the atoms in its sub-domain
+   else each proc reads its own contiguous block of records from the file
+     and keeps all of them, caller then migrates them to their owners
+   return 1 if atoms must be migrated, else 0
+------------------------------------------------------------------------- */
+
+int ReadData::atoms_binary()
+{
+  int nchunk;
+
+  int ncol = atom->avec->size_data_atom + 3;
+  binary_header(BINARY_PACKED,natoms,ncol);
+
+  double *values;
+  memory->create(values,CHUNK*ncol,"read_data:values");
+
+  bigint nread = 0;
+
+  // compressed is only set on proc 0 by open()
+
+  MPI_Bcast(&compressed,1,MPI_INT,0,world);
+
+  if (compressed) {
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      if (read_binary(nchunk,ncol,values))
+        error->all(FLERR,"Unexpected end of data file");
+      atom->data_atoms(nchunk,values,id_offset,toffset,shiftflag,shift,0);
+      nread += nchunk;
+    }
+    memory->destroy(values);
+    return 0;
+  }
+
+  // offset = file position of 1st record
+  // proc 0 moves its file pointer past the section for next keyword
+
+  bigint offset;
+  if (me == 0) offset = ftell(fp);
+  MPI_Bcast(&offset,1,MPI_LMP_BIGINT,0,world);
+
+  bigint rowbytes = (bigint) ncol * sizeof(double);
+  if (me == 0) fseek(fp,offset + natoms*rowbytes,SEEK_SET);
+
+  bigint first = natoms*me/nprocs;
+  bigint last = natoms*(me+1)/nprocs;
+
+  FILE *fpbin = fopen(file,"rb");
+  if (fpbin == NULL) {
+    char str[128];
+    sprintf(str,"Cannot open file %s",file);
+    error->one(FLERR,str);
+  }
+  fseek(fpbin,offset + first*rowbytes,SEEK_SET);
+
+  int allflag = (nprocs > 1) ? 1 : 0;
+
+  nread = first;
+  while (nread < last) {
+    nchunk = MIN(last-nread,CHUNK);
+    if (fread(values,sizeof(double),(size_t) nchunk*ncol,fpbin) !=
+        (size_t) nchunk*ncol)
+      error->one(FLERR,"Unexpected end of data file");
+    atom->data_atoms(nchunk,values,id_offset,toffset,shiftflag,shift,allflag);
+    nread += nchunk;
+  }
+
+  fclose(fpbin);
+  memory->destroy(values);
+  return allflag;
+}
+
+/* ----------------------------------------------------------------------
+   move atoms not in sub-domain of proc that read them to owning procs
+   nfirst = index of 1st atom read from this file
+   only atoms read from this file move, atoms that existed before stay
+     on their proc at the same index, as when each proc keeps its own,
+     so later sections can find new atoms at index nfirst and above
+   first do map_init() since irregular->migrate_atoms() will do map_clear()
+   special counts of new atoms are not set until special bonds are built,
+     zero them so pack_exchange() does not pack uninitialized lists
+------------------------------------------------------------------------- */
+
+void ReadData::migrate(int nfirst)
+{
+  int nlocal = atom->nlocal;
+
+  if (atom->molecular == 1) {
+    int **nspecial = atom->nspecial;
+    for (int i = nfirst; i < nlocal; i++)
+      nspecial[i][0] = nspecial[i][1] = nspecial[i][2] = 0;
+  }
+
+  if (atom->map_style) {
+    atom->map_init();
+    atom->map_set();
+  }
+  if (domain->triclinic) domain->x2lamda(nlocal);
+
+  double *sublo,*subhi;
+  if (domain->triclinic == 0) {
+    sublo = domain->sublo;
+    subhi = domain->subhi;
+  } else {
+    sublo = domain->sublo_lamda;
+    subhi = domain->subhi_lamda;
+  }
+
+  int igx,igy,igz;
+  double **x = atom->x;
+  int *procassign;
+  memory->create(procassign,nlocal,"read_data:procassign");
+  comm->coord2proc_setup();
+
+  for (int i = 0; i < nlocal; i++) {
+    if (i >= nfirst &&
+        (x[i][0] < sublo[0] || x[i][0] >= subhi[0] ||
+         x[i][1] < sublo[1] || x[i][1] >= subhi[1] ||
+         x[i][2] < sublo[2] || x[i][2] >= subhi[2]))
+      procassign[i] = comm->coord2proc(x[i],igx,igy,igz);
+    else procassign[i] = me;
+  }
+
+  Irregular *irregular = new Irregular(lmp);
+  irregular->migrate_atoms(1,1,procassign);
+  delete irregular;
+  memory->destroy(procassign);
+  if (domain->triclinic) domain->lamda2x(atom->nlocal);
+}
+
+/* ----------------------------------------------------------------------
+   proc 0 reads next N lines of a section into buffer
+   if iproc is not 0, send them to iproc, which receives them into buffer
+------------------------------------------------------------------------- */
+
+void ReadData::send_lines(int n, int iproc)
+{
+  if (me == 0) {
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+      if (!fgets(&buffer[m],MAXLINE,fp)) {
+        m = 0;
+        break;
+      }
+      m += strlen(&buffer[m]);
+    }
+    if (m == 0) error->one(FLERR,"Unexpected end of data file");
+    if (buffer[m-1] != '\n') strcpy(&buffer[m++],"\n");
+    m++;
+    if (iproc) MPI_Send(buffer,m,MPI_CHAR,iproc,0,world);
+  } else if (me == iproc)
+    MPI_Recv(buffer,CHUNK*MAXLINE,MPI_CHAR,0,0,world,MPI_STATUS_IGNORE);
+}
+
+/* ----------------------------------------------------------------------
+   read one chunk of a section for each proc, from N remaining lines
+   proc 0 reads each chunk and sends it to its proc, proc I gets Ith chunk
+   binflag = 1 for a Binary section, whose records are sent as is
+   else each proc converts its lines to records of ncol values,
+     doubles with ubuf atom ID if velflag is set, else int64
+   return # of records stored in values on this proc
+------------------------------------------------------------------------- */
+
+int ReadData::scatter_records(bigint n, int ncol, int binflag, int velflag,
+                              void *values)
+{
+  int nchunk;
+  int nmine = 0;
+  int nbytes = ncol * sizeof(double);
+
+  char *chunkbuf = NULL;
+  if (binflag && me == 0)
+    memory->create(chunkbuf,CHUNK*nbytes,"read_data:chunkbuf");
+
+  for (int iproc = 0; iproc < nprocs && n > 0; iproc++) {
+    nchunk = MIN(n,CHUNK);
+
+    if (binflag) {
+      if (me == 0) {
+        char *ptr = iproc ? chunkbuf : (char *) values;
+        if (fread(ptr,nbytes,nchunk,fp) != (size_t) nchunk)
+          error->one(FLERR,"Unexpected end of data file");
+        if (iproc) MPI_Send(ptr,nchunk*nbytes,MPI_CHAR,iproc,0,world);
+      } else if (me == iproc)
+        MPI_Recv(values,nchunk*nbytes,MPI_CHAR,0,0,world,MPI_STATUS_IGNORE);
+
+    } else {
+      send_lines(nchunk,iproc);
+      if (me == iproc) {
+        if (velflag) parse_vels(nchunk,ncol,(double *) values);
+        else parse_topology(nchunk,ncol,(int64_t *) values);
+      }
+    }
+
+    if (me == iproc) nmine = nchunk;
+    n -= nchunk;
+  }
+
+  memory->destroy(chunkbuf);
+  return nmine;
+}
+
+/* ----------------------------------------------------------------------
+   convert N lines of Velocities section in buffer to records of ncol values
+   same layout as Binary Velocities section, atom ID stored as ubuf
+------------------------------------------------------------------------- */
+
+void ReadData::parse_vels(int n, int ncol, double *values)
+{
+  int j;
+  char *next,*word;
+
+  char *buf = buffer;
+  for (int i = 0; i < n; i++) {
+    next = strchr(buf,'\n');
+    *next = '\0';
+    word = strtok(buf," \t\n\r\f");
+    for (j = 0; j < ncol; j++) {
+      if (word == NULL)
+        error->one(FLERR,"Incorrect velocity format in data file");
+      if (j == 0) values[i*ncol] = ubuf(ATOTAGINT(word)).d;
+      else values[i*ncol+j] = atof(word);
+      word = strtok(NULL," \t\n\r\f");
+    }
+    if (word) error->one(FLERR,"Incorrect velocity format in data file");
+    buf = next + 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   convert N lines of a topology section in buffer to records of ncol int64
+   same layout as Binary Bonds, Angles, Dihedrals, Impropers sections
+------------------------------------------------------------------------- */
+
+void ReadData::parse_topology(int n, int ncol, int64_t *values)
+{
+  char *next,*word;
+
+  char *buf = buffer;
+  for (int i = 0; i < n; i++) {
+    next = strchr(buf,'\n');
+    *next = '\0';
+    word = strtok(buf," \t\n\r\f");
+    for (int j = 0; j < ncol; j++) {
+      if (word == NULL)
+        error->one(FLERR,"Incorrect topology format in data file");
+      values[i*ncol+j] = ATOBIGINT(word);
+      word = strtok(NULL," \t\n\r\f");
+    }
+    buf = next + 1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   send N records of ncol values to the procs that own their atoms
+   nkey atoms of each record need it, their IDs are stored in keys
+   each record is sent once to each distinct proc owning one of them
+   return # of records received, allocated and stored in recv
+------------------------------------------------------------------------- */
+
+int ReadData::send_to_owners(Irregular *irregular, int n, int ncol,
+                             char *values, int nkey, tagint *keys,
+                             char *&recv)
+{
+  int i,j,k,proc;
+
+  int nbytes = ncol * sizeof(double);
+
+  int *owners,*proclist;
+  char *sendbuf;
+  memory->create(owners,n*nkey,"read_data:owners");
+  memory->create(proclist,n*nkey,"read_data:proclist");
+  memory->create(sendbuf,n*nkey*nbytes,"read_data:sendbuf");
+
+  irregular->find_owners(n*nkey,keys,owners);
+
+  int nsend = 0;
+  for (i = 0; i < n; i++)
+    for (j = 0; j < nkey; j++) {
+      proc = owners[i*nkey+j];
+      if (proc < 0) continue;
+      for (k = 0; k < j; k++)
+        if (owners[i*nkey+k] == proc) break;
+      if (k < j) continue;
+      proclist[nsend] = proc;
+      memcpy(&sendbuf[nsend*nbytes],&values[i*nbytes],nbytes);
+      nsend++;
+    }
+
+  int nrecv = irregular->create_data(nsend,proclist,0,nbytes);
+  memory->create(recv,nrecv*nbytes,"read_data:recv");
+  irregular->exchange_data(sendbuf,nbytes,recv);
+  irregular->destroy_data();
+
+  memory->destroy(owners);
+  memory->destroy(proclist);
+  memory->destroy(sendbuf);
+  return nrecv;
+}
+
+/* ----------------------------------------------------------------------
+   scan or read all records of a topology section with more than one proc
+   which = BONDS, ANGLES, DIHEDRALS, IMPROPERS, ncol = # of values per record
+   each round, procs parse one chunk each and send the records
+     to the procs that own the atoms which store them
+   index of each record is replaced by its position in the section,
+     so received records are stored in the order of the data file
+------------------------------------------------------------------------- */
+
+void ReadData::scatter_topology(int which, bigint ntotal, int ncol,
+                                int binflag, int *count)
+{
+  int i,j,n,nrecv;
+  tagint id;
+  int64_t *record;
+  char *recv;
+
+  // with newton_bond, only 1st atom of a bond stores it
+  //   and only 2nd atom of an angle, dihedral, improper
+  // else all its atoms store it
+
+  int nkey = force->newton_bond ? 1 : ncol-2;
+  int first = force->newton_bond ? ((which == BONDS) ? 2 : 3) : 2;
+
+  const char *sections[] = {"Bonds","Angles","Dihedrals","Impropers"};
+  char str[128];
+  sprintf(str,"Invalid atom ID in %s section of data file",sections[which]);
+
+  int64_t *values;
+  tagint *keys;
+  memory->create(values,CHUNK*ncol,"read_data:values");
+  memory->create(keys,CHUNK*nkey,"read_data:keys");
+
+  Irregular *irregular = new Irregular(lmp);
+  irregular->atom_owners();
+
+  bigint nread = 0;
+
+  while (nread < ntotal) {
+    n = scatter_records(ntotal-nread,ncol,binflag,0,values);
+
+    bigint offset = nread + (bigint) me*CHUNK;
+    for (i = 0; i < n; i++) {
+      record = &values[i*ncol];
+      record[0] = offset + i;
+      for (j = 2; j < ncol; j++) {
+        id = (tagint) record[j] + id_offset;
+        if (id <= 0 || id > atom->map_tag_max) error->one(FLERR,str);
+      }
+      for (j = 0; j < nkey; j++)
+        keys[i*nkey+j] = (tagint) record[first+j] + id_offset;
+    }
+
+    nrecv = send_to_owners(irregular,n,ncol,(char *) values,nkey,keys,recv);
+    qsort(recv,nrecv,ncol*sizeof(int64_t),compare_records);
+
+    record = (int64_t *) recv;
+    if (which == BONDS)
+      atom->data_bonds(nrecv,record,count,id_offset,boffset);
+    else if (which == ANGLES)
+      atom->data_angles(nrecv,record,count,id_offset,aoffset);
+    else if (which == DIHEDRALS)
+      atom->data_dihedrals(nrecv,record,count,id_offset,doffset);
+    else if (which == IMPROPERS)
+      atom->data_impropers(nrecv,record,count,id_offset,ioffset);
+
+    memory->destroy(recv);
+    nread += MIN(ntotal-nread,(bigint) nprocs*CHUNK);
+  }
+
+  delete irregular;
+  memory->destroy(values);
+  memory->destroy(keys);
+}
+
 /* ----------------------------------------------------------------------
    read all velocities
+   binflag = 1 for a Binary Velocities section
    to find atoms, must build atom map if not a molecular system
 ------------------------------------------------------------------------- */
 
-void ReadData::velocities()
+void ReadData::velocities(int binflag)
 {
   int nchunk,eof;
 
@@ -1134,6 +1604,13 @@ void ReadData::velocities()
     if (logfile) fprintf(logfile,"  reading velocities ...\n");
   }
 
+  int ncol = atom->avec->size_data_vel;
+  double *values = NULL;
+  if (binflag) {
+    binary_header(BINARY_PACKED,natoms,ncol);
+    memory->create(values,CHUNK*ncol,"read_data:values");
+  }
+
   int mapflag = 0;
   if (atom->map_style == 0) {
     mapflag = 1;
@@ -1143,14 +1620,51 @@ void ReadData::velocities()
 
   bigint nread = 0;
 
-  while (nread < natoms) {
-    nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_vels(nchunk,buffer,id_offset);
-    nread += nchunk;
+  // with more than one proc, procs parse one chunk each
+  //   and send velocities to the procs that own their atoms
+  // else, or if not requested, every proc parses every chunk
+
+  if (nprocs > 1 && scatterflag) {
+    int n,nrecv;
+    tagint *keys;
+    char *recv;
+    if (!binflag) memory->create(values,CHUNK*ncol,"read_data:values");
+    memory->create(keys,CHUNK,"read_data:keys");
+
+    Irregular *irregular = new Irregular(lmp);
+    irregular->atom_owners();
+
+    while (nread < natoms) {
+      n = scatter_records(natoms-nread,ncol,binflag,1,values);
+      for (int i = 0; i < n; i++) {
+        keys[i] = (tagint) ubuf(values[i*ncol]).i + id_offset;
+        if (keys[i] <= 0 || keys[i] > atom->map_tag_max)
+          error->one(FLERR,"Invalid atom ID in Velocities section "
+                     "of data file");
+      }
+      nrecv = send_to_owners(irregular,n,ncol,(char *) values,1,keys,recv);
+      atom->data_vels(nrecv,(double *) recv,id_offset);
+      memory->destroy(recv);
+      nread += MIN(natoms-nread,(bigint) nprocs*CHUNK);
+    }
+
+    delete irregular;
+    memory->destroy(keys);
+
+  } else {
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      if (binflag) eof = read_binary(nchunk,ncol,values);
+      else eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      if (binflag) atom->data_vels(nchunk,values,id_offset);
+      else atom->data_vels(nchunk,buffer,id_offset);
+      nread += nchunk;
+    }
   }
 
+  memory->destroy(values);
+
   if (mapflag) {
     atom->map_delete();
     atom->map_style = 0;
@@ -1164,9 +1678,10 @@ void ReadData::velocities()
 
 /* ----------------------------------------------------------------------
    scan or read all bonds
+   binflag = 1 for a Binary Bonds section
 ------------------------------------------------------------------------- */
 
-void ReadData::bonds(int firstpass)
+void ReadData::bonds(int firstpass, int binflag)
 {
   int nchunk,eof;
 
@@ -1191,14 +1706,32 @@ void ReadData::bonds(int firstpass)
 
   // read and process bonds
 
-  bigint nread = 0;
+  // with more than one proc, procs parse one chunk each
+  //   and send bonds to the procs that own their atoms
+  // else, or if not requested, every proc parses every chunk
 
-  while (nread < nbonds) {
-    nchunk = MIN(nbonds-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_bonds(nchunk,buffer,count,id_offset,boffset);
-    nread += nchunk;
+  if (binflag) binary_header(BINARY_INT64,nbonds,4);
+
+  if (nprocs > 1 && scatterflag)
+    scatter_topology(BONDS,nbonds,4,binflag,count);
+
+  else {
+    int64_t *values = NULL;
+    if (binflag) memory->create(values,CHUNK*4,"read_data:values");
+
+    bigint nread = 0;
+
+    while (nread < nbonds) {
+      nchunk = MIN(nbonds-nread,CHUNK);
+      if (binflag) eof = read_binary(nchunk,4,values);
+      else eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      if (binflag) atom->data_bonds(nchunk,values,count,id_offset,boffset);
+      else atom->data_bonds(nchunk,buffer,count,id_offset,boffset);
+      nread += nchunk;
+    }
+
+    memory->destroy(values);
   }
 
   // if firstpass: tally max bond/atom and return
@@ -1247,9 +1780,10 @@ void ReadData::bonds(int firstpass)
 
 /* ----------------------------------------------------------------------
    scan or read all angles
+   binflag = 1 for a Binary Angles section
 ------------------------------------------------------------------------- */
 
-void ReadData::angles(int firstpass)
+void ReadData::angles(int firstpass, int binflag)
 {
   int nchunk,eof;
 
@@ -1274,14 +1808,32 @@ void ReadData::angles(int firstpass)
 
   // read and process angles
 
-  bigint nread = 0;
+  // with more than one proc, procs parse one chunk each
+  //   and send angles to the procs that own their atoms
+  // else, or if not requested, every proc parses every chunk
 
-  while (nread < nangles) {
-    nchunk = MIN(nangles-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_angles(nchunk,buffer,count,id_offset,aoffset);
-    nread += nchunk;
+  if (binflag) binary_header(BINARY_INT64,nangles,5);
+
+  if (nprocs > 1 && scatterflag)
+    scatter_topology(ANGLES,nangles,5,binflag,count);
+
+  else {
+    int64_t *values = NULL;
+    if (binflag) memory->create(values,CHUNK*5,"read_data:values");
+
+    bigint nread = 0;
+
+    while (nread < nangles) {
+      nchunk = MIN(nangles-nread,CHUNK);
+      if (binflag) eof = read_binary(nchunk,5,values);
+      else eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      if (binflag) atom->data_angles(nchunk,values,count,id_offset,aoffset);
+      else atom->data_angles(nchunk,buffer,count,id_offset,aoffset);
+      nread += nchunk;
+    }
+
+    memory->destroy(values);
   }
 
   // if firstpass: tally max angle/atom and return
@@ -1330,9 +1882,10 @@ void ReadData::angles(int firstpass)
 
 /* ----------------------------------------------------------------------
    scan or read all dihedrals
+   binflag = 1 for a Binary Dihedrals section
 ------------------------------------------------------------------------- */
 
-void ReadData::dihedrals(int firstpass)
+void ReadData::dihedrals(int firstpass, int binflag)
 {
   int nchunk,eof;
 
@@ -1357,14 +1910,32 @@ void ReadData::dihedrals(int firstpass)
 
   // read and process dihedrals
 
-  bigint nread = 0;
+  // with more than one proc, procs parse one chunk each
+  //   and send dihedrals to the procs that own their atoms
+  // else, or if not requested, every proc parses every chunk
 
-  while (nread < ndihedrals) {
-    nchunk = MIN(ndihedrals-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_dihedrals(nchunk,buffer,count,id_offset,doffset);
-    nread += nchunk;
+  if (binflag) binary_header(BINARY_INT64,ndihedrals,6);
+
+  if (nprocs > 1 && scatterflag)
+    scatter_topology(DIHEDRALS,ndihedrals,6,binflag,count);
+
+  else {
+    int64_t *values = NULL;
+    if (binflag) memory->create(values,CHUNK*6,"read_data:values");
+
+    bigint nread = 0;
+
+    while (nread < ndihedrals) {
+      nchunk = MIN(ndihedrals-nread,CHUNK);
+      if (binflag) eof = read_binary(nchunk,6,values);
+      else eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      if (binflag) atom->data_dihedrals(nchunk,values,count,id_offset,doffset);
+      else atom->data_dihedrals(nchunk,buffer,count,id_offset,doffset);
+      nread += nchunk;
+    }
+
+    memory->destroy(values);
   }
 
   // if firstpass: tally max dihedral/atom and return
@@ -1413,9 +1984,10 @@ void ReadData::dihedrals(int firstpass)
 
 /* ----------------------------------------------------------------------
    scan or read all impropers
+   binflag = 1 for a Binary Impropers section
 ------------------------------------------------------------------------- */
 
-void ReadData::impropers(int firstpass)
+void ReadData::impropers(int firstpass, int binflag)
 {
   int nchunk,eof;
 
@@ -1440,14 +2012,32 @@ void ReadData::impropers(int firstpass)
 
   // read and process impropers
 
-  bigint nread = 0;
+  // with more than one proc, procs parse one chunk each
+  //   and send impropers to the procs that own their atoms
+  // else, or if not requested, every proc parses every chunk
 
-  while (nread < nimpropers) {
-    nchunk = MIN(nimpropers-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_impropers(nchunk,buffer,count,id_offset,ioffset);
-    nread += nchunk;
+  if (binflag) binary_header(BINARY_INT64,nimpropers,6);
+
+  if (nprocs > 1 && scatterflag)
+    scatter_topology(IMPROPERS,nimpropers,6,binflag,count);
+
+  else {
+    int64_t *values = NULL;
+    if (binflag) memory->create(values,CHUNK*6,"read_data:values");
+
+    bigint nread = 0;
+
+    while (nread < nimpropers) {
+      nchunk = MIN(nimpropers-nread,CHUNK);
+      if (binflag) eof = read_binary(nchunk,6,values);
+      else eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      if (binflag) atom->data_impropers(nchunk,values,count,id_offset,ioffset);
+      else atom->data_impropers(nchunk,buffer,count,id_offset,ioffset);
+      nread += nchunk;
+    }
+
+    memory->destroy(values);
   }
 
   // if firstpass: tally max improper/atom and return
@@ -1846,6 +2436,7 @@ int ReadData::reallocate(int **pcount, int cmax, int amax)
 /* ----------------------------------------------------------------------
    proc 0 opens data file
    test if gzipped
+   with COMPRESS package, gzipped file is decompressed in-process
 ------------------------------------------------------------------------- */
 
 void ReadData::open(char *file)
@@ -1853,7 +2444,10 @@ void ReadData::open(char *file)
   compressed = 0;
   char *suffix = file + strlen(file) - 3;
   if (suffix > file && strcmp(suffix,".gz") == 0) compressed = 1;
-  if (!compressed) fp = fopen(file,"r");
+  if (!compressed) fp = fopen(file,"rb");
+#ifdef LMP_COMPRESS
+  else if ((fp = GzFrame::open_read(file,0)) != NULL) compressed = 2;
+#endif
   else {
 #ifdef LAMMPS_GZIP
     char gunzip[128];
@@ -1963,6 +2557,84 @@ void ReadData::skip_lines(bigint n)
   if (eof == NULL) error->one(FLERR,"Unexpected end of data file");
 }
 
+/* ----------------------------------------------------------------------
+   proc 0 reads block header of a Binary section and checks it
+   header = magic number, value type, # of records, # of values per record
+   if ncol_expect > 0, # of values per record must match it
+   return # of values per record on all procs
+------------------------------------------------------------------------- */
+
+int ReadData::binary_header(int valtype, bigint nrow, int ncol_expect)
+{
+  int flag = 0;
+  int ncol = 0;
+
+  if (me == 0) {
+    int ibuf[2];
+    int64_t lbuf[2];
+    if (fread(ibuf,sizeof(int),2,fp) != 2 ||
+        fread(lbuf,sizeof(int64_t),2,fp) != 2) flag = 1;
+    else if (ibuf[0] != BINARY_MAGIC) flag = 2;
+    else if (ibuf[1] != valtype || lbuf[0] != nrow || lbuf[1] <= 0 ||
+             (ncol_expect > 0 && lbuf[1] != ncol_expect)) flag = 3;
+    else ncol = lbuf[1];
+  }
+
+  MPI_Bcast(&flag,1,MPI_INT,0,world);
+  if (flag == 1) error->all(FLERR,"Unexpected end of data file");
+  if (flag == 2)
+    error->all(FLERR,"Binary data file section has invalid format or "
+               "byte order");
+  if (flag == 3)
+    error->all(FLERR,"Binary data file section does not match header");
+
+  MPI_Bcast(&ncol,1,MPI_INT,0,world);
+  return ncol;
+}
+
+/* ----------------------------------------------------------------------
+   skip all records of a Binary section
+   seek past them, unless file is compressed
+------------------------------------------------------------------------- */
+
+void ReadData::binary_skip(int valtype, bigint nrow)
+{
+  int ncol = binary_header(valtype,nrow,0);
+  if (me) return;
+
+  bigint nbytes = nrow * ncol * sizeof(double);
+  if (!compressed) {
+    fseek(fp,nbytes,SEEK_CUR);
+    return;
+  }
+
+  bigint n;
+  while (nbytes > 0) {
+    n = MIN(nbytes,CHUNK*MAXLINE);
+    if (fread(buffer,1,n,fp) != (size_t) n)
+      error->one(FLERR,"Unexpected end of data file");
+    nbytes -= n;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   proc 0 reads N binary records of ncol 8-byte values and bcasts them
+   values = buffer for N records, doubles or int64 as stored in the file
+   return 0 if successful, 1 if get EOF error before read is complete
+------------------------------------------------------------------------- */
+
+int ReadData::read_binary(int n, int ncol, void *values)
+{
+  int eof = 0;
+  size_t nvalues = (size_t) n*ncol;
+  if (me == 0 && fread(values,sizeof(double),nvalues,fp) != nvalues) eof = 1;
+
+  MPI_Bcast(&eof,1,MPI_INT,0,world);
+  if (eof) return 1;
+  MPI_Bcast(values,(int) (nvalues*sizeof(double)),MPI_CHAR,0,world);
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    parse a line of coeffs into words, storing them in narg,arg
    trim anything from '#' onward
@@ -2033,3 +2705,17 @@ int ReadData::style_match(const char *one, const char *two)
   if ((len1 == 0) || (len1 == len2) || (strncmp(one,two,len1) == 0)) return 1;
   return 0;
 }
+
+/* ----------------------------------------------------------------------
+   comparison function invoked by qsort() to order int64 records
+   by their 1st value, which is their position in the data file
+------------------------------------------------------------------------- */
+
+static int compare_records(const void *p1, const void *p2)
+{
+  int64_t i1 = *((const int64_t *) p1);
+  int64_t i2 = *((const int64_t *) p2);
+  if (i1 < i2) return -1;
+  if (i1 > i2) return 1;
+  return 0;
+}
@@ -32,7 +32,9 @@ class ReadData : protected Pointers {
   void command(int, char **);
 
  private:
-  int me,compressed;
+  int me,nprocs,compressed;
+  int scatterflag;
+  char *file;
   char *line,*copy,*keyword,*buffer,*style;
   FILE *fp;
   char **arg;
@@ -77,6 +79,17 @@ class ReadData : protected Pointers {
   char **fix_header;
   char **fix_section;
 
+  // union data struct for packing 32-bit and 64-bit ints into double bufs
+  // see atom_vec.h for documentation
+
+  union ubuf {
+    double d;
+    int64_t i;
+    ubuf(double arg) : d(arg) {}
+    ubuf(int64_t arg) : i(arg) {}
+    ubuf(int arg) : i(arg) {}
+  };
+
   // methods
 
   void open(char *);
@@ -88,14 +101,28 @@ class ReadData : protected Pointers {
   void parse_coeffs(char *, const char *, int, int, int);
   int style_match(const char *, const char *);
 
-  void atoms();
-  void velocities();
+  int binary_header(int, bigint, int);
+  void binary_skip(int, bigint);
+  int read_binary(int, int, void *);
+
+  void atoms(int);
+  int atoms_binary();
+  void migrate(int);
+  void velocities(int);
+
+  void send_lines(int, int);
+  int scatter_records(bigint, int, int, int, void *);
+  void parse_vels(int, int, double *);
+  void parse_topology(int, int, int64_t *);
+  int send_to_owners(class Irregular *, int, int, char *, int, tagint *,
+                     char *&);
+  void scatter_topology(int, bigint, int, int, int *);
 
-  void bonds(int);
+  void bonds(int, int);
   void bond_scan(int, char *, int *);
-  void angles(int);
-  void dihedrals(int);
-  void impropers(int);
+  void angles(int, int);
+  void dihedrals(int, int);
+  void impropers(int, int);
 
   void bonus(bigint, class AtomVec *, const char *);
   void bodies(int);
@@ -423,6 +450,37 @@ E: Unexpected end of data file
 LAMMPS hit the end of the data file while attempting to read a
 section.  Something is wrong with the format of the data file.
 
+E: Incorrect velocity format in data file
+
+Each line in the Velocities section must have the number of values
+expected by the atom style.
+
+E: Incorrect topology format in data file
+
+A line in the Bonds, Angles, Dihedrals, or Impropers section has
+fewer values than an index, a type, and the atom IDs it requires.
+
+E: Invalid atom ID in Velocities section of data file
+
+Atom IDs must be positive integers and within range of defined
+atoms.
+
+E: Invalid atom ID in %s section of data file
+
+Atom IDs in the Bonds, Angles, Dihedrals, or Impropers section must
+be positive integers and within range of defined atoms.
+
+E: Binary data file section has invalid format or byte order
+
+The block header of a Binary section does not start with the expected
+magic number.  The file is corrupted or was written on a machine with
+a different byte order.
+
+E: Binary data file section does not match header
+
+The number of records or values per record stored in a Binary section
+is inconsistent with the header of the data file.
+
 E: No ellipsoids allowed with this atom style
 
 Self-explanatory.  Check data file.
@@ -45,6 +45,9 @@ using namespace LAMMPS_NS;
 
 #define CHUNK 1024
 #define EPSILON 1.0e-6
+#define MAXLINE 1024
+#define DELTA 1024
+#define TEXTCHUNK 8192   // # of atom lines scattered to each reader at once
 
 // also in reader_native.cpp
 
@@ -75,6 +78,13 @@ ReadDump::ReadDump(LAMMPS *lmp) : Pointers(lmp)
 
   reader = NULL;
   fp = NULL;
+
+  nreader = 1;
+
+  indexflag = 1;
+  indexfile = -1;
+  nindex = 0;
+  indexstep = indexoffset = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -89,6 +99,8 @@ ReadDump::~ReadDump()
   delete [] readerstyle;
 
   memory->destroy(fields);
+  memory->destroy(indexstep);
+  memory->destroy(indexoffset);
   delete reader;
 }
 
@@ -231,10 +243,21 @@ bigint ReadDump::seek(bigint nrequest, int exact)
 
     // exit file loop when dump timestep >= nrequest
     // or files exhausted
+    // if file has a frame index, jump directly to matching snapshot
 
     for (ifile = 0; ifile < nfile; ifile++) {
       ntimestep = -1;
       reader->open_file(files[ifile]);
+      if (read_index(ifile)) {
+        for (iframe = 0; iframe < nindex; iframe++)
+          if (indexstep[iframe] >= nrequest) break;
+        if (iframe < nindex) {
+          ntimestep = jump_frame();
+          break;
+        }
+        reader->close_file();
+        continue;
+      }
       while (1) {
         eofflag = reader->read_time(ntimestep);
         if (eofflag) break;
@@ -278,7 +301,34 @@ bigint ReadDump::next(bigint ncurrent, bigint nlast, int nevery, int nskip)
 
     for (ifile = currentfile; ifile < nfile; ifile++) {
       ntimestep = -1;
-      if (ifile != currentfile) reader->open_file(files[ifile]);
+      if (ifile != currentfile) {
+        reader->open_file(files[ifile]);
+        read_index(ifile);
+      }
+
+      // same logic as below, but walk frame index and jump to match
+
+      if (indexfile == ifile) {
+        while (1) {
+          eofflag = (iframe == nindex);
+          if (iskip == nskip) iskip = 0;
+          iskip++;
+          if (eofflag) break;
+          ntimestep = indexstep[iframe];
+          if (ntimestep <= ncurrent) break;
+          if (ntimestep > nlast) break;
+          if (nevery && ntimestep % nevery) iframe++;
+          else if (iskip < nskip) iframe++;
+          else {
+            ntimestep = jump_frame();
+            break;
+          }
+        }
+        if (eofflag) reader->close_file();
+        else break;
+        continue;
+      }
+
       while (1) {
         eofflag = reader->read_time(ntimestep);
         if (iskip == nskip) iskip = 0;
@@ -305,6 +355,69 @@ bigint ReadDump::next(bigint ncurrent, bigint nlast, int nevery, int nskip)
   return ntimestep;
 }
 
+/* ----------------------------------------------------------------------
+   load frame index of file ifile, only called by proc 0
+   index file = dump file name with ".idx" appended, see dump_modify index
+   return 1 if index was loaded, 0 if none or reader cannot seek in file
+------------------------------------------------------------------------- */
+
+int ReadDump::read_index(int ifile)
+{
+  indexfile = -1;
+  if (!indexflag) return 0;
+
+  char *indexname = new char[strlen(files[ifile]) + 8];
+  sprintf(indexname,"%s.idx",files[ifile]);
+  FILE *fpindex = fopen(indexname,"r");
+  delete [] indexname;
+  if (fpindex == NULL) return 0;
+  if (reader->seek_file(0)) {
+    fclose(fpindex);
+    return 0;
+  }
+
+  char line[MAXLINE];
+  int maxindex = nindex;
+  nindex = 0;
+  while (fgets(line,MAXLINE,fpindex)) {
+    char *word = strtok(line," \t\n\r\f");
+    if (word == NULL || word[0] == '#') continue;
+    if (nindex == maxindex) {
+      maxindex += DELTA;
+      memory->grow(indexstep,maxindex,"read_dump:indexstep");
+      memory->grow(indexoffset,maxindex,"read_dump:indexoffset");
+    }
+    indexstep[nindex] = ATOBIGINT(word);
+    word = strtok(NULL," \t\n\r\f");
+    if (word == NULL) error->one(FLERR,"Invalid dump file index");
+    indexoffset[nindex] = ATOBIGINT(word);
+    nindex++;
+  }
+  fclose(fpindex);
+
+  indexfile = ifile;
+  iframe = 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   position reader at frame iframe of loaded index and read its timestep
+   error if snapshot there does not have the timestep the index lists
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+bigint ReadDump::jump_frame()
+{
+  bigint ntimestep = -1;
+  int eofflag = 1;
+  if (reader->seek_file(indexoffset[iframe]) == 0)
+    eofflag = reader->read_time(ntimestep);
+  if (eofflag || ntimestep != indexstep[iframe])
+    error->one(FLERR,"Dump file does not match its index file");
+  iframe++;
+  return ntimestep;
+}
+
 /* ----------------------------------------------------------------------
    read and broadcast and store snapshot header info
    set nsnapatoms = # of atoms in snapshot
@@ -466,17 +579,21 @@ void ReadDump::atoms()
   memory->create(ucflag_all,CHUNK,"read_dump:ucflag");
 
   // read, broadcast, and process atoms from snapshot in chunks
+  // or parse atoms on several procs and route them to owning procs
 
   addproc = -1;
 
-  int nchunk;
-  bigint nread = 0;
-  while (nread < nsnapatoms) {
-    nchunk = MIN(nsnapatoms-nread,CHUNK);
-    if (me == 0) reader->read_atoms(nchunk,nfield,fields);
-    MPI_Bcast(&fields[0][0],nchunk*nfield,MPI_DOUBLE,0,world);
-    process_atoms(nchunk);
-    nread += nchunk;
+  if (nreader > 1 && nprocs > 1 && reader->textflag) read_parallel();
+  else {
+    int nchunk;
+    bigint nread = 0;
+    while (nread < nsnapatoms) {
+      nchunk = MIN(nsnapatoms-nread,CHUNK);
+      if (me == 0) reader->read_atoms(nchunk,nfield,fields);
+      MPI_Bcast(&fields[0][0],nchunk*nfield,MPI_DOUBLE,0,world);
+      process_atoms(nchunk);
+      nread += nchunk;
+    }
   }
 
   // if addflag set, add tags to new atoms if possible
@@ -682,6 +799,17 @@ int ReadDump::fields_and_keywords(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) wrapflag = 0;
       else error->all(FLERR,"Illegal read_dump command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"index") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal read_dump command");
+      if (strcmp(arg[iarg+1],"yes") == 0) indexflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) indexflag = 0;
+      else error->all(FLERR,"Illegal read_dump command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"nreader") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal read_dump command");
+      nreader = force->inumeric(FLERR,arg[iarg+1]);
+      if (nreader < 1) error->all(FLERR,"Illegal read_dump nreader value");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"format") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal read_dump command");
       delete [] readerstyle;
@@ -726,6 +854,184 @@ int ReadDump::whichtype(char *str)
   return type;
 }
 
+/* ----------------------------------------------------------------------
+   read atoms of snapshot with nreader procs parsing the atom lines
+   proc 0 reads atom lines as text and scatters blocks of lines to readers
+   each reader converts its lines to field values
+   rendezvous on atom IDs routes values to the proc owning each atom:
+     owners send their IDs to rendezvous proc = ID % nprocs,
+     readers send field values to the same rendezvous proc,
+     rendezvous proc sends values to owner, or keeps them if no owner
+   then each proc processes values it received as a chunk,
+     atoms that no proc owns are added by their rendezvous proc
+------------------------------------------------------------------------- */
+
+void ReadDump::read_parallel()
+{
+  int i,j,n;
+
+  reader->share_fields(nfield);
+
+  // readers are spread evenly across procs
+  // nlines = # of lines sent to each proc in one block, same on all procs
+  // text of all readers is concatenated on proc 0, so its size
+  //   must fit in an int for read_text() and MPI_Scatterv()
+  // each line is at most MAXLINE chars plus a newline,
+  //   so block is capped to keep its text under MAXSMALLINT
+
+  int nr = MIN(nreader,nprocs);
+  int *nlines = new int[nprocs];
+  int *nchars = new int[nprocs];
+  int *displs = new int[nprocs];
+
+  char *text = NULL;
+  char *mytext = NULL;
+  int maxtext = 0;
+  int maxmytext = 0;
+
+  double **rows = NULL;
+  int nrows = 0;
+  int maxrows = 0;
+
+  bigint nread = 0;
+  while (nread < nsnapatoms) {
+    bigint nblock = MIN(nsnapatoms-nread,(bigint) TEXTCHUNK*nr);
+    nblock = MIN(nblock,MAXSMALLINT/(MAXLINE+1));
+    for (i = 0; i < nprocs; i++) nlines[i] = nchars[i] = displs[i] = 0;
+    for (int r = 0; r < nr; r++)
+      nlines[(bigint) r*nprocs/nr] =
+        static_cast<int> (nblock*(r+1)/nr - nblock*r/nr);
+
+    if (me == 0) {
+      int ntext = 0;
+      for (i = 0; i < nprocs; i++) {
+        if (nlines[i] == 0) continue;
+        displs[i] = ntext;
+        nchars[i] = reader->read_text(nlines[i],text,maxtext,ntext);
+        ntext += nchars[i];
+      }
+    }
+
+    int mychars;
+    MPI_Scatter(nchars,1,MPI_INT,&mychars,1,MPI_INT,0,world);
+    if (mychars + 1 > maxmytext) {
+      maxmytext = mychars + 1;
+      memory->grow(mytext,maxmytext,"read_dump:mytext");
+    }
+    MPI_Scatterv(text,nchars,displs,MPI_CHAR,
+                 mytext,mychars,MPI_CHAR,0,world);
+    mytext[mychars] = '\0';
+
+    if (nlines[me]) {
+      if (nrows + nlines[me] > maxrows) {
+        maxrows = nrows + nlines[me];
+        memory->grow(rows,maxrows,nfield,"read_dump:rows");
+      }
+      reader->parse_text(nlines[me],mytext,nfield,&rows[nrows]);
+      nrows += nlines[me];
+    }
+    nread += nblock;
+  }
+
+  delete [] nlines;
+  delete [] nchars;
+  delete [] displs;
+  memory->destroy(text);
+  memory->destroy(mytext);
+
+  // maxtag = largest atom ID owned or read by any proc
+
+  tagint *tag = atom->tag;
+  int nlocal = atom->nlocal;
+
+  tagint maxtag = 0;
+  for (i = 0; i < nlocal; i++) maxtag = MAX(maxtag,tag[i]);
+  for (i = 0; i < nrows; i++)
+    maxtag = MAX(maxtag,static_cast<tagint> (rows[i][0]));
+  tagint maxtag_all;
+  MPI_Allreduce(&maxtag,&maxtag_all,1,MPI_LMP_TAGINT,MPI_MAX,world);
+
+  // owners send ID and their proc to rendezvous proc of each owned atom
+
+  int *proclist;
+  memory->create(proclist,MAX(1,MAX(nlocal,nrows)),"read_dump:proclist");
+  tagint *idsend;
+  memory->create(idsend,2*MAX(1,nlocal),"read_dump:idsend");
+
+  for (i = 0; i < nlocal; i++) {
+    proclist[i] = tag[i] % nprocs;
+    idsend[2*i] = tag[i];
+    idsend[2*i+1] = me;
+  }
+
+  Irregular *irregular = new Irregular(lmp);
+  n = irregular->create_data(nlocal,proclist,0,2*sizeof(tagint));
+  tagint *idrecv;
+  memory->create(idrecv,2*MAX(1,n),"read_dump:idrecv");
+  irregular->exchange_data((char *) idsend,2*sizeof(tagint),(char *) idrecv);
+  irregular->destroy_data();
+
+  // owner[j] = proc that owns atom ID = j*nprocs + me, -1 if none
+
+  int nslot = static_cast<int> (maxtag_all/nprocs) + 1;
+  int *owner;
+  memory->create(owner,nslot,"read_dump:owner");
+  for (j = 0; j < nslot; j++) owner[j] = -1;
+  for (i = 0; i < n; i++)
+    owner[idrecv[2*i]/nprocs] = static_cast<int> (idrecv[2*i+1]);
+
+  memory->destroy(idsend);
+  memory->destroy(idrecv);
+
+  // readers send field values of each atom to its rendezvous proc
+
+  tagint itag;
+  for (i = 0; i < nrows; i++) {
+    itag = static_cast<tagint> (rows[i][0]);
+    if (itag <= 0) error->one(FLERR,"Invalid atom ID in dump file");
+    proclist[i] = itag % nprocs;
+  }
+
+  n = irregular->create_data(nrows,proclist,0,nfield*sizeof(double));
+  double **values;
+  memory->create(values,MAX(1,n),nfield,"read_dump:values");
+  irregular->exchange_data(rows ? (char *) &rows[0][0] : NULL,
+                           nfield*sizeof(double),(char *) &values[0][0]);
+  irregular->destroy_data();
+  memory->destroy(rows);
+
+  // rendezvous procs send field values to owning proc
+  // values of atoms with no owner stay on this proc
+
+  memory->grow(proclist,MAX(1,n),"read_dump:proclist");
+  for (i = 0; i < n; i++) {
+    itag = static_cast<tagint> (values[i][0]);
+    proclist[i] = owner[itag/nprocs];
+    if (proclist[i] < 0) proclist[i] = me;
+  }
+  memory->destroy(owner);
+
+  int nmine = irregular->create_data(n,proclist,0,nfield*sizeof(double));
+  double **save = fields;
+  memory->create(fields,MAX(1,nmine),nfield,"read_dump:fields");
+  irregular->exchange_data((char *) &values[0][0],nfield*sizeof(double),
+                           (char *) &fields[0][0]);
+  irregular->destroy_data();
+  delete irregular;
+  memory->destroy(values);
+  memory->destroy(proclist);
+
+  // process received atoms as one chunk
+  // unmatched atoms have no owner, so add them on this proc
+
+  memory->grow(ucflag,MAX(1,nmine),"read_dump:ucflag");
+  replace_atoms(nmine);
+  if (addflag) add_atoms(nmine,ucflag,0);
+
+  memory->destroy(fields);
+  fields = save;
+}
+
 /* ----------------------------------------------------------------------
    process each of N atoms in chunk read from dump file
    if in replace mode and atom ID matches current atom,
@@ -738,7 +1044,25 @@ int ReadDump::whichtype(char *str)
 
 void ReadDump::process_atoms(int n)
 {
-  int i,m,ifield,itype;
+  replace_atoms(n);
+
+  // create any atoms in chunk that no processor owned
+
+  if (!addflag) return;
+
+  MPI_Allreduce(ucflag,ucflag_all,n,MPI_INT,MPI_SUM,world);
+  add_atoms(n,ucflag_all,1);
+}
+
+/* ----------------------------------------------------------------------
+   match each of N atoms in chunk to an owned atom via its ID
+   set ucflag for chunk atoms and uflag for owned atoms that match
+   if in replace mode, overwrite owned atom info with fields from dump file
+------------------------------------------------------------------------- */
+
+void ReadDump::replace_atoms(int n)
+{
+  int i,m,ifield;
   int xbox,ybox,zbox;
   tagint tag;
 
@@ -832,25 +1156,37 @@ void ReadDump::process_atoms(int n)
     }
   }
 
-  // create any atoms in chunk that no processor owned
-  // add atoms in round-robin sequence on processors
-  // cannot do it geometrically b/c dump coords may not be in simulation box
+}
 
-  if (!addflag) return;
+/* ----------------------------------------------------------------------
+   create new atoms for each of N chunk atoms with flag = 0
+   if roundrobin, add atoms in round-robin sequence on processors,
+     else this proc adds all of them
+   cannot do it geometrically b/c dump coords may not be in simulation box
+------------------------------------------------------------------------- */
 
-  MPI_Allreduce(ucflag,ucflag_all,n,MPI_INT,MPI_SUM,world);
+void ReadDump::add_atoms(int n, int *flag, int roundrobin)
+{
+  int i,m,ifield,itype;
+  int xbox,ybox,zbox;
+
+  double **v = atom->v;
+  double *q = atom->q;
+  imageint *image = atom->image;
 
   int nlocal_previous = atom->nlocal;
   double one[3];
 
   for (i = 0; i < n; i++) {
-    if (ucflag_all[i]) continue;
+    if (flag[i]) continue;
 
     // each processor adds every Pth atom
 
-    addproc++;
-    if (addproc == nprocs) addproc = 0;
-    if (addproc != me) continue;
+    if (roundrobin) {
+      addproc++;
+      if (addproc == nprocs) addproc = 0;
+      if (addproc != me) continue;
+    }
 
     // create type and coord fields from dump file
     // coord = 0.0 unless corresponding dump file field was specified
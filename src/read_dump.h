@@ -58,6 +58,14 @@ private:
   int scaleflag;           // user 0/1 if dump file coords are unscaled/scaled
   int wrapflag;            // user 0/1 if dump file coords are unwrapped/wrapped
   char *readerstyle;       // style of dump files to read
+  int nreader;             // # of procs that parse atoms of a snapshot
+
+  int indexflag;           // 1 to use frame index of dump files if exists
+  int indexfile;           // file whose frame index is loaded, -1 if none
+  int nindex;              // # of frames in loaded index
+  int iframe;              // next frame in loaded index to examine
+  bigint *indexstep;       // timestep of each frame in loaded index
+  bigint *indexoffset;     // byte offset of each frame in loaded index
 
   int nfield;              // # of fields to extract from dump file
   int *fieldtype;          // type of each field = X,VY,IZ,etc
@@ -82,8 +90,13 @@ private:
 
   class Reader *reader;           // class that reads dump file
 
+  int read_index(int);
+  bigint jump_frame();
   int whichtype(char *);
+  void read_parallel();
   void process_atoms(int);
+  void replace_atoms(int);
+  void add_atoms(int, int *, int);
   void delete_atoms();
 
   double xfield(int, int);
@@ -126,6 +139,14 @@ E: Read_dump triclinic status does not match simulation
 Both the dump snapshot and the current LAMMPS simulation must
 be using either an orthogonal or triclinic box.
 
+E: Illegal read_dump nreader value
+
+The nreader keyword requires a value >= 1.
+
+E: Invalid atom ID in dump file
+
+Atom IDs read from a dump file in parallel must be positive.
+
 E: Read_dump field not found in dump file
 
 Self-explanatory.
@@ -33,6 +33,7 @@
 #include "dihedral.h"
 #include "improper.h"
 #include "special.h"
+#include "write_restart.h"
 #include "universe.h"
 #include "mpiio.h"
 #include "memory.h"
@@ -46,6 +47,7 @@ using namespace LAMMPS_NS;
 #define ENDIAN 0x0001
 #define ENDIANSWAP 0x1000
 #define VERSION_NUMERIC 0
+#define DELTASIZE 8
 
 enum{VERSION,SMALLINT,TAGINT,BIGINT,
      UNITS,NTIMESTEP,DIMENSION,NPROCS,PROCGRID,
@@ -62,10 +64,13 @@ enum{VERSION,SMALLINT,TAGINT,BIGINT,
      MULTIPROC,MPIIO,PROCSPERFILE,PERPROC,
      IMAGEINT,BOUNDMIN,TIMESTEP,
      ATOM_ID,ATOM_MAP_STYLE,ATOM_MAP_USER,ATOM_SORTFREQ,ATOM_SORTBIN,
-     COMM_MODE,COMM_CUTOFF,COMM_VEL};
+     COMM_MODE,COMM_CUTOFF,COMM_VEL,
+     DELTA_BASE,DELTA_OFFSET,DELTA_NPROCS,DELTA_CHECKSUM,DELTAPROC};
 
 #define LB_FACTOR 1.1
 
+static int compare_delta_tag(const void *, const void *);
+
 /* ---------------------------------------------------------------------- */
 
 ReadRestart::ReadRestart(LAMMPS *lmp) : Pointers(lmp) {}
@@ -183,6 +188,8 @@ void ReadRestart::command(int narg, char **arg)
 
   // read file layout info
 
+  deltaflag = 0;
+  deltabase = NULL;
   file_layout();
 
   // close header file if in multiproc mode
@@ -212,6 +219,10 @@ void ReadRestart::command(int narg, char **arg)
     while (m < assignedChunkSize) m += avec->unpack_restart(&buf[m]);
   }
 
+  // input of single delta file and the base file it refers to
+
+  else if (deltaflag) delta_atoms(remapflag);
+
   // input of single native file
   // nprocs_file = # of chunks in file
   // proc 0 reads a chunk and bcasts it to other procs
@@ -429,6 +440,7 @@ void ReadRestart::command(int narg, char **arg)
   // clean-up memory
 
   delete [] file;
+  delete [] deltabase;
   memory->destroy(buf);
 
   // for multiproc or MPI-IO files:
@@ -989,6 +1001,18 @@ void ReadRestart::file_layout()
       if (multiproc && multiproc_file == 0)
         error->all(FLERR,"Restart file is a multi-proc file");
 
+    } else if (flag == DELTA_BASE) {
+      deltaflag = 1;
+      deltabase = read_string();
+      if (multiproc || mpiioflag)
+        error->all(FLERR,"Invalid flag in file layout section of restart file");
+    } else if (flag == DELTA_OFFSET) {
+      deltaoffset = read_bigint();
+    } else if (flag == DELTA_NPROCS) {
+      deltanprocs = read_int();
+    } else if (flag == DELTA_CHECKSUM) {
+      deltachecksum = read_bigint();
+
     } else if (flag == MPIIO) {
       int mpiioflag_file = read_int();
       if (mpiioflag == 0 && mpiioflag_file)
@@ -1072,6 +1096,162 @@ void ReadRestart::file_layout()
   }
 }
 
+/* ----------------------------------------------------------------------
+   read atoms from a delta file and the base file it refers to
+   delta file stores coords, tag, image flags, velocities of each atom
+   proc 0 reads delta chunks and bcasts them to other procs
+   each proc keeps atoms in its sub-domain, sorted by atom ID
+   then proc 0 reads per-atom chunks of base file and bcasts them
+   each proc unpacks base atoms it kept, with values from the delta file
+   checksum of unpacked base info must match the one in the delta file
+------------------------------------------------------------------------- */
+
+void ReadRestart::delta_atoms(int remapflag)
+{
+  int m,n;
+
+  int triclinic = domain->triclinic;
+  imageint *iptr;
+  double *x,lamda[3];
+  double *coord,*sublo,*subhi;
+  if (triclinic == 0) {
+    sublo = domain->sublo;
+    subhi = domain->subhi;
+  } else {
+    sublo = domain->sublo_lamda;
+    subhi = domain->subhi_lamda;
+  }
+
+  int maxbuf = 0;
+  double *buf = NULL;
+  int nmine = 0;
+  int maxmine = 0;
+  double *mine = NULL;
+
+  for (int iproc = 0; iproc < nprocs_file; iproc++) {
+    if (read_int() != DELTAPROC)
+      error->all(FLERR,"Invalid flag in peratom section of restart file");
+
+    n = read_int();
+    if (n > maxbuf) {
+      maxbuf = n;
+      memory->destroy(buf);
+      memory->create(buf,maxbuf,"read_restart:buf");
+    }
+    read_double_vec(n,buf);
+
+    for (m = 0; m < n; m += DELTASIZE) {
+      x = &buf[m];
+      if (remapflag) {
+        iptr = (imageint *) &buf[m+4];
+        domain->remap(x,*iptr);
+      }
+
+      if (triclinic) {
+        domain->x2lamda(x,lamda);
+        coord = lamda;
+      } else coord = x;
+
+      if (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
+          coord[1] >= sublo[1] && coord[1] < subhi[1] &&
+          coord[2] >= sublo[2] && coord[2] < subhi[2]) {
+        if ((nmine+1)*DELTASIZE > maxmine) {
+          maxmine = MAX(2*maxmine,(nmine+1)*DELTASIZE);
+          memory->grow(mine,maxmine,"read_restart:mine");
+        }
+        memcpy(&mine[nmine*DELTASIZE],&buf[m],DELTASIZE*sizeof(double));
+        nmine++;
+      }
+    }
+  }
+
+  if (nmine) qsort(mine,nmine,DELTASIZE*sizeof(double),compare_delta_tag);
+
+  // switch from delta file to per-atom section of base file
+
+  if (me == 0) {
+    fclose(fp);
+    fp = fopen(deltabase,"rb");
+    if (fp == NULL) {
+      char str[128];
+      snprintf(str,128,"Cannot open base restart file %s",deltabase);
+      error->one(FLERR,str);
+    }
+    fseek(fp,deltaoffset,SEEK_SET);
+  }
+
+  AtomVec *avec = atom->avec;
+  double *one,key[DELTASIZE];
+  bigint sum[2];
+  sum[0] = sum[1] = 0;
+  int nfound = 0;
+
+  for (int iproc = 0; iproc < deltanprocs; iproc++) {
+    if (read_int() != PERPROC)
+      error->all(FLERR,"Restart file does not match its base restart file");
+
+    n = read_int();
+    if (n > maxbuf) {
+      maxbuf = n;
+      memory->destroy(buf);
+      memory->create(buf,maxbuf,"read_restart:buf");
+    }
+    read_double_vec(n,buf);
+
+    m = 0;
+    while (m < n) {
+      key[3] = buf[m+4];
+      one = (double *) bsearch(key,mine,nmine,DELTASIZE*sizeof(double),
+                               compare_delta_tag);
+      if (one) {
+        WriteRestart::checksum_record(&buf[m],sum);
+        buf[m+1] = one[0];
+        buf[m+2] = one[1];
+        buf[m+3] = one[2];
+        buf[m+7] = one[4];
+        buf[m+8] = one[5];
+        buf[m+9] = one[6];
+        buf[m+10] = one[7];
+        m += avec->unpack_restart(&buf[m]);
+        nfound++;
+      } else m += static_cast<int> (buf[m]);
+    }
+  }
+
+  if (me == 0) {
+    fclose(fp);
+    fp = NULL;
+  }
+
+  // every kept delta atom must be found once in base file
+
+  bigint sum_all[2];
+  MPI_Allreduce(sum,sum_all,2,MPI_LMP_BIGINT,MPI_SUM,world);
+  int flag = (nfound == nmine) ? 0 : 1;
+  int flag_all;
+  MPI_Allreduce(&flag,&flag_all,1,MPI_INT,MPI_MAX,world);
+  if (flag_all || WriteRestart::checksum_combine(sum_all) != deltachecksum)
+    error->all(FLERR,"Restart file does not match its base restart file");
+
+  memory->destroy(buf);
+  memory->destroy(mine);
+}
+
+/* ----------------------------------------------------------------------
+   comparison function for qsort() and bsearch() of delta atoms by atom ID
+   atom ID is stored as int64_t bits in a double, as done by ubuf
+------------------------------------------------------------------------- */
+
+int compare_delta_tag(const void *iptr, const void *jptr)
+{
+  int64_t itag,jtag;
+  memcpy(&itag,&((const double *) iptr)[3],sizeof(int64_t));
+  memcpy(&jtag,&((const double *) jptr)[3],sizeof(int64_t));
+  if (itag < jtag) return -1;
+  if (itag > jtag) return 1;
+  return 0;
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // low-level fread methods
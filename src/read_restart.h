@@ -44,6 +44,14 @@ class ReadRestart : protected Pointers {
   bigint assignedChunkSize;
   MPI_Offset assignedChunkOffset,headerOffset;
 
+  // delta file values
+
+  int deltaflag;             // 1 if file is a delta file
+  char *deltabase;           // name of base file with full per-atom info
+  bigint deltaoffset;        // offset of per-atom section in base file
+  int deltanprocs;           // # of per-proc chunks in base file
+  bigint deltachecksum;      // checksum of per-atom info in base file
+
   void file_search(char *, char *);
   void header(int);
   void type_arrays();
@@ -53,6 +61,7 @@ class ReadRestart : protected Pointers {
   void endian();
   int version_numeric();
   void file_layout();
+  void delta_atoms(int);
 
   int read_int();
   bigint read_bigint();
@@ -97,6 +106,17 @@ E: Invalid flag in peratom section of restart file
 
 The format of this section of the file is not correct.
 
+E: Cannot open base restart file %s
+
+The base file that a delta restart file refers to cannot be opened.
+It must exist at the path it was written to.
+
+E: Restart file does not match its base restart file
+
+Atoms stored in the delta restart file do not match those in the base
+file, e.g. because the base file was overwritten after the delta file
+was written.
+
 E: Did not assign all restart atoms correctly
 
 Atoms read in from the restart file were not assigned correctly to
@@ -16,6 +16,10 @@
 #include "reader.h"
 #include "error.h"
 
+#ifdef LMP_COMPRESS
+#include "gz_frame.h"
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -23,21 +27,39 @@ using namespace LAMMPS_NS;
 Reader::Reader(LAMMPS *lmp) : Pointers(lmp)
 {
   fp = NULL;
+  filename = NULL;
+  textflag = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+Reader::~Reader()
+{
+  delete [] filename;
 }
 
 /* ----------------------------------------------------------------------
    try to open given file
    generic version for ASCII files that may be compressed
+   with COMPRESS package, gzipped files are decompressed in-process,
+     else via a pipe to gzip if LAMMPS_GZIP is defined
 ------------------------------------------------------------------------- */
 
 void Reader::open_file(const char *file)
 {
   if (fp != NULL) close_file();
 
+  delete [] filename;
+  filename = new char[strlen(file) + 1];
+  strcpy(filename,file);
+
   compressed = 0;
   const char *suffix = file + strlen(file) - 3;
   if (suffix > file && strcmp(suffix,".gz") == 0) compressed = 1;
   if (!compressed) fp = fopen(file,"r");
+#ifdef LMP_COMPRESS
+  else if ((fp = GzFrame::open_read(file,0)) != NULL) compressed = 2;
+#endif
   else {
 #ifdef LAMMPS_GZIP
     char gunzip[1024];
@@ -69,7 +91,32 @@ void Reader::open_file(const char *file)
 void Reader::close_file()
 {
   if (fp == NULL) return;
-  if (compressed) pclose(fp);
+  if (compressed == 1) pclose(fp);
   else fclose(fp);
   fp = NULL;
 }
+
+/* ----------------------------------------------------------------------
+   position open file at byte offset of a snapshot, e.g. from an index
+   gzipped file decompressed in-process is re-opened at that offset,
+     which must be the start of a gzip member
+   return 0 on success, 1 if file is a pipe or cannot be positioned
+------------------------------------------------------------------------- */
+
+int Reader::seek_file(bigint offset)
+{
+  if (fp == NULL || compressed == 1) return 1;
+
+  if (compressed == 2) {
+#ifdef LMP_COMPRESS
+    FILE *fpnew = GzFrame::open_read(filename,offset);
+    if (fpnew == NULL) return 1;
+    fclose(fp);
+    fp = fpnew;
+    return 0;
+#endif
+  }
+
+  if (fseek(fp,offset,SEEK_SET)) return 1;
+  return 0;
+}
@@ -23,7 +23,7 @@ namespace LAMMPS_NS {
 class Reader : protected Pointers {
  public:
   Reader(class LAMMPS *);
-  virtual ~Reader() {}
+  virtual ~Reader();
 
   virtual void settings(int, char**) {};
 
@@ -35,10 +35,21 @@ class Reader : protected Pointers {
 
   virtual void open_file(const char *);
   virtual void close_file();
+  virtual int seek_file(bigint);
+
+  // optional parsing of atom lines by procs other than proc 0
+
+  virtual void share_fields(int) {}
+  virtual int read_text(int, char *&, int &, int) { return 0; }
+  virtual void parse_text(int, char *, int, double **) {}
+
+  int textflag;            // 1 if style supports read_text(),parse_text()
 
  protected:
   FILE *fp;                // pointer to opened file or pipe
-  int compressed;          // flag for dump file compression
+  char *filename;          // name of opened file
+  int compressed;          // 0 = plain file, 1 = gzip pipe,
+                           // 2 = in-process gzip decompression
 };
 
 }
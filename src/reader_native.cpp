@@ -34,6 +34,7 @@ ReaderNative::ReaderNative(LAMMPS *lmp) : Reader(lmp)
   line = new char[MAXLINE];
   words = NULL;
   fieldindex = NULL;
+  textflag = 1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -282,6 +283,7 @@ bigint ReaderNative::read_header(double box[3][3], int &triclinic,
 
   // create internal vector of word ptrs for future parsing of per-atom lines
 
+  delete [] words;
   words = new char*[nwords];
 
   return natoms;
@@ -316,6 +318,80 @@ void ReaderNative::read_atoms(int n, int nfield, double **fields)
   }
 }
 
+/* ----------------------------------------------------------------------
+   broadcast column layout of per-atom lines found by read_header()
+   so that any proc can convert atom lines via parse_text()
+------------------------------------------------------------------------- */
+
+void ReaderNative::share_fields(int nfield)
+{
+  int me;
+  MPI_Comm_rank(world,&me);
+
+  MPI_Bcast(&nwords,1,MPI_INT,0,world);
+  if (me) {
+    memory->destroy(fieldindex);
+    memory->create(fieldindex,nfield,"read_dump:fieldindex");
+    delete [] words;
+    words = new char*[nwords];
+  }
+  MPI_Bcast(fieldindex,nfield,MPI_INT,0,world);
+}
+
+/* ----------------------------------------------------------------------
+   read N atom lines from dump file as text, without converting them
+   append lines to text starting at offset, grow text as needed
+   each line is terminated by a newline
+   return # of chars appended
+   only called by proc 0
+------------------------------------------------------------------------- */
+
+int ReaderNative::read_text(int n, char *&text, int &maxtext, int offset)
+{
+  int ntext = offset;
+
+  for (int i = 0; i < n; i++) {
+    if (ntext + MAXLINE + 1 > maxtext) {
+      bigint newmax = MAX(2*(bigint) maxtext,ntext + MAXLINE + 1);
+      maxtext = static_cast<int> (MIN(newmax,MAXSMALLINT));
+      memory->grow(text,maxtext,"read_dump:text");
+    }
+    if (fgets(&text[ntext],MAXLINE,fp) == NULL)
+      error->one(FLERR,"Unexpected end of dump file");
+    ntext += strlen(&text[ntext]);
+    if (text[ntext-1] != '\n') text[ntext++] = '\n';
+  }
+
+  return ntext - offset;
+}
+
+/* ----------------------------------------------------------------------
+   convert N newline-terminated atom lines in text
+   stores appropriate values in fields array, as read_atoms() does
+   text is modified by the parsing
+------------------------------------------------------------------------- */
+
+void ReaderNative::parse_text(int n, char *text, int nfield, double **fields)
+{
+  int i,m;
+  char *next;
+
+  for (i = 0; i < n; i++) {
+    next = strchr(text,'\n');
+    if (next == NULL) error->one(FLERR,"Unexpected end of dump file");
+    *next = '\0';
+
+    words[0] = strtok(text," \t\n\r\f");
+    for (m = 1; m < nwords; m++)
+      words[m] = strtok(NULL," \t\n\r\f");
+
+    for (m = 0; m < nfield; m++)
+      fields[i][m] = atof(words[fieldindex[m]]);
+
+    text = next + 1;
+  }
+}
+
 /* ----------------------------------------------------------------------
    match label to any of N labels
    return index of match or -1 if no match
@@ -36,6 +36,9 @@ class ReaderNative : public Reader {
   bigint read_header(double [3][3], int &, int, int, int *, char **,
                      int, int, int &, int &, int &, int &);
   void read_atoms(int, int, double **);
+  void share_fields(int);
+  int read_text(int, char *&, int &, int);
+  void parse_text(int, char *, int, double **);
 
 private:
   char *line;              // line read from dump file
@@ -11,6 +11,7 @@
    See the README file in the top-level LAMMPS directory.
 ------------------------------------------------------------------------- */
 
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include "replicate.h"
@@ -29,6 +30,7 @@ using namespace LAMMPS_NS;
 
 #define LB_FACTOR 1.1
 #define EPSILON   1.0e-6
+#define BIG       1.0e20
 
 enum{LAYOUT_UNIFORM,LAYOUT_NONUNIFORM,LAYOUT_TILED};    // several files
 
@@ -53,9 +55,9 @@ void Replicate::command(int narg, char **arg)
 
   // nrep = total # of replications
 
-  int nx = force->inumeric(FLERR,arg[0]);
-  int ny = force->inumeric(FLERR,arg[1]);
-  int nz = force->inumeric(FLERR,arg[2]);
+  nx = force->inumeric(FLERR,arg[0]);
+  ny = force->inumeric(FLERR,arg[1]);
+  nz = force->inumeric(FLERR,arg[2]);
   int nrep = nx*ny*nz;
 
   // error and warning checks
@@ -99,7 +101,7 @@ void Replicate::command(int narg, char **arg)
   for (i = 0; i < atom->nlocal; i++)
     domain->unmap(atom->x[i],atom->image[i]);
 
-  // communication buffer for all my atom's info
+  // communication buffers for my atom's info and for another proc's
   // max_size = largest buffer needed by any proc
   // must do before new Atom class created,
   //   since size_restart() uses atom->nlocal
@@ -108,7 +110,8 @@ void Replicate::command(int narg, char **arg)
   int send_size = atom->avec->size_restart();
   MPI_Allreduce(&send_size,&max_size,1,MPI_INT,MPI_MAX,world);
 
-  double *buf;
+  double *sendbuf,*buf;
+  memory->create(sendbuf,send_size,"replicate:sendbuf");
   memory->create(buf,max_size,"replicate:buf");
 
   // old = original atom class
@@ -256,36 +259,97 @@ void Replicate::command(int narg, char **arg)
     }
   }
 
-  // loop over all procs
-  // if this iteration of loop is me:
-  //   pack my unmapped atom data into buf
-  //   bcast it to all other procs
-  // performs 3d replicate loop with while loop over atoms in buf
-  //   x = new replicated position, remapped into simulation box
-  //   unpack atom into new atom class from buf if I own it
-  //   adjust tag, mol #, coord, topology info as needed
+  // pack my unmapped atom data into sendbuf, one time only
 
   AtomVec *old_avec = old->avec;
   AtomVec *avec = atom->avec;
 
+  int nsendbuf = 0;
+  for (i = 0; i < old->nlocal; i++)
+    nsendbuf += old_avec->pack_restart(i,&sendbuf[nsendbuf]);
+
+  // bounding box of my unmapped atoms and my sub-domain bounds,
+  //   both in lamda coords of new box
+  // replicated image ix,iy,iz of an atom is shifted by ix/nx,iy/ny,iz/nz
+  //   in lamda coords, for orthogonal and triclinic boxes
+  // Allgather them, so each proc can tell which procs it exchanges atoms
+  //   with, instead of every proc testing every atom of every proc
+
+  double mybox[12];
+  mybox[0] = mybox[1] = mybox[2] = BIG;
+  mybox[3] = mybox[4] = mybox[5] = -BIG;
+
+  double lamda[3];
+  for (i = 0; i < old->nlocal; i++) {
+    box_lamda(old->x[i],lamda);
+    for (j = 0; j < 3; j++) {
+      mybox[j] = MIN(mybox[j],lamda[j]-EPSILON);
+      mybox[3+j] = MAX(mybox[3+j],lamda[j]+EPSILON);
+    }
+  }
+
+  if (triclinic) {
+    for (j = 0; j < 3; j++) {
+      mybox[6+j] = sublo[j];
+      mybox[9+j] = subhi[j];
+    }
+  } else {
+    box_lamda(sublo,&mybox[6]);
+    box_lamda(subhi,&mybox[9]);
+  }
+
+  double *boxall;
+  memory->create(boxall,12*nprocs,"replicate:boxall");
+  MPI_Allgather(mybox,12,MPI_DOUBLE,boxall,12,MPI_DOUBLE,world);
+
+  // recvflag = 1 for procs whose replicated atoms may overlap my sub-domain
+  // send my atoms to procs whose sub-domain my replicated atoms may overlap
+
+  int *recvflag = new int[nprocs];
+  int *sendproc = new int[nprocs];
+  int nsend = 0;
+
+  for (int iproc = 0; iproc < nprocs; iproc++) {
+    recvflag[iproc] = overlap(&boxall[12*iproc],&mybox[6],-1,-1,-1);
+    if (iproc != me && overlap(mybox,&boxall[12*iproc+6],-1,-1,-1))
+      sendproc[nsend++] = iproc;
+  }
+
+  MPI_Request *requests = new MPI_Request[nsend];
+  for (i = 0; i < nsend; i++)
+    MPI_Isend(sendbuf,nsendbuf,MPI_DOUBLE,sendproc[i],0,world,&requests[i]);
+
+  // loop over procs which may send me atoms, in ascending order
+  // receive their unmapped atom data, or use my own sendbuf
+  // perform 3d replicate loop over images which may overlap my sub-domain
+  //   with while loop over atoms in buf
+  //   x = new replicated position, remapped into simulation box
+  //   unpack atom into new atom class from buf if I own it
+  //   adjust tag, mol #, coord, topology info as needed
+
   int ix,iy,iz;
   tagint atom_offset,mol_offset;
   imageint image;
-  double x[3],lamda[3];
-  double *coord;
+  double x[3];
+  double *coord,*rbuf;
   int tag_enable = atom->tag_enable;
+  MPI_Status status;
 
   for (int iproc = 0; iproc < nprocs; iproc++) {
-    if (me == iproc) {
-      n = 0;
-      for (i = 0; i < old->nlocal; i++) n += old_avec->pack_restart(i,&buf[n]);
+    if (!recvflag[iproc]) continue;
+    if (iproc == me) {
+      rbuf = sendbuf;
+      n = nsendbuf;
+    } else {
+      MPI_Recv(buf,max_size,MPI_DOUBLE,iproc,0,world,&status);
+      MPI_Get_count(&status,MPI_DOUBLE,&n);
+      rbuf = buf;
     }
-    MPI_Bcast(&n,1,MPI_INT,iproc,world);
-    MPI_Bcast(buf,n,MPI_DOUBLE,iproc,world);
 
     for (ix = 0; ix < nx; ix++) {
       for (iy = 0; iy < ny; iy++) {
         for (iz = 0; iz < nz; iz++) {
+          if (!overlap(&boxall[12*iproc],&mybox[6],ix,iy,iz)) continue;
 
           // while loop over one proc's atom list
 
@@ -294,13 +358,13 @@ void Replicate::command(int narg, char **arg)
             image = ((imageint) IMGMAX << IMG2BITS) |
               ((imageint) IMGMAX << IMGBITS) | IMGMAX;
             if (triclinic == 0) {
-              x[0] = buf[m+1] + ix*old_xprd;
-              x[1] = buf[m+2] + iy*old_yprd;
-              x[2] = buf[m+3] + iz*old_zprd;
+              x[0] = rbuf[m+1] + ix*old_xprd;
+              x[1] = rbuf[m+2] + iy*old_yprd;
+              x[2] = rbuf[m+3] + iz*old_zprd;
             } else {
-              x[0] = buf[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
-              x[1] = buf[m+2] + iy*old_yprd + iz*old_yz;
-              x[2] = buf[m+3] + iz*old_zprd;
+              x[0] = rbuf[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
+              x[1] = rbuf[m+2] + iy*old_yprd + iz*old_yz;
+              x[2] = rbuf[m+3] + iz*old_zprd;
             }
             domain->remap(x,image);
             if (triclinic) {
@@ -312,7 +376,7 @@ void Replicate::command(int narg, char **arg)
                 coord[1] >= sublo[1] && coord[1] < subhi[1] &&
                 coord[2] >= sublo[2] && coord[2] < subhi[2]) {
 
-              m += avec->unpack_restart(&buf[m]);
+              m += avec->unpack_restart(&rbuf[m]);
 
               i = atom->nlocal - 1;
               if (tag_enable)
@@ -356,15 +420,23 @@ void Replicate::command(int narg, char **arg)
                     }
                 }
               }
-            } else m += static_cast<int> (buf[m]);
+            } else m += static_cast<int> (rbuf[m]);
           }
         }
       }
     }
   }
 
-  // free communication buffer and old atom class
+  MPI_Waitall(nsend,requests,MPI_STATUS_IGNORE);
+
+  delete [] requests;
+  delete [] recvflag;
+  delete [] sendproc;
+  memory->destroy(boxall);
 
+  // free communication buffers and old atom class
+
+  memory->destroy(sendbuf);
   memory->destroy(buf);
   delete old;
 
@@ -425,3 +497,59 @@ void Replicate::command(int narg, char **arg)
     special.build();
   }
 }
+
+/* ----------------------------------------------------------------------
+   convert x in new box to lamda coords
+   for orthogonal box, Domain::x2lamda() is not setup, so do it here
+------------------------------------------------------------------------- */
+
+void Replicate::box_lamda(double *x, double *lamda)
+{
+  if (domain->triclinic) domain->x2lamda(x,lamda);
+  else {
+    lamda[0] = (x[0] - domain->boxlo[0]) / domain->xprd;
+    lamda[1] = (x[1] - domain->boxlo[1]) / domain->yprd;
+    lamda[2] = (x[2] - domain->boxlo[2]) / domain->zprd;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if image ix,iy,iz of bounding box bbox may overlap sub-domain
+     after remap into periodic box, else 0
+   bbox = lo[3],hi[3] and sub = lo[3],hi[3], both in lamda coords
+   ix,iy,iz = -1,-1,-1 tests if any image may overlap
+------------------------------------------------------------------------- */
+
+int Replicate::overlap(double *bbox, double *sub, int ix, int iy, int iz)
+{
+  int irep[3],nrep[3];
+  irep[0] = ix; irep[1] = iy; irep[2] = iz;
+  nrep[0] = nx; nrep[1] = ny; nrep[2] = nz;
+
+  for (int dim = 0; dim < 3; dim++) {
+    double lo = bbox[dim];
+    double hi = bbox[3+dim];
+    if (lo > hi) return 0;
+
+    // any image spans range of all images
+
+    if (irep[dim] < 0) hi += (nrep[dim]-1.0) / nrep[dim];
+    else {
+      lo += (double) irep[dim] / nrep[dim];
+      hi += (double) irep[dim] / nrep[dim];
+    }
+
+    // shift lo into periodic box, then also test image of range below it
+
+    if (domain->periodicity[dim]) {
+      if (hi - lo >= 1.0) continue;
+      double shift = floor(lo);
+      lo -= shift;
+      hi -= shift;
+      if ((lo > sub[3+dim] || hi < sub[dim]) &&
+          (lo-1.0 > sub[3+dim] || hi-1.0 < sub[dim])) return 0;
+    } else if (lo > sub[3+dim] || hi < sub[dim]) return 0;
+  }
+
+  return 1;
+}
@@ -28,6 +28,12 @@ class Replicate : protected Pointers {
  public:
   Replicate(class LAMMPS *);
   void command(int, char **);
+
+ private:
+  int nx,ny,nz;              // # of replications in each dim
+
+  void box_lamda(double *, double *);
+  int overlap(double *, double *, int, int, int);
 };
 
 }
@@ -172,6 +172,7 @@ void Rerun::command(int narg, char **arg)
 
   output->next_thermo = update->ntimestep;
   output->write(update->ntimestep);
+  output->flush_dumps();
 
   timer->barrier_stop();
 
@@ -181,6 +181,7 @@ void Run::command(int narg, char **arg)
     timer->init();
     timer->barrier_start();
     update->integrate->run(nsteps);
+    output->flush_dumps();
     timer->barrier_stop();
 
     update->integrate->cleanup();
@@ -222,6 +223,7 @@ void Run::command(int narg, char **arg)
       timer->init();
       timer->barrier_start();
       update->integrate->run(nsteps);
+      output->flush_dumps();
       timer->barrier_stop();
 
       update->integrate->cleanup();
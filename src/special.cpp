@@ -18,6 +18,7 @@
 #include "atom_vec.h"
 #include "force.h"
 #include "comm.h"
+#include "irregular.h"
 #include "modify.h"
 #include "fix.h"
 #include "accelerator_kokkos.h"
@@ -27,10 +28,6 @@
 
 using namespace LAMMPS_NS;
 
-// allocate space for static class variable
-
-Special *Special::sptr;
-
 /* ---------------------------------------------------------------------- */
 
 Special::Special(LAMMPS *lmp) : Pointers(lmp)
@@ -39,6 +36,8 @@ Special::Special(LAMMPS *lmp) : Pointers(lmp)
   MPI_Comm_size(world,&nprocs);
 
   onetwo = onethree = onefour = NULL;
+
+  irregular = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -48,29 +47,21 @@ Special::~Special()
   memory->destroy(onetwo);
   memory->destroy(onethree);
   memory->destroy(onefour);
+  delete irregular;
 }
 
 /* ----------------------------------------------------------------------
    create 1-2, 1-3, 1-4 lists of topology neighbors
    store in onetwo, onethree, onefour for each atom
    store 3 counters in nspecial[i]
+   info on atoms not owned by me is requested via rendezvous procs,
+     so # of communication steps is independent of # of procs
 ------------------------------------------------------------------------- */
 
 void Special::build()
 {
-  int i,j,k,size;
-  int max,maxall,nbuf;
-  tagint *buf;
-
   MPI_Barrier(world);
 
-  int nlocal = atom->nlocal;
-
-  tagint *tag = atom->tag;
-  int *num_bond = atom->num_bond;
-  tagint **bond_atom = atom->bond_atom;
-  int **nspecial = atom->nspecial;
-
   if (me == 0 && screen) {
     const double * const special_lj   = force->special_lj;
     const double * const special_coul = force->special_coul;
@@ -83,56 +74,102 @@ void Special::build()
 
   // initialize nspecial counters to 0
 
-  for (i = 0; i < nlocal; i++) {
+  int nlocal = atom->nlocal;
+  int **nspecial = atom->nspecial;
+
+  for (int i = 0; i < nlocal; i++) {
     nspecial[i][0] = 0;
     nspecial[i][1] = 0;
     nspecial[i][2] = 0;
   }
 
-  // -----------------------------------------------------
-  // compute nspecial[i][0] = # of 1-2 neighbors of atom i
-  // -----------------------------------------------------
+  // tell rendezvous procs which proc owns each atom
 
-  // bond partners stored by atom itself
+  if (!irregular) irregular = new Irregular(lmp);
+  irregular->atom_owners();
 
-  for (i = 0; i < nlocal; i++) nspecial[i][0] = num_bond[i];
+  // 1-2 neighbors always
+  // 1-3 neighbors unless special_bond weights for 1-3, 1-4 are set to 1.0
+  // 1-4 neighbors unless special_bond weights for 1-4 are set to 1.0
 
-  // if newton_bond off, then done
-  // else only counted 1/2 of all bonds, so count other half
+  onetwo_build();
 
-  if (force->newton_bond) {
+  int onethreeflag = 0;
+  int onefourflag = 0;
+
+  if (force->special_lj[2] != 1.0 || force->special_coul[2] != 1.0 ||
+      force->special_lj[3] != 1.0 || force->special_coul[3] != 1.0) {
+    onethree_build();
+    onethreeflag = 1;
+    if (force->special_lj[3] != 1.0 || force->special_coul[3] != 1.0) {
+      onefour_build();
+      onefourflag = 1;
+    }
+  }
+
+  dedup();
+  if (onethreeflag && force->special_angle) angle_trim();
+  if (onefourflag && force->special_dihedral) dihedral_trim();
+
+  delete irregular;
+  irregular = NULL;
+
+  combine();
+  fix_alteration();
+}
+
+/* ----------------------------------------------------------------------
+   create onetwo[i] = list of 1-2 neighbors for atom i
+   nspecial[i][0] = # of 1-2 neighbors of atom i
+------------------------------------------------------------------------- */
 
-    // nbufmax = largest buffer needed to hold info from any proc
-    // info for each atom = global tag of 2nd atom in each bond
+void Special::onetwo_build()
+{
+  int i,j,m,n;
 
-    nbuf = 0;
-    for (i = 0; i < nlocal; i++) nbuf += num_bond[i];
-    memory->create(buf,nbuf,"special:buf");
+  int nlocal = atom->nlocal;
+  tagint *tag = atom->tag;
+  int *num_bond = atom->num_bond;
+  tagint **bond_atom = atom->bond_atom;
+  int **nspecial = atom->nspecial;
+
+  // bond partners stored by atom itself
+  // if newton_bond on, only 1/2 of all bonds are stored,
+  //   so send each bond to owner of its 2nd atom as well
 
-    // fill buffer with global tags of bond partners of my atoms
+  int nrecv = 0;
+  tagint *recv = NULL;
 
-    size = 0;
+  if (force->newton_bond) {
+    n = 0;
+    for (i = 0; i < nlocal; i++) n += num_bond[i];
+
+    tagint *pairs;
+    memory->create(pairs,2*n,"special:pairs");
+
+    n = 0;
     for (i = 0; i < nlocal; i++)
       for (j = 0; j < num_bond[i]; j++)
-        buf[size++] = bond_atom[i][j];
+        add_pair(pairs,n,bond_atom[i][j],tag[i]);
 
-    // cycle buffer around ring of procs back to self
-    // when receive buffer, scan tags for atoms I own
-    // when find one, increment nspecial count for that atom
+    nrecv = irregular->send_to_owner(n,pairs,recv);
+    memory->destroy(pairs);
+  }
 
-    sptr = this;
-    comm->ring(size,sizeof(tagint),buf,1,ring_one,NULL);
+  for (i = 0; i < nlocal; i++) nspecial[i][0] = num_bond[i];
+  // replace atom ID of each received pair with local index of the atom
 
-    memory->destroy(buf);
+  for (i = 0; i < nrecv; i++) {
+    m = atom->map(recv[2*i]);
+    if (m < 0 || m >= nlocal)
+      error->one(FLERR,"Special list atom is not owned by receiving proc");
+    nspecial[m][0]++;
+    recv[2*i] = m;
   }
 
-  // ----------------------------------------------------
-  // create onetwo[i] = list of 1-2 neighbors for atom i
-  // ----------------------------------------------------
-
-  max = 0;
+  int max = 0;
   for (i = 0; i < nlocal; i++) max = MAX(max,nspecial[i][0]);
-
+  int maxall;
   MPI_Allreduce(&max,&maxall,1,MPI_INT,MPI_MAX,world);
 
   if (me == 0) {
@@ -142,110 +179,68 @@ void Special::build()
 
   memory->create(onetwo,nlocal,maxall,"special:onetwo");
 
-  // count = accumulating counter
-
+  int *count;
   memory->create(count,nlocal,"special:count");
   for (i = 0; i < nlocal; i++) count[i] = 0;
 
-  // add bond partners stored by atom to onetwo list
-
   for (i = 0; i < nlocal; i++)
     for (j = 0; j < num_bond[i]; j++)
       onetwo[i][count[i]++] = bond_atom[i][j];
 
-  // if newton_bond off, then done
-  // else only stored 1/2 of all bonds, so store other half
-
-  if (force->newton_bond) {
-
-    // nbufmax = largest buffer needed to hold info from any proc
-    // info for each atom = 2 global tags in each bond
-
-    nbuf = 0;
-    for (i = 0; i < nlocal; i++) nbuf += 2*num_bond[i];
-    memory->create(buf,nbuf,"special:buf");
-
-    // fill buffer with global tags of both atoms in bond
-
-    size = 0;
-    for (i = 0; i < nlocal; i++)
-      for (j = 0; j < num_bond[i]; j++) {
-        buf[size++] = tag[i];
-        buf[size++] = bond_atom[i][j];
-      }
-
-    // cycle buffer around ring of procs back to self
-    // when receive buffer, scan 2nd-atom tags for atoms I own
-    // when find one, add 1st-atom tag to onetwo list for 2nd atom
-
-    sptr = this;
-    comm->ring(size,sizeof(tagint),buf,2,ring_two,NULL);
-
-    memory->destroy(buf);
+  for (i = 0; i < nrecv; i++) {
+    m = recv[2*i];
+    onetwo[m][count[m]++] = recv[2*i+1];
   }
 
   memory->destroy(count);
+  memory->destroy(recv);
+}
 
-  // -----------------------------------------------------
-  // done if special_bond weights for 1-3, 1-4 are set to 1.0
-  // -----------------------------------------------------
-
-  if (force->special_lj[2] == 1.0 && force->special_coul[2] == 1.0 &&
-      force->special_lj[3] == 1.0 && force->special_coul[3] == 1.0) {
-    dedup();
-    combine();
-    fix_alteration();
-    return;
-  }
-
-  // -----------------------------------------------------
-  // compute nspecial[i][1] = # of 1-3 neighbors of atom i
-  // -----------------------------------------------------
+/* ----------------------------------------------------------------------
+   create onethree[i] = list of 1-3 neighbors for atom i
+   nspecial[i][1] = # of 1-3 neighbors of atom i
+   atoms I and K are 1-3 neighbors if both are 1-2 neighbors of atom J,
+     so owner of J sends K to owner of I for each pair in its 1-2 list
+   this may include duplicates but they will be culled later
+------------------------------------------------------------------------- */
 
-  // nbufmax = largest buffer needed to hold info from any proc
-  // info for each atom = 2 scalars + list of 1-2 neighbors
+void Special::onethree_build()
+{
+  int i,j,k,m,n;
 
-  nbuf = 0;
-  for (i = 0; i < nlocal; i++) nbuf += 2 + nspecial[i][0];
-  memory->create(buf,nbuf,"special:buf");
+  int nlocal = atom->nlocal;
+  int **nspecial = atom->nspecial;
 
-  // fill buffer with:
-  // (1) = counter for 1-3 neighbors, initialized to 0
-  // (2) = # of 1-2 neighbors
-  // (3:N) = list of 1-2 neighbors
+  n = 0;
+  for (i = 0; i < nlocal; i++) n += nspecial[i][0]*nspecial[i][0];
 
-  size = 0;
-  for (i = 0; i < nlocal; i++) {
-    buf[size++] = 0;
-    buf[size++] = nspecial[i][0];
-    for (j = 0; j < nspecial[i][0]; j++) buf[size++] = onetwo[i][j];
-  }
+  tagint *pairs;
+  memory->create(pairs,2*n,"special:pairs");
 
-  // cycle buffer around ring of procs back to self
-  // when receive buffer, scan list of 1-2 neighbors for atoms I own
-  // when find one, increment 1-3 count by # of 1-2 neighbors of my atom,
-  //   subtracting one since my list will contain original atom
+  n = 0;
+  for (i = 0; i < nlocal; i++)
+    for (j = 0; j < nspecial[i][0]; j++)
+      for (k = 0; k < nspecial[i][0]; k++)
+        if (onetwo[i][j] != onetwo[i][k])
+          add_pair(pairs,n,onetwo[i][j],onetwo[i][k]);
 
-  sptr = this;
-  comm->ring(size,sizeof(tagint),buf,3,ring_three,buf);
+  tagint *recv;
+  int nrecv = irregular->send_to_owner(n,pairs,recv);
+  memory->destroy(pairs);
 
-  // extract count from buffer that has cycled back to me
-  // nspecial[i][1] = # of 1-3 neighbors of atom i
+  // replace atom ID of each received pair with local index of the atom
 
-  j = 0;
-  for (i = 0; i < nlocal; i++) {
-    nspecial[i][1] = buf[j];
-    j += 2 + nspecial[i][0];
+  for (i = 0; i < nrecv; i++) {
+    m = atom->map(recv[2*i]);
+    if (m < 0 || m >= nlocal)
+      error->one(FLERR,"Special list atom is not owned by receiving proc");
+    nspecial[m][1]++;
+    recv[2*i] = m;
   }
 
-  memory->destroy(buf);
-
-  // ----------------------------------------------------
-  // create onethree[i] = list of 1-3 neighbors for atom i
-  // ----------------------------------------------------
-
-  max = 0;
+  int max = 0;
   for (i = 0; i < nlocal; i++) max = MAX(max,nspecial[i][1]);
+  int maxall;
   MPI_Allreduce(&max,&maxall,1,MPI_INT,MPI_MAX,world);
 
   if (me == 0) {
@@ -255,114 +250,63 @@ void Special::build()
 
   memory->create(onethree,nlocal,maxall,"special:onethree");
 
-  // nbufmax = largest buffer needed to hold info from any proc
-  // info for each atom = 4 scalars + list of 1-2 neighs + list of 1-3 neighs
-
-  nbuf = 0;
-  for (i = 0; i < nlocal; i++) nbuf += 4 + nspecial[i][0] + nspecial[i][1];
-  memory->create(buf,nbuf,"special:buf");
-
-  // fill buffer with:
-  // (1) = global tag of original atom
-  // (2) = # of 1-2 neighbors
-  // (3) = # of 1-3 neighbors
-  // (4) = counter for 1-3 neighbors, initialized to 0
-  // (5:N) = list of 1-2 neighbors
-  // (N+1:2N) space for list of 1-3 neighbors
-
-  size = 0;
-  for (i = 0; i < nlocal; i++) {
-    buf[size++] = tag[i];
-    buf[size++] = nspecial[i][0];
-    buf[size++] = nspecial[i][1];
-    buf[size++] = 0;
-    for (j = 0; j < nspecial[i][0]; j++) buf[size++] = onetwo[i][j];
-    size += nspecial[i][1];
-  }
-
-  // cycle buffer around ring of procs back to self
-  // when receive buffer, scan list of 1-2 neighbors for atoms I own
-  // when find one, add its neighbors to 1-3 list
-  //   increment the count in buf(i+4)
-  //   exclude the atom whose tag = original
-  //   this process may include duplicates but they will be culled later
-
-  sptr = this;
-  comm->ring(size,sizeof(tagint),buf,4,ring_four,buf);
-
-  // fill onethree with buffer values that have been returned to me
-  // sanity check: accumulated buf[i+3] count should equal
-  //   nspecial[i][1] for each atom
+  int *count;
+  memory->create(count,nlocal,"special:count");
+  for (i = 0; i < nlocal; i++) count[i] = 0;
 
-  j = 0;
-  for (i = 0; i < nlocal; i++) {
-    if (buf[j+3] != nspecial[i][1])
-      error->one(FLERR,"1-3 bond count is inconsistent");
-    j += 4 + nspecial[i][0];
-    for (k = 0; k < nspecial[i][1]; k++)
-      onethree[i][k] = buf[j++];
+  for (i = 0; i < nrecv; i++) {
+    m = recv[2*i];
+    onethree[m][count[m]++] = recv[2*i+1];
   }
 
-  memory->destroy(buf);
-
-  // done if special_bond weights for 1-4 are set to 1.0
-
-  if (force->special_lj[3] == 1.0 && force->special_coul[3] == 1.0) {
-    dedup();
-    if (force->special_angle) angle_trim();
-    combine();
-    fix_alteration();
-    return;
-  }
+  memory->destroy(count);
+  memory->destroy(recv);
+}
 
-  // -----------------------------------------------------
-  // compute nspecial[i][2] = # of 1-4 neighbors of atom i
-  // -----------------------------------------------------
+/* ----------------------------------------------------------------------
+   create onefour[i] = list of 1-4 neighbors for atom i
+   nspecial[i][2] = # of 1-4 neighbors of atom i
+   atom L is a 1-4 neighbor of atom I if it is a 1-2 neighbor of atom J
+     and J is a 1-3 neighbor of I, so owner of J sends L to owner of I
+   this may include duplicates and original atom but they will be culled later
+------------------------------------------------------------------------- */
 
-  // nbufmax = largest buffer needed to hold info from any proc
-  // info for each atom = 2 scalars + list of 1-3 neighbors
+void Special::onefour_build()
+{
+  int i,j,k,m,n;
 
-  nbuf = 0;
-  for (i = 0; i < nlocal; i++) nbuf += 2 + nspecial[i][1];
-  memory->create(buf,nbuf,"special:buf");
+  int nlocal = atom->nlocal;
+  int **nspecial = atom->nspecial;
 
-  // fill buffer with:
-  // (1) = counter for 1-4 neighbors, initialized to 0
-  // (2) = # of 1-3 neighbors
-  // (3:N) = list of 1-3 neighbors
+  n = 0;
+  for (i = 0; i < nlocal; i++) n += nspecial[i][1]*nspecial[i][0];
 
-  size = 0;
-  for (i = 0; i < nlocal; i++) {
-    buf[size++] = 0;
-    buf[size++] = nspecial[i][1];
-    for (j = 0; j < nspecial[i][1]; j++) buf[size++] = onethree[i][j];
-  }
+  tagint *pairs;
+  memory->create(pairs,2*n,"special:pairs");
 
-  // cycle buffer around ring of procs back to self
-  // when receive buffer, scan list of 1-3 neighbors for atoms I own
-  // when find one, increment 1-4 count by # of 1-2 neighbors of my atom
-  //   may include duplicates and original atom but they will be culled later
+  n = 0;
+  for (i = 0; i < nlocal; i++)
+    for (j = 0; j < nspecial[i][1]; j++)
+      for (k = 0; k < nspecial[i][0]; k++)
+        add_pair(pairs,n,onethree[i][j],onetwo[i][k]);
 
-  sptr = this;
-  comm->ring(size,sizeof(tagint),buf,5,ring_five,buf);
+  tagint *recv;
+  int nrecv = irregular->send_to_owner(n,pairs,recv);
+  memory->destroy(pairs);
 
-  // extract count from buffer that has cycled back to me
-  // nspecial[i][2] = # of 1-4 neighbors of atom i
+  // replace atom ID of each received pair with local index of the atom
 
-  j = 0;
-  for (i = 0; i < nlocal; i++) {
-    nspecial[i][2] = buf[j];
-    j += 2 + nspecial[i][1];
+  for (i = 0; i < nrecv; i++) {
+    m = atom->map(recv[2*i]);
+    if (m < 0 || m >= nlocal)
+      error->one(FLERR,"Special list atom is not owned by receiving proc");
+    nspecial[m][2]++;
+    recv[2*i] = m;
   }
 
-  memory->destroy(buf);
-
-  // ----------------------------------------------------
-  // create onefour[i] = list of 1-4 neighbors for atom i
-  // ----------------------------------------------------
-
-  max = 0;
+  int max = 0;
   for (i = 0; i < nlocal; i++) max = MAX(max,nspecial[i][2]);
+  int maxall;
   MPI_Allreduce(&max,&maxall,1,MPI_INT,MPI_MAX,world);
 
   if (me == 0) {
@@ -372,59 +316,17 @@ void Special::build()
 
   memory->create(onefour,nlocal,maxall,"special:onefour");
 
-  // nbufmax = largest buffer needed to hold info from any proc
-  // info for each atom = 3 scalars + list of 1-3 neighs + list of 1-4 neighs
-
-  nbuf = 0;
-  for (i = 0; i < nlocal; i++)
-    nbuf += 3 + nspecial[i][1] + nspecial[i][2];
-  memory->create(buf,nbuf,"special:buf");
-
-  // fill buffer with:
-  // (1) = # of 1-3 neighbors
-  // (2) = # of 1-4 neighbors
-  // (3) = counter for 1-4 neighbors, initialized to 0
-  // (4:N) = list of 1-3 neighbors
-  // (N+1:2N) space for list of 1-4 neighbors
-
-  size = 0;
-  for (i = 0; i < nlocal; i++) {
-    buf[size++] = nspecial[i][1];
-    buf[size++] = nspecial[i][2];
-    buf[size++] = 0;
-    for (j = 0; j < nspecial[i][1]; j++) buf[size++] = onethree[i][j];
-    size += nspecial[i][2];
-  }
-
-  // cycle buffer around ring of procs back to self
-  // when receive buffer, scan list of 1-3 neighbors for atoms I own
-  // when find one, add its neighbors to 1-4 list
-  //   incrementing the count in buf(i+4)
-  //   this process may include duplicates but they will be culled later
-
-  sptr = this;
-  comm->ring(size,sizeof(tagint),buf,6,ring_six,buf);
-
-  // fill onefour with buffer values that have been returned to me
-  // sanity check: accumulated buf[i+2] count should equal
-  //  nspecial[i][2] for each atom
+  int *count;
+  memory->create(count,nlocal,"special:count");
+  for (i = 0; i < nlocal; i++) count[i] = 0;
 
-  j = 0;
-  for (i = 0; i < nlocal; i++) {
-    if (buf[j+2] != nspecial[i][2])
-      error->one(FLERR,"1-4 bond count is inconsistent");
-    j += 3 + nspecial[i][1];
-    for (k = 0; k < nspecial[i][2]; k++)
-      onefour[i][k] = buf[j++];
+  for (i = 0; i < nrecv; i++) {
+    m = recv[2*i];
+    onefour[m][count[m]++] = recv[2*i+1];
   }
 
-  memory->destroy(buf);
-
-  dedup();
-  if (force->special_angle) angle_trim();
-  if (force->special_dihedral) dihedral_trim();
-  combine();
-  fix_alteration();
+  memory->destroy(count);
+  memory->destroy(recv);
 }
 
 /* ----------------------------------------------------------------------
@@ -662,6 +564,7 @@ void Special::combine()
 void Special::angle_trim()
 {
   int i,j,m,n;
+  int **dflag;
 
   int *num_angle = atom->num_angle;
   int *num_dihedral = atom->num_dihedral;
@@ -706,44 +609,49 @@ void Special::angle_trim()
       for (j = 0; j < n; j++) dflag[i][j] = 0;
     }
 
-    // nbufmax = largest buffer needed to hold info from any proc
-    // info for each atom = list of 1,3 atoms in each angle stored by atom
-    //   and list of 1,3 and 2,4 atoms in each dihedral stored by atom
+    // send I,J pair of 1,3 atoms in each angle stored by atom to owner of I
+    //   and J,I pair to owner of J
+    // same for 1,3 and 2,4 atoms in each dihedral stored by atom
 
-    int nbuf = 0;
+    n = 0;
     for (i = 0; i < nlocal; i++) {
-      if (num_angle && atom->nangles) nbuf += 2*num_angle[i];
-      if (num_dihedral && atom->ndihedrals) nbuf += 2*2*num_dihedral[i];
+      if (num_angle && atom->nangles) n += 2*num_angle[i];
+      if (num_dihedral && atom->ndihedrals) n += 2*2*num_dihedral[i];
     }
-    int *buf;
-    memory->create(buf,nbuf,"special:buf");
+    tagint *pairs;
+    memory->create(pairs,2*n,"special:pairs");
 
-    // fill buffer with list of 1,3 atoms in each angle
-    // and with list of 1,3 and 2,4 atoms in each dihedral
-
-    int size = 0;
+    n = 0;
     if (num_angle && atom->nangles)
       for (i = 0; i < nlocal; i++)
         for (j = 0; j < num_angle[i]; j++) {
-          buf[size++] = angle_atom1[i][j];
-          buf[size++] = angle_atom3[i][j];
+          add_pair(pairs,n,angle_atom1[i][j],angle_atom3[i][j]);
+          add_pair(pairs,n,angle_atom3[i][j],angle_atom1[i][j]);
         }
 
     if (num_dihedral && atom->ndihedrals)
       for (i = 0; i < nlocal; i++)
         for (j = 0; j < num_dihedral[i]; j++) {
-          buf[size++] = dihedral_atom1[i][j];
-          buf[size++] = dihedral_atom3[i][j];
-          buf[size++] = dihedral_atom2[i][j];
-          buf[size++] = dihedral_atom4[i][j];
+          add_pair(pairs,n,dihedral_atom1[i][j],dihedral_atom3[i][j]);
+          add_pair(pairs,n,dihedral_atom3[i][j],dihedral_atom1[i][j]);
+          add_pair(pairs,n,dihedral_atom2[i][j],dihedral_atom4[i][j]);
+          add_pair(pairs,n,dihedral_atom4[i][j],dihedral_atom2[i][j]);
         }
 
-    // cycle buffer around ring of procs back to self
-    // when receive buffer, scan list of 1,3 atoms looking for atoms I own
-    // when find one, scan its 1-3 neigh list and mark I,J as in an angle
+    tagint *recv;
+    int nrecv = irregular->send_to_owner(n,pairs,recv);
+    memory->destroy(pairs);
+
+    // for each pair received, mark J as in an angle in 1-3 neigh list of I
 
-    sptr = this;
-    comm->ring(size,sizeof(tagint),buf,7,ring_seven,NULL);
+    for (n = 0; n < nrecv; n++) {
+      i = atom->map(recv[2*n]);
+      for (m = 0; m < nspecial[i][1]; m++)
+        if (recv[2*n+1] == onethree[i][m]) {
+          dflag[i][m] = 1;
+          break;
+        }
+    }
 
     // delete 1-3 neighbors if they are not flagged in dflag
 
@@ -757,7 +665,7 @@ void Special::angle_trim()
     // clean up
 
     memory->destroy(dflag);
-    memory->destroy(buf);
+    memory->destroy(recv);
 
   // if no angles or dihedrals are defined, delete all 1-3 neighs
 
@@ -789,6 +697,7 @@ void Special::angle_trim()
 void Special::dihedral_trim()
 {
   int i,j,m,n;
+  int **dflag;
 
   int *num_dihedral = atom->num_dihedral;
   tagint **dihedral_atom1 = atom->dihedral_atom1;
@@ -827,29 +736,35 @@ void Special::dihedral_trim()
       for (j = 0; j < n; j++) dflag[i][j] = 0;
     }
 
-    // nbufmax = largest buffer needed to hold info from any proc
-    // info for each atom = list of 1,4 atoms in each dihedral stored by atom
+    // send I,J pair of 1,4 atoms in each dihedral stored by atom to owner of I
+    //   and J,I pair to owner of J
 
-    int nbuf = 0;
-    for (i = 0; i < nlocal; i++) nbuf += 2*num_dihedral[i];
-    int *buf;
-    memory->create(buf,nbuf,"special:buf");
+    n = 0;
+    for (i = 0; i < nlocal; i++) n += 2*num_dihedral[i];
+    tagint *pairs;
+    memory->create(pairs,2*n,"special:pairs");
 
-    // fill buffer with list of 1,4 atoms in each dihedral
-
-    int size = 0;
+    n = 0;
     for (i = 0; i < nlocal; i++)
       for (j = 0; j < num_dihedral[i]; j++) {
-        buf[size++] = dihedral_atom1[i][j];
-        buf[size++] = dihedral_atom4[i][j];
+        add_pair(pairs,n,dihedral_atom1[i][j],dihedral_atom4[i][j]);
+        add_pair(pairs,n,dihedral_atom4[i][j],dihedral_atom1[i][j]);
       }
 
-    // cycle buffer around ring of procs back to self
-    // when receive buffer, scan list of 1,4 atoms looking for atoms I own
-    // when find one, scan its 1-4 neigh list and mark I,J as in a dihedral
+    tagint *recv;
+    int nrecv = irregular->send_to_owner(n,pairs,recv);
+    memory->destroy(pairs);
 
-    sptr = this;
-    comm->ring(size,sizeof(tagint),buf,8,ring_eight,NULL);
+    // for each pair received, mark J as in a dihedral in 1-4 neigh list of I
+
+    for (n = 0; n < nrecv; n++) {
+      i = atom->map(recv[2*n]);
+      for (m = 0; m < nspecial[i][2]; m++)
+        if (recv[2*n+1] == onefour[i][m]) {
+          dflag[i][m] = 1;
+          break;
+        }
+    }
 
     // delete 1-4 neighbors if they are not flagged in dflag
 
@@ -863,7 +778,7 @@ void Special::dihedral_trim()
     // clean up
 
     memory->destroy(dflag);
-    memory->destroy(buf);
+    memory->destroy(recv);
 
   // if no dihedrals are defined, delete all 1-4 neighs
 
@@ -887,257 +802,6 @@ void Special::dihedral_trim()
   }
 }
 
-/* ----------------------------------------------------------------------
-   when receive buffer, scan tags for atoms I own
-   when find one, increment nspecial count for that atom
-------------------------------------------------------------------------- */
-
-void Special::ring_one(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint *buf = (tagint *) cbuf;
-  int m;
-
-  for (int i = 0; i < ndatum; i++) {
-    m = atom->map(buf[i]);
-    if (m >= 0 && m < nlocal) nspecial[m][0]++;
-  }
-}
-
-/* ----------------------------------------------------------------------
-   when receive buffer, scan 2nd-atom tags for atoms I own
-   when find one, add 1st-atom tag to onetwo list for 2nd atom
-------------------------------------------------------------------------- */
-
-void Special::ring_two(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int nlocal = atom->nlocal;
-
-  tagint **onetwo = sptr->onetwo;
-  int *count = sptr->count;
-
-  tagint *buf = (tagint *) cbuf;
-  int m;
-
-  for (int i = 1; i < ndatum; i += 2) {
-    m = atom->map(buf[i]);
-    if (m >= 0 && m < nlocal) onetwo[m][count[m]++] = buf[i-1];
-  }
-}
-
-/* ----------------------------------------------------------------------
-   when receive buffer, scan list of 1-2 neighbors for atoms I own
-   when find one, increment 1-3 count by # of 1-2 neighbors of my atom,
-     subtracting one since my list will contain original atom
-------------------------------------------------------------------------- */
-
-void Special::ring_three(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint *buf = (tagint *) cbuf;
-  int i,j,m,n,num12;
-
-  i = 0;
-  while (i < ndatum) {
-    n = buf[i];
-    num12 = buf[i+1];
-    for (j = 0; j < num12; j++) {
-      m = atom->map(buf[i+2+j]);
-      if (m >= 0 && m < nlocal)
-        n += nspecial[m][0] - 1;
-    }
-    buf[i] = n;
-    i += 2 + num12;
-  }
-}
-
-/* ----------------------------------------------------------------------
-  when receive buffer, scan list of 1-2 neighbors for atoms I own
-  when find one, add its neighbors to 1-3 list
-    increment the count in buf(i+4)
-    exclude the atom whose tag = original
-    this process may include duplicates but they will be culled later
-------------------------------------------------------------------------- */
-
-void Special::ring_four(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint **onetwo = sptr->onetwo;
-
-  tagint *buf = (tagint *) cbuf;
-  tagint original;
-  int i,j,k,m,n,num12,num13;
-
-  i = 0;
-  while (i < ndatum) {
-    original = buf[i];
-    num12 = buf[i+1];
-    num13 = buf[i+2];
-    n = buf[i+3];
-    for (j = 0; j < num12; j++) {
-      m = atom->map(buf[i+4+j]);
-      if (m >= 0 && m < nlocal)
-        for (k = 0; k < nspecial[m][0]; k++)
-          if (onetwo[m][k] != original)
-            buf[i+4+num12+(n++)] = onetwo[m][k];
-    }
-    buf[i+3] = n;
-    i += 4 + num12 + num13;
-  }
-}
-
-/* ----------------------------------------------------------------------
-   when receive buffer, scan list of 1-3 neighbors for atoms I own
-   when find one, increment 1-4 count by # of 1-2 neighbors of my atom
-     may include duplicates and original atom but they will be culled later
-------------------------------------------------------------------------- */
-
-void Special::ring_five(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint *buf = (tagint *) cbuf;
-  int i,j,m,n,num13;
-
-  i = 0;
-  while (i < ndatum) {
-    n = buf[i];
-    num13 = buf[i+1];
-    for (j = 0; j < num13; j++) {
-      m = atom->map(buf[i+2+j]);
-      if (m >= 0 && m < nlocal) n += nspecial[m][0];
-    }
-      buf[i] = n;
-      i += 2 + num13;
-  }
-}
-
-/* ----------------------------------------------------------------------
-   when receive buffer, scan list of 1-3 neighbors for atoms I own
-   when find one, add its neighbors to 1-4 list
-     incrementing the count in buf(i+4)
-     this process may include duplicates but they will be culled later
-------------------------------------------------------------------------- */
-
-void Special::ring_six(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint **onetwo = sptr->onetwo;
-
-  tagint *buf = (tagint *) cbuf;
-  int i,j,k,m,n,num13,num14;
-
-  i = 0;
-  while (i < ndatum) {
-    num13 = buf[i];
-    num14 = buf[i+1];
-    n = buf[i+2];
-    for (j = 0; j < num13; j++) {
-      m = atom->map(buf[i+3+j]);
-      if (m >= 0 && m < nlocal)
-        for (k = 0; k < nspecial[m][0]; k++)
-          buf[i+3+num13+(n++)] = onetwo[m][k];
-    }
-    buf[i+2] = n;
-    i += 3 + num13 + num14;
-  }
-}
-
-/* ----------------------------------------------------------------------
-   when receive buffer, scan list of 1,3 atoms looking for atoms I own
-   when find one, scan its 1-3 neigh list and mark I,J as in an angle
-------------------------------------------------------------------------- */
-
-void Special::ring_seven(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint **onethree = sptr->onethree;
-  int **dflag = sptr->dflag;
-
-  tagint *buf = (tagint *) cbuf;
-  tagint iglobal,jglobal;
-  int i,m,ilocal,jlocal;
-
-  i = 0;
-  while (i < ndatum) {
-    iglobal = buf[i];
-    jglobal = buf[i+1];
-    ilocal = atom->map(iglobal);
-    jlocal = atom->map(jglobal);
-    if (ilocal >= 0 && ilocal < nlocal)
-      for (m = 0; m < nspecial[ilocal][1]; m++)
-        if (jglobal == onethree[ilocal][m]) {
-          dflag[ilocal][m] = 1;
-          break;
-        }
-    if (jlocal >= 0 && jlocal < nlocal)
-      for (m = 0; m < nspecial[jlocal][1]; m++)
-        if (iglobal == onethree[jlocal][m]) {
-          dflag[jlocal][m] = 1;
-          break;
-        }
-    i += 2;
-  }
-}
-
-/* ----------------------------------------------------------------------
-   when receive buffer, scan list of 1,4 atoms looking for atoms I own
-   when find one, scan its 1-4 neigh list and mark I,J as in a dihedral
-------------------------------------------------------------------------- */
-
-void Special::ring_eight(int ndatum, char *cbuf)
-{
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint **onefour = sptr->onefour;
-  int **dflag = sptr->dflag;
-
-  tagint *buf = (tagint *) cbuf;
-  tagint iglobal,jglobal;
-  int i,m,ilocal,jlocal;
-
-  i = 0;
-  while (i < ndatum) {
-    iglobal = buf[i];
-    jglobal = buf[i+1];
-    ilocal = atom->map(iglobal);
-    jlocal = atom->map(jglobal);
-    if (ilocal >= 0 && ilocal < nlocal)
-      for (m = 0; m < nspecial[ilocal][2]; m++)
-        if (jglobal == onefour[ilocal][m]) {
-          dflag[ilocal][m] = 1;
-          break;
-        }
-    if (jlocal >= 0 && jlocal < nlocal)
-      for (m = 0; m < nspecial[jlocal][2]; m++)
-        if (iglobal == onefour[jlocal][m]) {
-          dflag[jlocal][m] = 1;
-          break;
-        }
-    i += 2;
-  }
-}
-
 /* ----------------------------------------------------------------------
    allow fixes to alter special list
    currently, only fix drude does this
@@ -28,10 +28,11 @@ class Special : protected Pointers {
   int me,nprocs;
   tagint **onetwo,**onethree,**onefour;
 
-  // data used by ring callback methods
+  class Irregular *irregular;   // rendezvous on atom IDs
 
-  int *count;
-  int **dflag;
+  void onetwo_build();
+  void onethree_build();
+  void onefour_build();
 
   void dedup();
   void angle_trim();
@@ -39,18 +40,13 @@ class Special : protected Pointers {
   void combine();
   void fix_alteration();
 
-  // static variable for ring communication callback to access class data
-  // callback functions for ring communication
-
-  static Special *sptr;
-  static void ring_one(int, char *);
-  static void ring_two(int, char *);
-  static void ring_three(int, char *);
-  static void ring_four(int, char *);
-  static void ring_five(int, char *);
-  static void ring_six(int, char *);
-  static void ring_seven(int, char *);
-  static void ring_eight(int, char *);
+  // append pair of atom IDs to list of N pairs
+
+  inline void add_pair(tagint *pairs, int &n, tagint i, tagint j) {
+    pairs[2*n] = i;
+    pairs[2*n+1] = j;
+    n++;
+  }
 };
 
 }
@@ -59,16 +55,10 @@ class Special : protected Pointers {
 
 /* ERROR/WARNING messages:
 
-E: 1-3 bond count is inconsistent
-
-An inconsistency was detected when computing the number of 1-3
-neighbors for each atom.  This likely means something is wrong with
-the bond topologies you have defined.
-
-E: 1-4 bond count is inconsistent
+E: Special list atom is not owned by receiving proc
 
-An inconsistency was detected when computing the number of 1-4
-neighbors for each atom.  This likely means something is wrong with
-the bond topologies you have defined.
+A 1-2, 1-3, or 1-4 neighbor was sent to a processor that does not own
+the atom it belongs to.  This is an internal LAMMPS error.  Please
+report it to the developers.
 
 */
@@ -42,6 +42,7 @@
 #include "improper.h"
 #include "kspace.h"
 #include "output.h"
+#include "dump.h"
 #include "timer.h"
 #include "math_const.h"
 #include "memory.h"
@@ -301,6 +302,19 @@ void Thermo::init()
     variables[i] = ivariable;
   }
 
+  // find Timer detail index for each per-object timer
+  // fix, compute, dump timers are those of the current objects with that ID
+  // pair timers are registered by pair hybrid for each sub-style
+
+  for (i = 0; i < ntimer; i++) {
+    timers[i] = find_timer(id_timer[i]);
+    if (timers[i] < 0) {
+      char str[128];
+      snprintf(str,128,"Could not find thermo timer ID %s",id_timer[i]);
+      error->all(FLERR,str);
+    }
+  }
+
   // set ptrs to keyword-specific Compute objects
 
   if (index_temp >= 0) temperature = computes[index_temp];
@@ -347,17 +361,17 @@ void Thermo::compute(int flag)
   for (i = 0; i < ncompute; i++)
     if (compute_which[i] == SCALAR) {
       if (!(computes[i]->invoked_flag & INVOKED_SCALAR)) {
-        computes[i]->compute_scalar();
+        computes[i]->invoke_scalar();
         computes[i]->invoked_flag |= INVOKED_SCALAR;
       }
     } else if (compute_which[i] == VECTOR) {
       if (!(computes[i]->invoked_flag & INVOKED_VECTOR)) {
-        computes[i]->compute_vector();
+        computes[i]->invoke_vector();
         computes[i]->invoked_flag |= INVOKED_VECTOR;
       }
     } else if (compute_which[i] == ARRAY) {
       if (!(computes[i]->invoked_flag & INVOKED_ARRAY)) {
-        computes[i]->compute_array();
+        computes[i]->invoke_array();
         computes[i]->invoked_flag |= INVOKED_ARRAY;
       }
     }
@@ -661,6 +675,10 @@ void Thermo::allocate()
   nvariable = 0;
   id_variable = new char*[n];
   variables = new int[n];
+
+  ntimer = 0;
+  id_timer = new char*[n];
+  timers = new int[n];
 }
 
 /* ----------------------------------------------------------------------
@@ -697,6 +715,10 @@ void Thermo::deallocate()
   for (int i = 0; i < nvariable; i++) delete [] id_variable[i];
   delete [] id_variable;
   delete [] variables;
+
+  for (int i = 0; i < ntimer; i++) delete [] id_timer[i];
+  delete [] id_timer;
+  delete [] timers;
 }
 
 /* ----------------------------------------------------------------------
@@ -880,6 +902,16 @@ void Thermo::parse_fields(char *str)
     } else if (strcmp(word,"cellgamma") == 0) {
       addfield("CellGamma",&Thermo::compute_cellgamma,FLOAT);
 
+    // per-object timer = timer/kind/ID, kind = fix, compute, dump, pair
+    // ID is checked against existing objects in init()
+
+    } else if (strncmp(word,"timer/",6) == 0) {
+      if (strncmp(&word[6],"fix/",4) && strncmp(&word[6],"compute/",8) &&
+          strncmp(&word[6],"dump/",5) && strncmp(&word[6],"pair/",5))
+        error->all(FLERR,"Unknown keyword in thermo_style custom command");
+      field2index[nfield] = add_timer(&word[6]);
+      addfield(word,&Thermo::compute_timer,FLOAT);
+
     // compute value = c_ID, fix value = f_ID, variable value = v_ID
     // count trailing [] and store int arguments
 
@@ -1050,6 +1082,65 @@ int Thermo::add_variable(const char *id)
   return nvariable-1;
 }
 
+/* ----------------------------------------------------------------------
+   add per-object timer name to list of Timer details to output
+------------------------------------------------------------------------- */
+
+int Thermo::add_timer(const char *id)
+{
+  int n = strlen(id) + 1;
+  id_timer[ntimer] = new char[n];
+  strcpy(id_timer[ntimer],id);
+  ntimer++;
+  return ntimer-1;
+}
+
+/* ----------------------------------------------------------------------
+   return Timer detail index of object named kind/ID, -1 if no such object
+   pair sub-style ID is its style name, Mth instance of a style is style:M
+------------------------------------------------------------------------- */
+
+int Thermo::find_timer(const char *name)
+{
+  if (strncmp(name,"fix/",4) == 0) {
+    int ifix = modify->find_fix(&name[4]);
+    if (ifix < 0) return -1;
+    return modify->fix[ifix]->itimer;
+  }
+
+  if (strncmp(name,"compute/",8) == 0) {
+    int icompute = modify->find_compute(&name[8]);
+    if (icompute < 0) return -1;
+    return modify->compute[icompute]->itimer;
+  }
+
+  if (strncmp(name,"dump/",5) == 0) {
+    for (int idump = 0; idump < output->ndump; idump++)
+      if (strcmp(&name[5],output->dump[idump]->id) == 0)
+        return output->dump[idump]->itimer;
+    return -1;
+  }
+
+  // pair/style or pair/style:M must match a current hybrid sub-style
+
+  if (force->pair == NULL || strstr(force->pair_style,"hybrid") == NULL)
+    return -1;
+
+  int n = strlen(&name[5]) + 1;
+  char *word = new char[n];
+  strcpy(word,&name[5]);
+  int nsub = 0;
+  char *ptr = strrchr(word,':');
+  if (ptr) {
+    *ptr = '\0';
+    nsub = atoi(ptr+1);
+  }
+  Pair *pair = force->pair_match(word,1,nsub);
+  delete [] word;
+  if (pair == NULL) return -1;
+  return timer->find_detail(name);
+}
+
 /* ----------------------------------------------------------------------
    compute a single thermodynamic value, word is any keyword in custom list
    called when a variable is evaluated by Variable class
@@ -1148,7 +1239,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->invoke_scalar();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     compute_temp();
@@ -1162,7 +1253,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_SCALAR)) {
-      pressure->compute_scalar();
+      pressure->invoke_scalar();
       pressure->invoked_flag |= INVOKED_SCALAR;
     }
     compute_press();
@@ -1176,7 +1267,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else {
-      pe->compute_scalar();
+      pe->invoke_scalar();
       pe->invoked_flag |= INVOKED_SCALAR;
     }
     compute_pe();
@@ -1190,7 +1281,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->invoke_scalar();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     compute_ke();
@@ -1204,7 +1295,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else {
-      pe->compute_scalar();
+      pe->invoke_scalar();
       pe->invoked_flag |= INVOKED_SCALAR;
     }
     if (!temperature)
@@ -1215,7 +1306,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->invoke_scalar();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     compute_etotal();
@@ -1229,7 +1320,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else {
-      pe->compute_scalar();
+      pe->invoke_scalar();
       pe->invoked_flag |= INVOKED_SCALAR;
     }
     if (!temperature)
@@ -1240,7 +1331,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(temperature->invoked_flag & INVOKED_SCALAR)) {
-      temperature->compute_scalar();
+      temperature->invoke_scalar();
       temperature->invoked_flag |= INVOKED_SCALAR;
     }
     if (!pressure)
@@ -1251,7 +1342,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_SCALAR)) {
-      pressure->compute_scalar();
+      pressure->invoke_scalar();
       pressure->invoked_flag |= INVOKED_SCALAR;
     }
     compute_enthalpy();
@@ -1377,7 +1468,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->invoke_vector();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pxx();
@@ -1391,7 +1482,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->invoke_vector();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pyy();
@@ -1405,7 +1496,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->invoke_vector();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pzz();
@@ -1419,7 +1510,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->invoke_vector();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pxy();
@@ -1433,7 +1524,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->invoke_vector();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pxz();
@@ -1447,7 +1538,7 @@ int Thermo::evaluate_keyword(char *word, double *answer)
         error->all(FLERR,"Compute used in variable thermo keyword between runs "
                    "is not current");
     } else if (!(pressure->invoked_flag & INVOKED_VECTOR)) {
-      pressure->compute_vector();
+      pressure->invoke_vector();
       pressure->invoked_flag |= INVOKED_VECTOR;
     }
     compute_pyz();
@@ -1552,6 +1643,17 @@ void Thermo::compute_variable()
   }
 }
 
+/* ----------------------------------------------------------------------
+   accumulated wall time of one object in current run, max across procs
+   0.0 if timer style is not detail or object has not been timed
+------------------------------------------------------------------------- */
+
+void Thermo::compute_timer()
+{
+  double one = timer->get_detail_wall(timers[field2index[ifield]]);
+  MPI_Allreduce(&one,&dvalue,1,MPI_DOUBLE,MPI_MAX,world);
+}
+
 /* ----------------------------------------------------------------------
    one method for every keyword thermo can output
    called by compute() or evaluate_keyword()
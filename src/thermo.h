@@ -99,6 +99,10 @@ class Thermo : protected Pointers {
   char **id_variable;          // list of variable names
   int *variables;              // list of Variable indices
 
+  int ntimer;                  // # of per-object timers output by thermo
+  char **id_timer;             // their Timer detail names
+  int *timers;                 // list of Timer detail indices
+
   // private methods
 
   void allocate();
@@ -108,6 +112,8 @@ class Thermo : protected Pointers {
   int add_compute(const char *, int);
   int add_fix(const char *);
   int add_variable(const char *);
+  int add_timer(const char *);
+  int find_timer(const char *);
 
   typedef void (Thermo::*FnPtr)();
   void addfield(const char *, FnPtr, int);
@@ -116,6 +122,7 @@ class Thermo : protected Pointers {
   void compute_compute();      // functions that compute a single value
   void compute_fix();          // via calls to  Compute,Fix,Variable classes
   void compute_variable();
+  void compute_timer();
 
   // functions that compute a single value
   // customize a new keyword by adding a method prototype
@@ -227,6 +234,11 @@ E: Could not find thermo variable name
 
 Self-explanatory.
 
+E: Could not find thermo timer ID %s
+
+No fix, compute, dump, or pair hybrid sub-style with that ID exists
+for a timer/kind/ID keyword.
+
 E: Too many total atoms
 
 See the setting for bigint in the src/lmptype.h file.
@@ -12,6 +12,7 @@
 ------------------------------------------------------------------------- */
 
 #include <mpi.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include "timer.h"
@@ -99,17 +100,46 @@ Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
   _s_timeout = -1;
   _checkfreq = 10;
   _nextcheck = -1;
+
+  ndetail = maxdetail = 0;
+  detail_name = detail_style = NULL;
+  detail_cpu = detail_wall = NULL;
+  detail_cpu_start = detail_wall_start = NULL;
+  detail_depth = NULL;
+
   this->_stamp(RESET);
 }
 
 /* ---------------------------------------------------------------------- */
 
+Timer::~Timer()
+{
+  for (int i = 0; i < ndetail; i++) {
+    delete [] detail_name[i];
+    delete [] detail_style[i];
+  }
+  memory->sfree(detail_name);
+  memory->sfree(detail_style);
+  memory->destroy(detail_cpu);
+  memory->destroy(detail_wall);
+  memory->destroy(detail_cpu_start);
+  memory->destroy(detail_wall_start);
+  memory->destroy(detail_depth);
+}
+
+/* ---------------------------------------------------------------------- */
+
 void Timer::init()
 {
   for (int i = 0; i < NUM_TIMER; i++) {
     cpu_array[i] = 0.0;
     wall_array[i] = 0.0;
   }
+
+  for (int i = 0; i < ndetail; i++) {
+    detail_cpu[i] = detail_wall[i] = 0.0;
+    detail_depth[i] = 0;
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -152,6 +182,80 @@ void Timer::_stamp(enum ttype which)
   }
 }
 
+/* ----------------------------------------------------------------------
+   return index of per-object timer for object of kind with ID and style
+   timer is named kind/ID, create it if it does not exist
+   called by all procs in same order, so indices are the same on all procs
+------------------------------------------------------------------------- */
+
+int Timer::add_detail(const char *kind, const char *id, const char *style)
+{
+  char *name = new char[strlen(kind) + strlen(id) + 2];
+  sprintf(name,"%s/%s",kind,id);
+
+  int i = find_detail(name);
+  if (i < 0) {
+    if (ndetail == maxdetail) {
+      maxdetail += 16;
+      detail_name = (char **)
+        memory->srealloc(detail_name,maxdetail*sizeof(char *),
+                         "timer:detail_name");
+      detail_style = (char **)
+        memory->srealloc(detail_style,maxdetail*sizeof(char *),
+                         "timer:detail_style");
+      memory->grow(detail_cpu,maxdetail,"timer:detail_cpu");
+      memory->grow(detail_wall,maxdetail,"timer:detail_wall");
+      memory->grow(detail_cpu_start,maxdetail,"timer:detail_cpu_start");
+      memory->grow(detail_wall_start,maxdetail,"timer:detail_wall_start");
+      memory->grow(detail_depth,maxdetail,"timer:detail_depth");
+    }
+    i = ndetail++;
+    detail_name[i] = name;
+    detail_style[i] = NULL;
+    detail_cpu[i] = detail_wall[i] = 0.0;
+    detail_depth[i] = 0;
+  } else delete [] name;
+
+  // ID may have been re-used by object of another style
+
+  delete [] detail_style[i];
+  detail_style[i] = new char[strlen(style) + 1];
+  strcpy(detail_style[i],style);
+
+  return i;
+}
+
+/* ----------------------------------------------------------------------
+   return index of per-object timer with name, -1 if not found
+------------------------------------------------------------------------- */
+
+int Timer::find_detail(const char *name)
+{
+  for (int i = 0; i < ndetail; i++)
+    if (strcmp(name,detail_name[i]) == 0) return i;
+  return -1;
+}
+
+/* ----------------------------------------------------------------------
+   start and stop per-object timer
+   nested calls for the same object, e.g. a compute invoked by itself
+     via a variable, only count the outermost call
+------------------------------------------------------------------------- */
+
+void Timer::_detail_start(int i)
+{
+  if (detail_depth[i]++) return;
+  detail_cpu_start[i] = CPU_Time();
+  detail_wall_start[i] = MPI_Wtime();
+}
+
+void Timer::_detail_stop(int i)
+{
+  if (--detail_depth[i]) return;
+  detail_cpu[i] += CPU_Time() - detail_cpu_start[i];
+  detail_wall[i] += MPI_Wtime() - detail_wall_start[i];
+}
+
 /* ---------------------------------------------------------------------- */
 
 void Timer::barrier_start()
@@ -275,7 +379,8 @@ double Timer::get_timeout_remain()
 /* ----------------------------------------------------------------------
    modify parameters of the Timer class
 ------------------------------------------------------------------------- */
-static const char *timer_style[] = { "off", "loop", "normal", "full" };
+static const char *timer_style[] = { "off", "loop", "normal", "full",
+                                      "detail" };
 static const char *timer_mode[]  = { "nosync", "(dummy)", "sync" };
 static const char  timer_fmt[]   = "New timer settings: style=%s  mode=%s  timeout=%s\n";
 
@@ -291,6 +396,8 @@ void Timer::modify_params(int narg, char **arg)
       _level = NORMAL;
     } else if (strcmp(arg[iarg],timer_style[FULL])   == 0) {
       _level = FULL;
+    } else if (strcmp(arg[iarg],timer_style[DETAIL]) == 0) {
+      _level = DETAIL;
     } else if (strcmp(arg[iarg],timer_mode[OFF])     == 0) {
       _sync  = OFF;
     } else if (strcmp(arg[iarg],timer_mode[NORMAL])  == 0) {
@@ -25,10 +25,10 @@ class Timer : protected Pointers {
   enum ttype  {RESET=-2,START=-1,TOTAL=0,PAIR,BOND,KSPACE,NEIGH,COMM,
                MODIFY,OUTPUT,SYNC,ALL,DEPHASE,DYNAMICS,QUENCH,NEB,REPCOMM,
                REPOUT,NUM_TIMER};
-  enum tlevel {OFF=0,LOOP,NORMAL,FULL};
+  enum tlevel {OFF=0,LOOP,NORMAL,FULL,DETAIL};
 
   Timer(class LAMMPS *);
-  ~Timer() {};
+  ~Timer();
   void init();
 
   // inline function to reduce overhead if we want no detailed timings
@@ -45,6 +45,7 @@ class Timer : protected Pointers {
   bool has_loop()   const { return (_level >= LOOP); }
   bool has_normal() const { return (_level >= NORMAL); }
   bool has_full()   const { return (_level >= FULL); }
+  bool has_detail() const { return (_level >= DETAIL); }
   bool has_sync()   const { return (_sync  != OFF); }
 
   // flag if wallclock time is expired
@@ -85,6 +86,26 @@ class Timer : protected Pointers {
 
   void modify_params(int, char **);
 
+  // per-object timers for individual fixes, computes, dumps, pair styles
+  // times are only accumulated for detail level
+  // inline functions to reduce overhead if we want no detailed timings
+
+  int add_detail(const char *, const char *, const char *);
+  int find_detail(const char *);
+
+  void detail_start(int i) {
+    if (_level > FULL && i >= 0) _detail_start(i);
+  }
+  void detail_stop(int i) {
+    if (_level > FULL && i >= 0) _detail_stop(i);
+  }
+
+  int get_ndetail() const { return ndetail; };
+  const char *get_detail_name(int i) const { return detail_name[i]; };
+  const char *get_detail_style(int i) const { return detail_style[i]; };
+  double get_detail_cpu(int i) const { return detail_cpu[i]; };
+  double get_detail_wall(int i) const { return detail_wall[i]; };
+
  private:
   double cpu_array[NUM_TIMER];
   double wall_array[NUM_TIMER];
@@ -98,6 +119,18 @@ class Timer : protected Pointers {
   int _checkfreq; // frequency of timeout checking
   int _nextcheck; // loop number of next timeout check
 
+  int ndetail,maxdetail;         // # of per-object timers and allocated size
+  char **detail_name;            // kind/ID of object, e.g. fix/1
+  char **detail_style;           // style of object
+  double *detail_cpu;            // accumulated times of each object
+  double *detail_wall;
+  double *detail_cpu_start;      // time when object was last started
+  double *detail_wall_start;
+  int *detail_depth;             // > 0 if object is being timed
+
+  void _detail_start(int);
+  void _detail_stop(int);
+
   // update one specific timer array
   void _stamp(enum ttype);
 
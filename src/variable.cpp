@@ -1305,7 +1305,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_SCALAR)) {
-            compute->compute_scalar();
+            compute->invoke_scalar();
             compute->invoked_flag |= INVOKED_SCALAR;
           }
 
@@ -1332,7 +1332,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
+            compute->invoke_vector();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
 
@@ -1364,7 +1364,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-            compute->compute_array();
+            compute->invoke_array();
             compute->invoked_flag |= INVOKED_ARRAY;
           }
 
@@ -1397,7 +1397,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-            compute->compute_vector();
+            compute->invoke_vector();
             compute->invoked_flag |= INVOKED_VECTOR;
           }
 
@@ -1428,7 +1428,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-            compute->compute_array();
+            compute->invoke_array();
             compute->invoked_flag |= INVOKED_ARRAY;
           }
 
@@ -1452,7 +1452,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->invoke_peratom();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1472,7 +1472,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->invoke_peratom();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1501,7 +1501,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->invoke_peratom();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -1533,7 +1533,7 @@ double Variable::evaluate(char *str, Tree **tree)
               error->all(FLERR,"Compute used in variable between runs "
                          "is not current");
           } else if (!(compute->invoked_flag & INVOKED_PERATOM)) {
-            compute->compute_peratom();
+            compute->invoke_peratom();
             compute->invoked_flag |= INVOKED_PERATOM;
           }
 
@@ -3941,7 +3941,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
             error->all(FLERR,
                        "Compute used in variable between runs is not current");
         } else if (!(compute->invoked_flag & INVOKED_VECTOR)) {
-          compute->compute_vector();
+          compute->invoke_vector();
           compute->invoked_flag |= INVOKED_VECTOR;
         }
         nvec = compute->size_vector;
@@ -3955,7 +3955,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
             error->all(FLERR,
                        "Compute used in variable between runs is not current");
         } else if (!(compute->invoked_flag & INVOKED_ARRAY)) {
-          compute->compute_array();
+          compute->invoke_array();
           compute->invoked_flag |= INVOKED_ARRAY;
         }
         nvec = compute->size_array_rows;
@@ -38,6 +38,9 @@ using namespace LAMMPS_NS;
 
 enum{IGNORE,WARN,ERROR};                    // same as thermo.cpp
 enum{II,IJ};
+enum{BINARY_PACKED,BINARY_INT64};           // same as read_data.cpp
+
+#define BINARY_MAGIC 0x4C4D5044             // same as read_data.cpp
 
 /* ---------------------------------------------------------------------- */
 
@@ -74,6 +77,7 @@ void WriteData::command(int narg, char **arg)
 
   pairflag = II;
   coeffflag = 1;
+  binaryflag = 0;
   int noinit = 0;
 
   int iarg = 1;
@@ -90,6 +94,9 @@ void WriteData::command(int narg, char **arg)
     } else if (strcmp(arg[iarg],"nocoeff") == 0) {
       coeffflag = 0;
       iarg++;
+    } else if (strcmp(arg[iarg],"binary") == 0) {
+      binaryflag = 1;
+      iarg++;
     } else error->all(FLERR,"Illegal write_data command");
   }
 
@@ -167,7 +174,7 @@ void WriteData::write(char *file)
   // open data file
 
   if (me == 0) {
-    fp = fopen(file,"w");
+    fp = fopen(file,"wb");
     if (fp == NULL) {
       char str[128];
       sprintf(str,"Cannot open data file %s",file);
@@ -333,11 +340,20 @@ void WriteData::atoms()
 
   int tmp,recvrow;
 
+  bigint nrow = sendrow;
+  if (binaryflag) {
+    bigint nsend = sendrow;
+    MPI_Allreduce(&nsend,&nrow,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  }
+
   if (me == 0) {
     MPI_Status status;
     MPI_Request request;
 
-    fprintf(fp,"\nAtoms # %s\n\n",atom->atom_style);
+    if (binaryflag) {
+      fprintf(fp,"\nBinary Atoms # %s\n\n",atom->atom_style);
+      binary_header(BINARY_PACKED,nrow,ncol);
+    } else fprintf(fp,"\nAtoms # %s\n\n",atom->atom_style);
     for (int iproc = 0; iproc < nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_DOUBLE,iproc,0,world,&request);
@@ -347,7 +363,8 @@ void WriteData::atoms()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_data(fp,recvrow,buf);
+      if (binaryflag) binary_atoms(recvrow,ncol,buf);
+      else atom->avec->write_data(fp,recvrow,buf);
     }
 
   } else {
@@ -387,11 +404,20 @@ void WriteData::velocities()
 
   int tmp,recvrow;
 
+  bigint nrow = sendrow;
+  if (binaryflag) {
+    bigint nsend = sendrow;
+    MPI_Allreduce(&nsend,&nrow,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  }
+
   if (me == 0) {
     MPI_Status status;
     MPI_Request request;
 
-    fprintf(fp,"\nVelocities\n\n");
+    if (binaryflag) {
+      fprintf(fp,"\nBinary Velocities\n\n");
+      binary_header(BINARY_PACKED,nrow,ncol);
+    } else fprintf(fp,"\nVelocities\n\n");
     for (int iproc = 0; iproc < nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_DOUBLE,iproc,0,world,&request);
@@ -401,7 +427,8 @@ void WriteData::velocities()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_vel(fp,recvrow,buf);
+      if (binaryflag) binary_atoms(recvrow,ncol,buf);
+      else atom->avec->write_vel(fp,recvrow,buf);
     }
 
   } else {
@@ -439,12 +466,21 @@ void WriteData::bonds()
 
   int tmp,recvrow;
 
+  bigint nrow = sendrow;
+  if (binaryflag) {
+    bigint nsend = sendrow;
+    MPI_Allreduce(&nsend,&nrow,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  }
+
   int index = 1;
   if (me == 0) {
     MPI_Status status;
     MPI_Request request;
 
-    fprintf(fp,"\nBonds\n\n");
+    if (binaryflag) {
+      fprintf(fp,"\nBinary Bonds\n\n");
+      binary_header(BINARY_INT64,nrow,ncol+1);
+    } else fprintf(fp,"\nBonds\n\n");
     for (int iproc = 0; iproc < nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -454,7 +490,8 @@ void WriteData::bonds()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_bond(fp,recvrow,buf,index);
+      if (binaryflag) binary_topology(recvrow,ncol,buf,index);
+      else atom->avec->write_bond(fp,recvrow,buf,index);
       index += recvrow;
     }
 
@@ -493,12 +530,21 @@ void WriteData::angles()
 
   int tmp,recvrow;
 
+  bigint nrow = sendrow;
+  if (binaryflag) {
+    bigint nsend = sendrow;
+    MPI_Allreduce(&nsend,&nrow,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  }
+
   int index = 1;
   if (me == 0) {
     MPI_Status status;
     MPI_Request request;
 
-    fprintf(fp,"\nAngles\n\n");
+    if (binaryflag) {
+      fprintf(fp,"\nBinary Angles\n\n");
+      binary_header(BINARY_INT64,nrow,ncol+1);
+    } else fprintf(fp,"\nAngles\n\n");
     for (int iproc = 0; iproc < nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -508,7 +554,8 @@ void WriteData::angles()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_angle(fp,recvrow,buf,index);
+      if (binaryflag) binary_topology(recvrow,ncol,buf,index);
+      else atom->avec->write_angle(fp,recvrow,buf,index);
       index += recvrow;
     }
 
@@ -565,12 +612,21 @@ void WriteData::dihedrals()
 
   int tmp,recvrow;
 
+  bigint nrow = sendrow;
+  if (binaryflag) {
+    bigint nsend = sendrow;
+    MPI_Allreduce(&nsend,&nrow,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  }
+
   int index = 1;
   if (me == 0) {
     MPI_Status status;
     MPI_Request request;
 
-    fprintf(fp,"\nDihedrals\n\n");
+    if (binaryflag) {
+      fprintf(fp,"\nBinary Dihedrals\n\n");
+      binary_header(BINARY_INT64,nrow,ncol+1);
+    } else fprintf(fp,"\nDihedrals\n\n");
     for (int iproc = 0; iproc < nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -580,7 +636,8 @@ void WriteData::dihedrals()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_dihedral(fp,recvrow,buf,index);
+      if (binaryflag) binary_topology(recvrow,ncol,buf,index);
+      else atom->avec->write_dihedral(fp,recvrow,buf,index);
       index += recvrow;
     }
 
@@ -637,12 +694,21 @@ void WriteData::impropers()
 
   int tmp,recvrow;
 
+  bigint nrow = sendrow;
+  if (binaryflag) {
+    bigint nsend = sendrow;
+    MPI_Allreduce(&nsend,&nrow,1,MPI_LMP_BIGINT,MPI_SUM,world);
+  }
+
   int index = 1;
   if (me == 0) {
     MPI_Status status;
     MPI_Request request;
 
-    fprintf(fp,"\nImpropers\n\n");
+    if (binaryflag) {
+      fprintf(fp,"\nBinary Impropers\n\n");
+      binary_header(BINARY_INT64,nrow,ncol+1);
+    } else fprintf(fp,"\nImpropers\n\n");
     for (int iproc = 0; iproc < nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -652,7 +718,8 @@ void WriteData::impropers()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_improper(fp,recvrow,buf,index);
+      if (binaryflag) binary_topology(recvrow,ncol,buf,index);
+      else atom->avec->write_improper(fp,recvrow,buf,index);
       index += recvrow;
     }
 
@@ -717,3 +784,48 @@ void WriteData::fix(int ifix, int mth)
 
   memory->destroy(buf);
 }
+
+/* ----------------------------------------------------------------------
+   proc 0 writes block header of a Binary section
+   magic number, value type, # of records, # of values per record
+------------------------------------------------------------------------- */
+
+void WriteData::binary_header(int valtype, bigint nrow, int ncol)
+{
+  int ibuf[2];
+  int64_t lbuf[2];
+  ibuf[0] = BINARY_MAGIC;
+  ibuf[1] = valtype;
+  lbuf[0] = nrow;
+  lbuf[1] = ncol;
+  fwrite(ibuf,sizeof(int),2,fp);
+  fwrite(lbuf,sizeof(int64_t),2,fp);
+}
+
+/* ----------------------------------------------------------------------
+   proc 0 writes N atom or velocity records
+   records are rows of buf as packed by AtomVec::pack_data() or pack_vel(),
+     integer values are stored in buf as ubuf, so they are written as int64
+------------------------------------------------------------------------- */
+
+void WriteData::binary_atoms(int n, int ncol, double **buf)
+{
+  if (n == 0) return;
+  fwrite(&buf[0][0],sizeof(double),(size_t) n*ncol,fp);
+}
+
+/* ----------------------------------------------------------------------
+   proc 0 writes N topology records as 64-bit ints
+   each record = index, type, atom IDs, same as a text line
+------------------------------------------------------------------------- */
+
+void WriteData::binary_topology(int n, int ncol, tagint **buf, int index)
+{
+  int64_t record[8];
+
+  for (int i = 0; i < n; i++) {
+    record[0] = index + i;
+    for (int j = 0; j < ncol; j++) record[j+1] = buf[i][j];
+    fwrite(record,sizeof(int64_t),ncol+1,fp);
+  }
+}
@@ -35,6 +35,7 @@ class WriteData : protected Pointers {
   int me,nprocs;
   int pairflag;
   int coeffflag;
+  int binaryflag;
   FILE *fp;
   bigint nbonds_local,nbonds;
   bigint nangles_local,nangles;
@@ -49,6 +50,10 @@ class WriteData : protected Pointers {
   void dihedrals();
   void impropers();
   void fix(int, int);
+
+  void binary_header(int, bigint, int);
+  void binary_atoms(int, int, double **);
+  void binary_topology(int, int, tagint **, int);
 };
 
 }
@@ -13,6 +13,7 @@
 
 #include <mpi.h>
 #include <string.h>
+#include <stdlib.h>
 #include "write_restart.h"
 #include "atom.h"
 #include "atom_vec.h"
@@ -45,6 +46,7 @@ using namespace LAMMPS_NS;
 #define ENDIAN 0x0001
 #define ENDIANSWAP 0x1000
 #define VERSION_NUMERIC 0
+#define DELTASIZE 8
 
 enum{VERSION,SMALLINT,TAGINT,BIGINT,
      UNITS,NTIMESTEP,DIMENSION,NPROCS,PROCGRID,
@@ -61,10 +63,25 @@ enum{VERSION,SMALLINT,TAGINT,BIGINT,
      MULTIPROC,MPIIO,PROCSPERFILE,PERPROC,
      IMAGEINT,BOUNDMIN,TIMESTEP,
      ATOM_ID,ATOM_MAP_STYLE,ATOM_MAP_USER,ATOM_SORTFREQ,ATOM_SORTBIN,
-     COMM_MODE,COMM_CUTOFF,COMM_VEL};
+     COMM_MODE,COMM_CUTOFF,COMM_VEL,
+     DELTA_BASE,DELTA_OFFSET,DELTA_NPROCS,DELTA_CHECKSUM,DELTAPROC};
 
 enum{IGNORE,WARN,ERROR};                    // same as thermo.cpp
 
+#define DRAINCHUNK 4194304    // # of bytes copied at once by I/O thread
+
+#if defined(LAMMPS_ASYNC_RESTART)
+#include <unistd.h>
+
+// entry point of I/O thread
+
+static void *restart_drain_worker(void *ptr)
+{
+  ((WriteRestart *) ptr)->drain_loop();
+  return NULL;
+}
+#endif
+
 /* ---------------------------------------------------------------------- */
 
 WriteRestart::WriteRestart(LAMMPS *lmp) : Pointers(lmp)
@@ -74,6 +91,42 @@ WriteRestart::WriteRestart(LAMMPS *lmp) : Pointers(lmp)
   multiproc = 0;
   noinit = 0;
   fp = NULL;
+
+  delta = 1;
+  deltaflag = 0;
+  ndelta = 0;
+  deltabase = NULL;
+
+  stagedir = NULL;
+  ndrain = 0;
+  drainwait = NULL;
+  drainerror = 0;
+  drain_active = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+WriteRestart::~WriteRestart()
+{
+  // wait for staged files to be moved, then tell I/O thread to exit
+
+  drain_flush();
+
+#if defined(LAMMPS_ASYNC_RESTART)
+  if (drain_active) {
+    pthread_mutex_lock(&drain_mutex);
+    drain_quit = 1;
+    pthread_cond_broadcast(&drain_cond);
+    pthread_mutex_unlock(&drain_mutex);
+    pthread_join(iothread,NULL);
+    pthread_mutex_destroy(&drain_mutex);
+    pthread_cond_destroy(&drain_cond);
+  }
+#endif
+
+  delete [] deltabase;
+  delete [] stagedir;
+  delete [] drainwait;
 }
 
 /* ----------------------------------------------------------------------
@@ -108,6 +161,9 @@ void WriteRestart::command(int narg, char **arg)
   // also called by Output class for periodic restart files
 
   multiproc_options(multiproc,mpiioflag,narg-1,&arg[1]);
+  if (delta > 1)
+    error->all(FLERR,"Write_restart delta keyword can only be used "
+               "with restart command");
 
   // init entire system since comm->exchange is done
   // comm::init needs neighbor::init needs pair::init needs kspace::init, etc
@@ -226,6 +282,28 @@ void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
     } else if (strcmp(arg[iarg],"noinit") == 0) {
       noinit = 1;
       iarg++;
+
+    } else if (strcmp(arg[iarg],"delta") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal write_restart command");
+      delta = force->inumeric(FLERR,arg[iarg+1]);
+      if (delta <= 0) error->all(FLERR,"Illegal write_restart command");
+      if (delta > 1 && (multiproc || mpiioflag))
+        error->all(FLERR,"Restart delta files require a single "
+                   "native restart file");
+      iarg += 2;
+
+    } else if (strcmp(arg[iarg],"stage") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal write_restart command");
+#if !defined(LAMMPS_ASYNC_RESTART)
+      error->all(FLERR,"Restart stage keyword requires LAMMPS be built "
+                 "with -DLAMMPS_ASYNC_RESTART");
+#endif
+      if (mpiioflag)
+        error->all(FLERR,"Restart stage keyword cannot be used with MPI-IO");
+      delete [] stagedir;
+      stagedir = new char[strlen(arg[iarg+1]) + 1];
+      strcpy(stagedir,arg[iarg+1]);
+      iarg += 2;
     } else error->all(FLERR,"Illegal write_restart command");
   }
 }
@@ -233,9 +311,10 @@ void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
 /* ----------------------------------------------------------------------
    called from command() and directly from output within run/minimize loop
    file = final file name to write, except may contain a "%"
+   deltaok = 1 if file can be written as a delta file
 ------------------------------------------------------------------------- */
 
-void WriteRestart::write(char *file)
+void WriteRestart::write(char *file, int deltaok)
 {
   // special case where reneighboring is not done in integrator
   //   on timestep restart file is written (due to build_once being set)
@@ -246,6 +325,10 @@ void WriteRestart::write(char *file)
 
   if (neighbor->build_once) domain->reset_box();
 
+  // staged files of previous restart must be moved before staging new ones
+
+  drain_flush();
+
   // natoms = sum of nlocal = value to write into restart file
   // if unequal and thermo lostflag is "error", don't write restart file
 
@@ -254,6 +337,91 @@ void WriteRestart::write(char *file)
   if (natoms != atom->natoms && output->thermo->lostflag == ERROR)
     error->all(FLERR,"Atom count is inconsistent, cannot write restart file");
 
+  // communication buffer for my atom info
+  // max_size = largest buffer needed by any proc
+
+  int max_size;
+  int send_size = atom->avec->size_restart();
+  MPI_Allreduce(&send_size,&max_size,1,MPI_INT,MPI_MAX,world);
+
+  double *buf;
+  memory->create(buf,max_size,"write_restart:buf");
+
+  // pack my atom data into buf
+
+  AtomVec *avec = atom->avec;
+  int n = 0;
+  for (int i = 0; i < atom->nlocal; i++) n += avec->pack_restart(i,&buf[n]);
+
+  // if any fix requires it, remap each atom's coords via PBC
+  // is because fix changes atom coords (excepting an integrate fix)
+  // just remap in buffer, not actual atoms
+
+  if (modify->restart_pbc_any) {
+    int triclinic = domain->triclinic;
+    double *lo,*hi,*period;
+
+    if (triclinic == 0) {
+      lo = domain->boxlo;
+      hi = domain->boxhi;
+      period = domain->prd;
+    } else {
+      lo = domain->boxlo_lamda;
+      hi = domain->boxhi_lamda;
+      period = domain->prd_lamda;
+    }
+
+    int xperiodic = domain->xperiodic;
+    int yperiodic = domain->yperiodic;
+    int zperiodic = domain->zperiodic;
+
+    double *x;
+    int m = 0;
+    for (int i = 0; i < atom->nlocal; i++) {
+      x = &buf[m+1];
+      if (triclinic) domain->x2lamda(x,x);
+
+      if (xperiodic) {
+        if (x[0] < lo[0]) x[0] += period[0];
+        if (x[0] >= hi[0]) x[0] -= period[0];
+        x[0] = MAX(x[0],lo[0]);
+      }
+      if (yperiodic) {
+        if (x[1] < lo[1]) x[1] += period[1];
+        if (x[1] >= hi[1]) x[1] -= period[1];
+        x[1] = MAX(x[1],lo[1]);
+      }
+      if (zperiodic) {
+        if (x[2] < lo[2]) x[2] += period[2];
+        if (x[2] >= hi[2]) x[2] -= period[2];
+        x[2] = MAX(x[2],lo[2]);
+      }
+
+      if (triclinic) domain->lamda2x(x,x);
+      m += static_cast<int> (buf[m]);
+    }
+  }
+
+  // write a delta file if atoms have the same per-atom info as in base file
+  // except for coords, image flags, velocities which are all a delta stores
+  // checksum is independent of which proc owns which atom
+
+  deltaflag = 0;
+  bigint checksum = 0;
+  if (delta > 1 && deltaok) {
+    if (!atom->tag_enable || atom->smd_flag) deltaok = 0;
+    else {
+      bigint sum[2],sum_all[2];
+      sum[0] = sum[1] = 0;
+      for (int m = 0; m < n; m += static_cast<int> (buf[m]))
+        checksum_record(&buf[m],sum);
+      MPI_Allreduce(sum,sum_all,2,MPI_LMP_BIGINT,MPI_SUM,world);
+      checksum = checksum_combine(sum_all);
+      if (deltabase && ndelta < delta-1 && natoms == deltanatoms &&
+          checksum == deltachecksum) deltaflag = 1;
+    }
+  }
+
   // open single restart file or base file for multiproc case
 
   if (me == 0) {
@@ -265,7 +433,7 @@ void WriteRestart::write(char *file)
       sprintf(hfile,"%s%s%s",file,"base",ptr+1);
       *ptr = '%';
     } else hfile = file;
-    fp = fopen(hfile,"wb");
+    fp = open_file(hfile);
     if (fp == NULL) {
       char str[128];
       sprintf(str,"Cannot open restart file %s",hfile);
@@ -295,20 +463,38 @@ void WriteRestart::write(char *file)
 
   modify->write_restart(fp);
 
-  // communication buffer for my atom info
-  // max_size = largest buffer needed by any proc
-
-  int max_size;
-  int send_size = atom->avec->size_restart();
-  MPI_Allreduce(&send_size,&max_size,1,MPI_INT,MPI_MAX,world);
-
-  double *buf;
-  memory->create(buf,max_size,"write_restart:buf");
-
   // all procs write file layout info which may include per-proc sizes
 
   file_layout(send_size);
 
+  // delta file: compress each atom to coords, tag, image flags, velocities
+  // base file: remember where its per-atom info starts
+
+  if (deltaflag) {
+    double one[DELTASIZE];
+    int m = 0;
+    int k = 0;
+    while (m < n) {
+      for (int j = 0; j < 4; j++) one[j] = buf[m+1+j];
+      for (int j = 4; j < DELTASIZE; j++) one[j] = buf[m+3+j];
+      m += static_cast<int> (buf[m]);
+      for (int j = 0; j < DELTASIZE; j++) buf[k++] = one[j];
+    }
+    send_size = n = k;
+    ndelta++;
+
+  } else if (delta > 1 && deltaok) {
+    if (me == 0) deltaoffset = ftell(fp);
+    MPI_Bcast(&deltaoffset,1,MPI_LMP_BIGINT,0,world);
+    delete [] deltabase;
+    deltabase = new char[strlen(file) + 1];
+    strcpy(deltabase,file);
+    deltanprocs = nprocs;
+    deltanatoms = natoms;
+    deltachecksum = checksum;
+    ndelta = 0;
+  }
+
   // header info is complete
   // if multiproc output:
   //   close header file, open multiname file on each writing proc,
@@ -326,8 +512,12 @@ void WriteRestart::write(char *file)
     sprintf(multiname,"%s%d%s",file,icluster,ptr+1);
     *ptr = '%';
 
+    // if staging, remove piece of an earlier restart with same name,
+    //   so base file is not moved while a stale piece stands in for it
+
     if (filewriter) {
-      fp = fopen(multiname,"wb");
+      if (stagedir) remove(multiname);
+      fp = open_file(multiname);
       if (fp == NULL) {
         char str[128];
         sprintf(str,"Cannot open restart file %s",multiname);
@@ -339,61 +529,6 @@ void WriteRestart::write(char *file)
     delete [] multiname;
   }
 
-  // pack my atom data into buf
-
-  AtomVec *avec = atom->avec;
-  int n = 0;
-  for (int i = 0; i < atom->nlocal; i++) n += avec->pack_restart(i,&buf[n]);
-
-  // if any fix requires it, remap each atom's coords via PBC
-  // is because fix changes atom coords (excepting an integrate fix)
-  // just remap in buffer, not actual atoms
-
-  if (modify->restart_pbc_any) {
-    int triclinic = domain->triclinic;
-    double *lo,*hi,*period;
-
-    if (triclinic == 0) {
-      lo = domain->boxlo;
-      hi = domain->boxhi;
-      period = domain->prd;
-    } else {
-      lo = domain->boxlo_lamda;
-      hi = domain->boxhi_lamda;
-      period = domain->prd_lamda;
-    }
-
-    int xperiodic = domain->xperiodic;
-    int yperiodic = domain->yperiodic;
-    int zperiodic = domain->zperiodic;
-
-    double *x;
-    int m = 0;
-    for (int i = 0; i < atom->nlocal; i++) {
-      x = &buf[m+1];
-      if (triclinic) domain->x2lamda(x,x);
-
-      if (xperiodic) {
-        if (x[0] < lo[0]) x[0] += period[0];
-        if (x[0] >= hi[0]) x[0] -= period[0];
-        x[0] = MAX(x[0],lo[0]);
-      }
-      if (yperiodic) {
-        if (x[1] < lo[1]) x[1] += period[1];
-        if (x[1] >= hi[1]) x[1] -= period[1];
-        x[1] = MAX(x[1],lo[1]);
-      }
-      if (zperiodic) {
-        if (x[2] < lo[2]) x[2] += period[2];
-        if (x[2] >= hi[2]) x[2] -= period[2];
-        x[2] = MAX(x[2],lo[2]);
-      }
-
-      if (triclinic) domain->lamda2x(x,x);
-      m += static_cast<int> (buf[m]);
-    }
-  }
-
   // MPI-IO output to single file
 
   if (mpiioflag) {
@@ -425,7 +560,7 @@ void WriteRestart::write(char *file)
           MPI_Get_count(&status,MPI_DOUBLE,&recv_size);
         } else recv_size = send_size;
 
-        write_double_vec(PERPROC,recv_size,buf);
+        write_double_vec(deltaflag ? DELTAPROC : PERPROC,recv_size,buf);
       }
       fclose(fp);
       fp = NULL;
@@ -445,6 +580,203 @@ void WriteRestart::write(char *file)
   for (int ifix = 0; ifix < modify->nfix; ifix++)
     if (modify->fix[ifix]->restart_file)
       modify->fix[ifix]->write_restart_file(file);
+
+  // hand staged files to I/O thread
+  // with multiproc files, base file is moved last after all pieces exist,
+  //   so that read_restart finds only complete restart files
+  // barrier insures all stale pieces are removed before proc 0 waits on them
+
+  if (stagedir && multiproc) MPI_Barrier(world);
+
+  if (ndrain) {
+    drainlast = -1;
+    if (multiproc && me == 0) {
+      drainlast = 0;
+      delete [] drainwait;
+      drainwait = new char[strlen(file) + 1];
+      strcpy(drainwait,file);
+      nwait = multiproc;
+    }
+    drain_start();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   open a restart file for writing
+   if staging, open it in stage dir and remember to move it to name later
+------------------------------------------------------------------------- */
+
+FILE *WriteRestart::open_file(char *name)
+{
+  if (stagedir == NULL) return fopen(name,"wb");
+
+  const char *ptr = strrchr(name,'/');
+  ptr = ptr ? ptr+1 : name;
+  drainfrom[ndrain] = new char[strlen(stagedir) + strlen(ptr) + 2];
+  sprintf(drainfrom[ndrain],"%s/%s",stagedir,ptr);
+  drainto[ndrain] = new char[strlen(name) + 1];
+  strcpy(drainto[ndrain],name);
+
+  return fopen(drainfrom[ndrain++],"wb");
+}
+
+/* ----------------------------------------------------------------------
+   hand staged files to I/O thread, create thread on first use
+------------------------------------------------------------------------- */
+
+void WriteRestart::drain_start()
+{
+#if defined(LAMMPS_ASYNC_RESTART)
+  if (!drain_active) {
+    drain_pending = drain_quit = 0;
+    pthread_mutex_init(&drain_mutex,NULL);
+    pthread_cond_init(&drain_cond,NULL);
+    pthread_create(&iothread,NULL,&restart_drain_worker,this);
+    drain_active = 1;
+  }
+
+  pthread_mutex_lock(&drain_mutex);
+  drain_pending = 1;
+  pthread_cond_broadcast(&drain_cond);
+  pthread_mutex_unlock(&drain_mutex);
+#else
+  drain_files();
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   wait until I/O thread has moved staged files
+   called before next restart is written and by Output at end of run
+------------------------------------------------------------------------- */
+
+void WriteRestart::drain_flush()
+{
+#if defined(LAMMPS_ASYNC_RESTART)
+  if (drain_active) {
+    pthread_mutex_lock(&drain_mutex);
+    while (drain_pending) pthread_cond_wait(&drain_cond,&drain_mutex);
+    pthread_mutex_unlock(&drain_mutex);
+  }
+#endif
+
+  if (drainerror) {
+    char str[128];
+    snprintf(str,128,"Failed to move staged restart file to %s",
+             drainto[drainerror-1]);
+    error->one(FLERR,str);
+  }
+
+  for (int i = 0; i < ndrain; i++) {
+    delete [] drainfrom[i];
+    delete [] drainto[i];
+  }
+  ndrain = 0;
+}
+
+#if defined(LAMMPS_ASYNC_RESTART)
+
+/* ----------------------------------------------------------------------
+   I/O thread waits for staged files, moves them, signals completion
+   exits when told to and no files are pending
+------------------------------------------------------------------------- */
+
+void WriteRestart::drain_loop()
+{
+  pthread_mutex_lock(&drain_mutex);
+  while (1) {
+    while (!drain_pending && !drain_quit)
+      pthread_cond_wait(&drain_cond,&drain_mutex);
+    if (!drain_pending) break;
+
+    pthread_mutex_unlock(&drain_mutex);
+    drain_files();
+    pthread_mutex_lock(&drain_mutex);
+
+    drain_pending = 0;
+    pthread_cond_broadcast(&drain_cond);
+  }
+  pthread_mutex_unlock(&drain_mutex);
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+   move staged files to final location
+   file drainlast is moved after all nwait pieces named by drainwait exist
+   no MPI or error calls, since this runs in I/O thread
+   on failure, drainerror = index of failed file + 1
+------------------------------------------------------------------------- */
+
+void WriteRestart::drain_files()
+{
+  for (int i = 0; i < ndrain; i++) {
+    if (i == drainlast) continue;
+    if (move_file(drainfrom[i],drainto[i])) {
+      drainerror = i+1;
+      return;
+    }
+  }
+
+  if (drainlast < 0) return;
+
+#if defined(LAMMPS_ASYNC_RESTART)
+  char *piece = new char[strlen(drainwait) + 16];
+  char *ptr = strchr(drainwait,'%');
+  int delay = 1000;
+  for (int icluster = 0; icluster < nwait; icluster++) {
+    *ptr = '\0';
+    sprintf(piece,"%s%d%s",drainwait,icluster,ptr+1);
+    *ptr = '%';
+    while (access(piece,F_OK) != 0) {
+      usleep(delay);
+      delay = MIN(2*delay,1000000);
+    }
+  }
+  delete [] piece;
+#endif
+
+  if (move_file(drainfrom[drainlast],drainto[drainlast]))
+    drainerror = drainlast+1;
+}
+
+/* ----------------------------------------------------------------------
+   move file from to file to, rename if on same file system, else copy
+   copy goes to hidden file in dir of to, which is then renamed to to,
+     so that to never exists as a partial file
+   return 0 if success, 1 if error
+------------------------------------------------------------------------- */
+
+int WriteRestart::move_file(const char *from, const char *to)
+{
+  if (rename(from,to) == 0) return 0;
+
+  const char *ptr = strrchr(to,'/');
+  int ndir = ptr ? ptr-to+1 : 0;
+  char *tmp = new char[strlen(to) + 16];
+  strncpy(tmp,to,ndir);
+  sprintf(&tmp[ndir],".%s.drain",&to[ndir]);
+
+  FILE *in = fopen(from,"rb");
+  FILE *out = fopen(tmp,"wb");
+  int flag = (in == NULL || out == NULL);
+
+  if (!flag) {
+    char *chunk = (char *) malloc(DRAINCHUNK);
+    size_t n;
+    while ((n = fread(chunk,1,DRAINCHUNK,in)) > 0)
+      if (fwrite(chunk,1,n,out) != n) flag = 1;
+    if (ferror(in)) flag = 1;
+    free(chunk);
+  }
+
+  if (in) fclose(in);
+  if (out && fclose(out) != 0) flag = 1;
+  if (!flag && rename(tmp,to) != 0) flag = 1;
+
+  if (flag) remove(tmp);
+  else remove(from);
+  delete [] tmp;
+  return flag;
 }
 
 /* ----------------------------------------------------------------------
@@ -590,6 +922,13 @@ void WriteRestart::file_layout(int send_size)
     write_int(MPIIO,mpiioflag);
   }
 
+  if (me == 0 && deltaflag) {
+    write_string(DELTA_BASE,deltabase);
+    write_bigint(DELTA_OFFSET,deltaoffset);
+    write_int(DELTA_NPROCS,deltanprocs);
+    write_bigint(DELTA_CHECKSUM,deltachecksum);
+  }
+
   if (mpiioflag) {
     int *all_send_sizes;
     memory->create(all_send_sizes,nprocs,"write_restart:all_send_sizes");
@@ -614,6 +953,42 @@ void WriteRestart::file_layout(int send_size)
   }
 }
 
+/* ----------------------------------------------------------------------
+   add hash of per-atom restart info in buf to running sums
+   skips coords, image flags, velocities which a delta file stores
+   sums of 31-bit halves are independent of order in which atoms are added
+------------------------------------------------------------------------- */
+
+void WriteRestart::checksum_record(double *buf, bigint *sum)
+{
+  int n = static_cast<int> (buf[0]);
+  uint64_t bits;
+  uint64_t h = 0xcbf29ce484222325ULL;
+
+  for (int m = 0; m < n; m++) {
+    if ((m >= 1 && m <= 3) || (m >= 7 && m <= 10)) continue;
+    memcpy(&bits,&buf[m],sizeof(uint64_t));
+    h = (h ^ bits) * 0x100000001b3ULL;
+  }
+
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+
+  sum[0] += static_cast<bigint> (h & 0x7fffffff);
+  sum[1] += static_cast<bigint> ((h >> 32) & 0x7fffffff);
+}
+
+/* ----------------------------------------------------------------------
+   combine sums from checksum_record() into a single checksum
+------------------------------------------------------------------------- */
+
+bigint WriteRestart::checksum_combine(bigint *sum)
+{
+  uint64_t h = static_cast<uint64_t> (sum[1]) * 0x9e3779b97f4a7c15ULL;
+  return static_cast<bigint> ((h ^ static_cast<uint64_t> (sum[0])) >> 1);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // low-level fwrite methods
@@ -23,14 +23,27 @@ CommandStyle(write_restart,WriteRestart)
 #include <stdio.h>
 #include "pointers.h"
 
+#if defined(LAMMPS_ASYNC_RESTART)
+#include <pthread.h>
+#endif
+
 namespace LAMMPS_NS {
 
 class WriteRestart : protected Pointers {
  public:
+  int delta;                 // every Nth file is full, others are deltas
+
   WriteRestart(class LAMMPS *);
+  ~WriteRestart();
   void command(int, char **);
   void multiproc_options(int, int, int, char **);
-  void write(char *);
+  void write(char *, int deltaok = 0);
+
+  static void checksum_record(double *, bigint *);
+  static bigint checksum_combine(bigint *);
+
+  void drain_flush();        // wait until I/O thread has moved staged files
+  void drain_loop();         // main loop of I/O thread
 
  private:
   int me,nprocs;
@@ -51,6 +64,42 @@ class WriteRestart : protected Pointers {
   class RestartMPIIO *mpiio;   // MPIIO for restart file output
   MPI_Offset headerOffset;
 
+  // delta files store only coords, image flags, velocities of each atom
+  // other per-atom info is read from last full file = base file
+
+  int deltaflag;             // 1 if file being written is a delta file
+  int ndelta;                // # of delta files written since base file
+  char *deltabase;           // name of base file, NULL if none
+  bigint deltaoffset;        // offset of per-atom section in base file
+  int deltanprocs;           // # of per-proc chunks in base file
+  bigint deltanatoms;        // # of atoms in base file
+  bigint deltachecksum;      // checksum of per-atom info in base file
+
+  // files staged in node-local dir, moved to final location by I/O thread
+
+  char *stagedir;            // dir to stage files in, NULL if not staging
+  int ndrain;                // # of staged files to move
+  char *drainfrom[2];        // staged name of each file
+  char *drainto[2];          // final name of each file
+  int drainlast;             // index of file moved after all pieces exist
+  char *drainwait;           // multiproc name of pieces, with "%"
+  int nwait;                 // # of pieces to wait for
+  int drainerror;            // 1 if I/O thread failed to move a file
+  int drain_active;          // 1 if I/O thread has been created
+
+#if defined(LAMMPS_ASYNC_RESTART)
+  int drain_pending;         // 1 if I/O thread has files to move
+  int drain_quit;            // 1 if I/O thread should exit
+  pthread_t iothread;
+  pthread_mutex_t drain_mutex;
+  pthread_cond_t drain_cond;
+#endif
+
+  FILE *open_file(char *);
+  void drain_start();
+  void drain_files();
+  int move_file(const char *, const char *);
+
   void header();
   void type_arrays();
   void force_fields();
@@ -112,4 +161,28 @@ E: Cannot open restart file %s
 
 Self-explanatory.
 
+E: Restart delta files require a single native restart file
+
+Delta restart files cannot be written as multiple files via "%" in
+the filename or via MPI-IO.
+
+E: Restart stage keyword requires LAMMPS be built with -DLAMMPS_ASYNC_RESTART
+
+Moving staged restart files from a background I/O thread uses
+pthreads, which must be enabled when LAMMPS is compiled.
+
+E: Restart stage keyword cannot be used with MPI-IO
+
+MPI-IO restart files are written directly to their final location.
+
+E: Failed to move staged restart file to %s
+
+The background I/O thread could not copy or rename a restart file
+from the stage directory to its final location.
+
+E: Write_restart delta keyword can only be used with restart command
+
+Delta restart files refer to a base file written earlier by the same
+restart command.
+
 */